@@ -123,6 +123,8 @@ namespace dlaf::gpublas::internal {
 // Level 1
 DLAF_MAKE_GPUBLAS_OP(Axpy, axpy);
 
+DLAF_MAKE_GPUBLAS_OP(Scal, scal);
+
 // Level 2
 DLAF_MAKE_GPUBLAS_OP(Gemv, gemv);
 
@@ -53,6 +53,23 @@ auto add(const dlaf::internal::Policy<B>& p, Sender&& s);
 template <Backend B>
 auto add(const dlaf::internal::Policy<B>& p);
 
+/// Computes A = alpha * A
+///
+/// This overload blocks until completion of the algorithm.
+template <Backend B, class T, Device D>
+void scal(T alpha, const matrix::Tile<T, D>& tile_a);
+
+/// This overload takes a policy argument and a sender which must send all required arguments for the
+/// algorithm. Returns a sender which signals a connected receiver when the algorithm is done.
+template <Backend B, typename Sender,
+          typename = std::enable_if_t<pika::execution::experimental::is_sender_v<Sender>>>
+auto scal(const dlaf::internal::Policy<B>& p, Sender&& s);
+
+/// This overload partially applies the algorithm with a policy for later use with operator| with a
+/// sender on the left-hand side.
+template <Backend B>
+auto scal(const dlaf::internal::Policy<B>& p);
+
 #else
 
 namespace internal {
@@ -77,10 +94,29 @@ void add(T alpha, const matrix::Tile<const T, Device::GPU>& tile_b,
 }
 #endif
 
+template <class T>
+void scal(const T alpha, const matrix::Tile<T, Device::CPU>& tile_a) {
+  common::internal::SingleThreadedBlasScope single;
+  for (auto j = 0; j < tile_a.size().cols(); ++j)
+    blas::scal(tile_a.size().rows(), alpha, tile_a.ptr({0, j}), 1);
+}
+
+#ifdef DLAF_WITH_GPU
+template <class T>
+void scal(cublasHandle_t handle, const T alpha, const matrix::Tile<T, Device::GPU>& tile_a) {
+  using util::blasToCublasCast;
+  for (auto j = 0; j < tile_a.size().cols(); ++j)
+    gpublas::internal::Scal<T>::call(handle, to_int(tile_a.size().rows()), blasToCublasCast(&alpha),
+                                     blasToCublasCast(tile_a.ptr({0, j})), 1);
+}
+#endif
+
 DLAF_MAKE_CALLABLE_OBJECT(add);
+DLAF_MAKE_CALLABLE_OBJECT(scal);
 }
 
 DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(dlaf::internal::TransformDispatchType::Plain, add, internal::add_o)
+DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(dlaf::internal::TransformDispatchType::Blas, scal, internal::scal_o)
 
 #endif
 }
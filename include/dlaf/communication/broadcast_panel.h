@@ -195,5 +195,59 @@ void broadcast(comm::IndexT_MPI rank_root, matrix::Panel<axis, T, D, storage>& p
   }
 }
 
+/// Broadcast
+///
+/// Given a panel already available on all the ranks along the grid axis orthogonal to it (e.g. after
+/// a broadcast), this communication pattern populates its "transposed" variant @p panelT (just tile
+/// coordinates, data is not transposed), whose tiles are indexed w.r.t. the distribution of another
+/// matrix, i.e. the tile i of @p panelT is the tile i of @p panel.
+///
+/// In particular, it does not give access to all the tiles, but just the ones of interest for
+/// each rank, by either:
+/// - linking as external tile, if the tile is already available locally for the rank
+/// - receiving the tile from the owning rank (via a broadcast)
+///
+/// Differently from the broadcast of panel pairs, the parent matrices do not have to be the same (nor
+/// square) and the panels do not have to lay on the main diagonal.
+///
+/// @param panel        the source panel, available on all the ranks along the grid axis orthogonal to it
+/// @param panelT       the destination panel
+/// @param serial_comm  where to pipeline the tasks for communications.
+/// @pre Communicator in @p serial_comm must be orthogonal to @p panelT axis
+/// @pre the tile i of @p panelT and the tile i of @p panel have the same size
+///      (i.e. the distributions of their parent matrices match along the respective coordinates)
+template <class T, Device D, Coord axis, matrix::StoreTransposed storage,
+          matrix::StoreTransposed storageT, class = std::enable_if_t<!std::is_const_v<T>>>
+void broadcastTransposed(matrix::Panel<orthogonal(axis), T, D, storage>& panel,
+                         matrix::Panel<axis, T, D, storageT>& panelT,
+                         common::Pipeline<comm::Communicator>& serial_comm) {
+  namespace ex = pika::execution::experimental;
+
+  constexpr Coord coord = std::decay_t<decltype(panel)>::coord;
+  constexpr Coord coordT = std::decay_t<decltype(panelT)>::coord;
+
+  const auto dist = panel.parentDistribution();
+  const auto distT = panelT.parentDistribution();
+
+  const auto rank = dist.rankIndex().get(coord);
+  const bool is_distributed = dist.commGridSize().get(coord) > 1;
+
+  for (const auto& indexT : panelT.iteratorLocal()) {
+    const SizeType index = distT.template globalTileFromLocalTile<coordT>(indexT.get(coordT));
+    const auto owner = dist.template rankGlobalTile<coord>(index);
+
+    if (rank == owner) {
+      const auto index_local = dist.template localTileFromGlobalTile<coord>(index);
+      panelT.setTile(indexT, panel.read({coord, index_local}));
+
+      if (is_distributed)
+        ex::start_detached(scheduleSendBcast(serial_comm(), panelT.read(indexT)));
+    }
+    else {
+      ex::start_detached(scheduleRecvBcast(serial_comm(), owner, panelT.readwrite(indexT)));
+    }
+  }
+}
+
 }
 }
@@ -108,5 +108,56 @@ protected:
   Size2D grid_size_ = Size2D(0, 0);
 };
 
+/// Create replicated communicators with a 2D Grid structure (layers), e.g. for 2.5D algorithms.
+///
+/// Given a communicator with exactly @p nlayers x @p rows x @p cols ranks, its ranks are split in
+/// @p nlayers groups of consecutive ranks, each one organized in a @p rows x @p cols CommunicatorGrid
+/// with given @p ordering. Moreover, the ranks with the same position in the grids of all the layers are
+/// grouped in a communicator, in which the rank of each process is the index of its layer.
+///
+/// CommunicatorGridLayers must be destroyed before calling MPI_Finalize, to allow it releasing
+/// resources.
+class CommunicatorGridLayers {
+public:
+  /// Create @p nlayers communicator grids @p rows x @p cols with given @p ordering.
+  /// @param comm must be valid during construction.
+  /// @pre comm.size() == nlayers * rows * cols.
+  CommunicatorGridLayers(Communicator comm, IndexT_MPI nlayers, IndexT_MPI rows, IndexT_MPI cols,
+                         common::Ordering ordering);
+
+  /// Return the index of the layer of the current process.
+  IndexT_MPI layer() const noexcept {
+    return layer_;
+  }
+
+  /// Return the number of layers.
+  IndexT_MPI nrLayers() const noexcept {
+    return nr_layers_;
+  }
+
+  /// Return the CommunicatorGrid of the layer of the current process.
+  CommunicatorGrid& grid() noexcept {
+    return grid_;
+  }
+
+  /// Return a Communicator grouping the ranks with the same grid position as the current process in all
+  /// the layers.
+  Communicator& layersCommunicator() noexcept {
+    return layers_;
+  }
+
+  /// Prints information about the CommunicatorGridLayers.
+  friend std::ostream& operator<<(std::ostream& out, const CommunicatorGridLayers& layers) {
+    return out << "layer=" << layers.layer_ << ", nr_layers=" << layers.nr_layers_ << ", "
+               << layers.grid_;
+  }
+
+protected:
+  IndexT_MPI layer_;
+  IndexT_MPI nr_layers_;
+  Communicator layers_;
+  CommunicatorGrid grid_;
+};
+
 }
 }
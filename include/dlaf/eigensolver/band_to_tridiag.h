@@ -94,6 +94,68 @@ TridiagResult<T, Device::CPU> bandToTridiag(blas::Uplo uplo, SizeType band_size,
   return DLAF_UNREACHABLE(TridiagResult<T, Device::CPU>);
 }
 
+/// Reduces a Hermitian band matrix A (with the given band_size(*)) to a Hermitian band matrix B with
+/// the smaller band_size_out(*) by a unitary similarity transformation Q**H * A * Q = B.
+///
+/// The reduction is the first stage of a two-stage reduction to tridiagonal form: the bulges are chased
+/// using blocks of band_size_out HouseHolder reflectors, which are applied with BLAS-3 operations, then
+/// B can be reduced to tridiagonal form with bandToTridiag, whose cost scales with band_size_out.
+///
+/// The band matrix returned is stored in a local Matrix with the same block size as mat_a, in the same
+/// way as the lower triangular part of the band matrix is stored in mat_a (the elements outside the band
+/// are set to zero).
+/// The HH Reflectors are returned in a compact form.
+/// The matrix Q is computed in the following way:
+/// HHB(0, 0) HHB(0, 1) .. HHB(0, last(0)) HHB(1, 0) .. HHB(1, last(1)) .. HHB(sw_last, last(sw_last))
+/// where sw_last = ceilDiv(m - 1 - band_size_out, band_size_out) - 1, m is the size of A
+/// and HHB(sw, st) is the block of HH transformations given by (Id - V T V^H), where V contains
+/// k = min(band_size_out, len) reflectors stored as the columns of a len x k lower trapezoidal matrix,
+/// last(sw) = ceilDiv(m - 1 - start(sw, 0), band_size) - 1,
+/// T is the upper triangular factor computed from V and the taus (see LAPACK larft) and
+/// - start(sw, st) = (sw + 1) * band_size_out + st * band_size
+/// - len = min(band_size, m - start(sw, st))
+/// - pos = ((start(sw, 0) - 1) / band_size + st) * band_size
+/// - the rows [start(sw, st), start(sw, st) + len) of V are stored in the rows [pos, pos + len) of
+///   the columns [sw * band_size_out, sw * band_size_out + k) of the returned hh_reflectors,
+/// - the diagonal of V (which is 1) is replaced by the taus,
+/// - all other elements of V are 0.
+///
+/// (*) diagonal + band_size off-diagonals.
+///
+/// Implementation on local memory.
+///
+/// @param mat_a contains the Hermitian band matrix A (if A is real, the matrix is symmetric).
+/// @pre mat_a has a square size,
+/// @pre mat_a has a square block size,
+/// @pre band_size is a divisor of mat_a.blockSize().cols(),
+/// @pre band_size_out is a divisor of band_size, band_size_out < band_size and band_size_out >= 2,
+/// @pre mat_a is not distributed.
+template <Backend B, Device D, class T>
+BandResult<T, Device::CPU> bandToBand(blas::Uplo uplo, SizeType band_size, SizeType band_size_out,
+                                      Matrix<const T, D>& mat_a) {
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(mat_a.blockSize().rows() % band_size == 0, mat_a.blockSize().rows(), band_size);
+  DLAF_ASSERT(matrix::local_matrix(mat_a), mat_a);
+  DLAF_ASSERT(band_size_out >= 2, band_size_out);
+  DLAF_ASSERT(band_size_out < band_size, band_size_out, band_size);
+  DLAF_ASSERT(band_size % band_size_out == 0, band_size, band_size_out);
+
+  switch (uplo) {
+    case blas::Uplo::Lower:
+      return internal::BandToBand<B, D, T>::call_L(band_size, band_size_out, mat_a);
+      break;
+    case blas::Uplo::Upper:
+      DLAF_UNIMPLEMENTED(uplo);
+      break;
+    case blas::Uplo::General:
+      DLAF_UNIMPLEMENTED(uplo);
+      break;
+  }
+
+  return DLAF_UNREACHABLE(BandResult<T, Device::CPU>);
+}
+
 /// Reduces a Hermitian band matrix A (with the given band_size(*)) to real symmetric tridiagonal
 /// form T by a unitary similarity transformation Q**H * A * Q = T.
 ///
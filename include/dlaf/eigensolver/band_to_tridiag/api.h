@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <dlaf/common/pipeline.h>
+#include <dlaf/communication/communicator.h>
+#include <dlaf/communication/communicator_grid.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/types.h>
 
@@ -21,6 +24,12 @@ struct TridiagResult {
   Matrix<T, D> hh_reflectors;
 };
 
+template <class T, Device D>
+struct BandResult {
+  Matrix<T, D> band;
+  Matrix<T, D> hh_reflectors;
+};
+
 namespace internal {
 
 template <class T>
@@ -35,6 +44,23 @@ inline SizeType nrStepsForSweep(SizeType sweep, SizeType size, SizeType band) no
   return sweep == size - 2 ? 1 : util::ceilDiv(size - sweep - 2, band);
 }
 
+// Number of sweeps needed to reduce a band matrix of the given size to a band matrix with band size
+// band_out. Each sweep reduces band_out columns at once.
+inline SizeType nrSweepsBandToBand(SizeType size, SizeType band_out) noexcept {
+  return size - 1 <= band_out ? 0 : util::ceilDiv(size - 1 - band_out, band_out);
+}
+
+// First row of the block of HH reflectors of the given step of the band to band reduction sweep.
+inline SizeType firstRowBandToBand(SizeType sweep, SizeType step, SizeType band,
+                                   SizeType band_out) noexcept {
+  return (sweep + 1) * band_out + step * band;
+}
+
+inline SizeType nrStepsForSweepBandToBand(SizeType sweep, SizeType size, SizeType band,
+                                          SizeType band_out) noexcept {
+  return util::ceilDiv(size - 1 - firstRowBandToBand(sweep, 0, band, band_out), band);
+}
+
 template <Backend B, Device D, class T>
 struct BandToTridiag;
 
@@ -43,11 +69,25 @@ struct BandToTridiag<Backend::MC, D, T> {
   static TridiagResult<T, Device::CPU> call_L(const SizeType b, Matrix<const T, D>& mat_a) noexcept;
   static TridiagResult<T, Device::CPU> call_L(comm::CommunicatorGrid grid, const SizeType b,
                                               Matrix<const T, D>& mat_a) noexcept;
+  static TridiagResult<T, Device::CPU> call_L(comm::CommunicatorGrid grid,
+                                              common::Pipeline<comm::Communicator>& comm_bcast,
+                                              const SizeType b, Matrix<const T, D>& mat_a) noexcept;
+};
+
+template <Backend B, Device D, class T>
+struct BandToBand;
+
+template <Device D, class T>
+struct BandToBand<Backend::MC, D, T> {
+  static BandResult<T, Device::CPU> call_L(const SizeType b, const SizeType b_out,
+                                           Matrix<const T, D>& mat_a) noexcept;
 };
 
 // ETI
 #define DLAF_EIGENSOLVER_B2T_ETI(KWORD, BACKEND, DEVICE, DATATYPE) \
   KWORD template struct BandToTridiag<BACKEND, DEVICE, DATATYPE>;
+#define DLAF_EIGENSOLVER_B2B_ETI(KWORD, BACKEND, DEVICE, DATATYPE) \
+  KWORD template struct BandToBand<BACKEND, DEVICE, DATATYPE>;
 #define DLAF_EIGENSOLVER_B2T_DISTR_ETI(KWORD, BACKEND, DEVICE, DATATYPE) \
   KWORD template struct BandToTridiagDistr<BACKEND, DEVICE, DATATYPE>;
 
@@ -56,11 +96,21 @@ DLAF_EIGENSOLVER_B2T_ETI(extern, Backend::MC, Device::CPU, double)
 DLAF_EIGENSOLVER_B2T_ETI(extern, Backend::MC, Device::CPU, std::complex<float>)
 DLAF_EIGENSOLVER_B2T_ETI(extern, Backend::MC, Device::CPU, std::complex<double>)
 
+DLAF_EIGENSOLVER_B2B_ETI(extern, Backend::MC, Device::CPU, float)
+DLAF_EIGENSOLVER_B2B_ETI(extern, Backend::MC, Device::CPU, double)
+DLAF_EIGENSOLVER_B2B_ETI(extern, Backend::MC, Device::CPU, std::complex<float>)
+DLAF_EIGENSOLVER_B2B_ETI(extern, Backend::MC, Device::CPU, std::complex<double>)
+
 #ifdef DLAF_WITH_GPU
 DLAF_EIGENSOLVER_B2T_ETI(extern, Backend::MC, Device::GPU, float)
 DLAF_EIGENSOLVER_B2T_ETI(extern, Backend::MC, Device::GPU, double)
 DLAF_EIGENSOLVER_B2T_ETI(extern, Backend::MC, Device::GPU, std::complex<float>)
 DLAF_EIGENSOLVER_B2T_ETI(extern, Backend::MC, Device::GPU, std::complex<double>)
+
+DLAF_EIGENSOLVER_B2B_ETI(extern, Backend::MC, Device::GPU, float)
+DLAF_EIGENSOLVER_B2B_ETI(extern, Backend::MC, Device::GPU, double)
+DLAF_EIGENSOLVER_B2B_ETI(extern, Backend::MC, Device::GPU, std::complex<float>)
+DLAF_EIGENSOLVER_B2B_ETI(extern, Backend::MC, Device::GPU, std::complex<double>)
 #endif
 }
 }
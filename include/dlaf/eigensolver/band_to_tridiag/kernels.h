@@ -0,0 +1,282 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+#include <blas.hh>
+
+#include <dlaf/common/assert.h>
+#include <dlaf/common/single_threaded_blas.h>
+#include <dlaf/types.h>
+
+namespace dlaf::eigensolver::internal {
+
+// Kernels which apply a single Householder reflector H = I - tau v v^H to a block of the compact band
+// storage used by the bulge chasing (column major with leading dimension lda = 2b - 1).
+//
+// Two implementations are provided:
+// - applyHH*Blas: reference implementation based on BLAS-2 calls,
+// - applyHH*Fused: hand-written kernels which fuse the BLAS-2 operations in at most two passes over the
+//   block, where the inner loops are split in hh_simd_lanes<T> independent lanes, such that they can be
+//   mapped to SIMD registers by the compiler (reductions included, as no reassociation is needed).
+// The implementation used by the bulge chasing is selected at compile time with hh_use_fused_v<T>.
+
+#if defined(__AVX512F__)
+inline constexpr std::size_t hh_simd_bytes = 64;
+#else
+inline constexpr std::size_t hh_simd_bytes = 32;
+#endif
+
+template <class T>
+inline constexpr std::size_t hh_simd_lanes = hh_simd_bytes / sizeof(T) > 0 ? hh_simd_bytes / sizeof(T)
+                                                                           : 1;
+
+// The fused kernels are used for real types only, as std::complex arithmetic is not vectorized by the
+// compiler without relaxing the IEEE semantic (e.g. -fcx-limited-range).
+template <class T>
+inline constexpr bool hh_use_fused_v = std::is_floating_point_v<T>;
+
+namespace hh_kernels {
+
+// Returns sum_i conj(x_i) y_i.
+template <class T>
+T dot(const SizeType n, const T* x, const T* y) noexcept {
+  constexpr std::size_t nl = hh_simd_lanes<T>;
+
+  std::array<T, nl> acc{};
+  SizeType i = 0;
+  for (; i + static_cast<SizeType>(nl) <= n; i += static_cast<SizeType>(nl)) {
+    const T* x_i = x + i;
+    const T* y_i = y + i;
+    for (std::size_t l = 0; l < nl; ++l)
+      acc[l] += dlaf::conj(x_i[l]) * y_i[l];
+  }
+
+  T res{0};
+  for (; i < n; ++i)
+    res += dlaf::conj(x[i]) * y[i];
+  for (const auto& acc_l : acc)
+    res += acc_l;
+  return res;
+}
+
+// y_i += alpha * x_i and returns sum_i conj(z_i) x_i, in a single pass.
+template <class T>
+T axpyDot(const SizeType n, const T alpha, const T* x, T* y, const T* z) noexcept {
+  constexpr std::size_t nl = hh_simd_lanes<T>;
+
+  std::array<T, nl> acc{};
+  SizeType i = 0;
+  for (; i + static_cast<SizeType>(nl) <= n; i += static_cast<SizeType>(nl)) {
+    const T* x_i = x + i;
+    const T* z_i = z + i;
+    T* y_i = y + i;
+    for (std::size_t l = 0; l < nl; ++l) {
+      y_i[l] += alpha * x_i[l];
+      acc[l] += dlaf::conj(z_i[l]) * x_i[l];
+    }
+  }
+
+  T res{0};
+  for (; i < n; ++i) {
+    y[i] += alpha * x[i];
+    res += dlaf::conj(z[i]) * x[i];
+  }
+  for (const auto& acc_l : acc)
+    res += acc_l;
+  return res;
+}
+
+// y_i += alpha * x_i
+template <class T>
+void axpy(const SizeType n, const T alpha, const T* x, T* y) noexcept {
+  for (SizeType i = 0; i < n; ++i)
+    y[i] += alpha * x[i];
+}
+
+// y_i -= alpha1 * x1_i + alpha2 * x2_i
+template <class T>
+void axpy2(const SizeType n, const T alpha1, const T* x1, const T alpha2, const T* x2, T* y) noexcept {
+  for (SizeType i = 0; i < n; ++i)
+    y[i] -= alpha1 * x1[i] + alpha2 * x2[i];
+}
+
+}
+
+template <class T>
+void applyHHLeftRightHermBlas(const SizeType n, const T tau, const T* v, T* a, const SizeType lda,
+                              T* w) noexcept {
+  DLAF_ASSERT_HEAVY(n >= 0, n);
+
+  constexpr auto Lower = blas::Uplo::Lower;
+  constexpr auto ColMaj = blas::Layout::ColMajor;
+
+  common::internal::SingleThreadedBlasScope single;
+
+  blas::hemv(ColMaj, Lower, n, tau, a, lda, v, 1, 0., w, 1);
+
+  const T tmp = -blas::dot(n, w, 1, v, 1) * tau / BaseType<T>{2.};
+  blas::axpy(n, tmp, v, 1, w, 1);
+  blas::her2(ColMaj, Lower, n, -1., w, 1, v, 1, a, lda);
+}
+
+template <class T>
+void applyHHLeftBlas(const SizeType m, const SizeType n, const T tau, const T* v, T* a,
+                     const SizeType lda, T* w) noexcept {
+  DLAF_ASSERT_HEAVY(m >= 0, m);
+  DLAF_ASSERT_HEAVY(n >= 0, n);
+
+  constexpr auto ConjTrans = blas::Op::ConjTrans;
+  constexpr auto ColMaj = blas::Layout::ColMajor;
+
+  common::internal::SingleThreadedBlasScope single;
+
+  blas::gemv(ColMaj, ConjTrans, m, n, 1., a, lda, v, 1, 0., w, 1);
+  blas::ger(ColMaj, m, n, -dlaf::conj(tau), v, 1, w, 1, a, lda);
+}
+
+template <class T>
+void applyHHRightBlas(const SizeType m, const SizeType n, const T tau, const T* v, T* a,
+                      const SizeType lda, T* w) noexcept {
+  DLAF_ASSERT_HEAVY(m >= 0, m);
+  DLAF_ASSERT_HEAVY(n >= 0, n);
+
+  constexpr auto NoTrans = blas::Op::NoTrans;
+  constexpr auto ColMaj = blas::Layout::ColMajor;
+
+  common::internal::SingleThreadedBlasScope single;
+
+  blas::gemv(ColMaj, NoTrans, m, n, 1., a, lda, v, 1, 0., w, 1);
+  blas::ger(ColMaj, m, n, -tau, w, 1, v, 1, a, lda);
+}
+
+// Same as applyHHLeftRightHermBlas.
+// First pass: w = A v (the lower part of each column contributes to w with an axpy and to w_j with
+// a dot product), second pass: rank 2 update of the lower part of A.
+template <class T>
+void applyHHLeftRightHermFused(const SizeType n, const T tau, const T* v, T* a, const SizeType lda,
+                               T* w) noexcept {
+  DLAF_ASSERT_HEAVY(n >= 0, n);
+
+  std::fill(w, w + n, T{0});
+  for (SizeType j = 0; j < n; ++j) {
+    const T* a_j = a + j * lda;
+    const T w_j = hh_kernels::axpyDot(n - j - 1, v[j], a_j + j + 1, w + j + 1, v + j + 1);
+    w[j] += dlaf::conj(w_j) + std::real(a_j[j]) * v[j];
+  }
+
+  for (SizeType i = 0; i < n; ++i)
+    w[i] *= tau;
+  const T tmp = -hh_kernels::dot(n, w, v) * tau / BaseType<T>{2.};
+  hh_kernels::axpy(n, tmp, v, w);
+
+  for (SizeType j = 0; j < n; ++j) {
+    T* a_j = a + j * lda;
+    const T v_j = dlaf::conj(v[j]);
+    const T w_j = dlaf::conj(w[j]);
+    a_j[j] = std::real(a_j[j]) - 2 * std::real(w[j] * v_j);
+    hh_kernels::axpy2(n - j - 1, v_j, w + j + 1, w_j, v + j + 1, a_j + j + 1);
+  }
+}
+
+// Same as applyHHLeftBlas.
+// Each column is updated right after its projection on v is computed, i.e. while it is still in cache,
+// hence A is loaded from memory only once.
+template <class T>
+void applyHHLeftFused(const SizeType m, const SizeType n, const T tau, const T* v, T* a,
+                      const SizeType lda, T*) noexcept {
+  DLAF_ASSERT_HEAVY(m >= 0, m);
+  DLAF_ASSERT_HEAVY(n >= 0, n);
+
+  for (SizeType j = 0; j < n; ++j) {
+    T* a_j = a + j * lda;
+    const T w_j = hh_kernels::dot(m, a_j, v);
+    hh_kernels::axpy(m, -dlaf::conj(tau) * dlaf::conj(w_j), v, a_j);
+  }
+}
+
+// Same as applyHHRightBlas.
+// The columns are processed in groups of four in both passes to reduce the number of loads and stores
+// of w.
+template <class T>
+void applyHHRightFused(const SizeType m, const SizeType n, const T tau, const T* v, T* a,
+                       const SizeType lda, T* w) noexcept {
+  DLAF_ASSERT_HEAVY(m >= 0, m);
+  DLAF_ASSERT_HEAVY(n >= 0, n);
+
+  std::fill(w, w + m, T{0});
+  SizeType j = 0;
+  for (; j + 4 <= n; j += 4) {
+    const T* a0 = a + j * lda;
+    const T* a1 = a0 + lda;
+    const T* a2 = a1 + lda;
+    const T* a3 = a2 + lda;
+    const T v0 = v[j], v1 = v[j + 1], v2 = v[j + 2], v3 = v[j + 3];
+    for (SizeType i = 0; i < m; ++i)
+      w[i] += a0[i] * v0 + a1[i] * v1 + a2[i] * v2 + a3[i] * v3;
+  }
+  for (; j < n; ++j)
+    hh_kernels::axpy(m, v[j], a + j * lda, w);
+
+  for (SizeType i = 0; i < m; ++i)
+    w[i] *= tau;
+
+  for (j = 0; j + 4 <= n; j += 4) {
+    T* a0 = a + j * lda;
+    T* a1 = a0 + lda;
+    T* a2 = a1 + lda;
+    T* a3 = a2 + lda;
+    const T v0 = dlaf::conj(v[j]), v1 = dlaf::conj(v[j + 1]);
+    const T v2 = dlaf::conj(v[j + 2]), v3 = dlaf::conj(v[j + 3]);
+    for (SizeType i = 0; i < m; ++i) {
+      const T w_i = w[i];
+      a0[i] -= w_i * v0;
+      a1[i] -= w_i * v1;
+      a2[i] -= w_i * v2;
+      a3[i] -= w_i * v3;
+    }
+  }
+  for (; j < n; ++j)
+    hh_kernels::axpy(m, -dlaf::conj(v[j]), w, a + j * lda);
+}
+
+template <class T>
+void applyHHLeftRightHerm(const SizeType n, const T tau, const T* v, T* a, const SizeType lda,
+                          T* w) noexcept {
+  if constexpr (hh_use_fused_v<T>)
+    applyHHLeftRightHermFused(n, tau, v, a, lda, w);
+  else
+    applyHHLeftRightHermBlas(n, tau, v, a, lda, w);
+}
+
+template <class T>
+void applyHHLeft(const SizeType m, const SizeType n, const T tau, const T* v, T* a, const SizeType lda,
+                 T* w) noexcept {
+  if constexpr (hh_use_fused_v<T>)
+    applyHHLeftFused(m, n, tau, v, a, lda, w);
+  else
+    applyHHLeftBlas(m, n, tau, v, a, lda, w);
+}
+
+template <class T>
+void applyHHRight(const SizeType m, const SizeType n, const T tau, const T* v, T* a, const SizeType lda,
+                  T* w) noexcept {
+  if constexpr (hh_use_fused_v<T>)
+    applyHHRightFused(m, n, tau, v, a, lda, w);
+  else
+    applyHHRightBlas(m, n, tau, v, a, lda, w);
+}
+
+}
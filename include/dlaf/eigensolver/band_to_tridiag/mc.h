@@ -10,6 +10,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
 #include <pika/future.hpp>
 
 #include <dlaf/blas/tile.h>
@@ -22,6 +27,7 @@
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/communication/kernels.h>
 #include <dlaf/eigensolver/band_to_tridiag/api.h>
+#include <dlaf/eigensolver/band_to_tridiag/kernels.h>
 #include <dlaf/eigensolver/internal/get_1d_block_size.h>
 #include <dlaf/lapack/gpu/lacpy.h>
 #include <dlaf/lapack/gpu/laset.h>
@@ -32,6 +38,7 @@
 #include <dlaf/sender/traits.h>
 #include <dlaf/sender/transform_mpi.h>
 #include <dlaf/traits.h>
+#include <dlaf/tune.h>
 
 #ifdef DLAF_WITH_GPU
 #include <whip.hpp>
@@ -55,53 +62,6 @@ void HHReflector(const SizeType n, T& tau, T* v, T* vec) noexcept {
   std::fill(vec + 1, vec + n, T{});
 }
 
-template <class T>
-void applyHHLeftRightHerm(const SizeType n, const T tau, const T* v, T* a, const SizeType lda,
-                          T* w) noexcept {
-  DLAF_ASSERT_HEAVY(n >= 0, n);
-
-  constexpr auto Lower = blas::Uplo::Lower;
-  constexpr auto ColMaj = blas::Layout::ColMajor;
-
-  common::internal::SingleThreadedBlasScope single;
-
-  blas::hemv(ColMaj, Lower, n, tau, a, lda, v, 1, 0., w, 1);
-
-  const T tmp = -blas::dot(n, w, 1, v, 1) * tau / BaseType<T>{2.};
-  blas::axpy(n, tmp, v, 1, w, 1);
-  blas::her2(ColMaj, Lower, n, -1., w, 1, v, 1, a, lda);
-}
-
-template <class T>
-void applyHHLeft(const SizeType m, const SizeType n, const T tau, const T* v, T* a, const SizeType lda,
-                 T* w) noexcept {
-  DLAF_ASSERT_HEAVY(m >= 0, m);
-  DLAF_ASSERT_HEAVY(n >= 0, n);
-
-  constexpr auto ConjTrans = blas::Op::ConjTrans;
-  constexpr auto ColMaj = blas::Layout::ColMajor;
-
-  common::internal::SingleThreadedBlasScope single;
-
-  blas::gemv(ColMaj, ConjTrans, m, n, 1., a, lda, v, 1, 0., w, 1);
-  blas::ger(ColMaj, m, n, -dlaf::conj(tau), v, 1, w, 1, a, lda);
-}
-
-template <class T>
-void applyHHRight(const SizeType m, const SizeType n, const T tau, const T* v, T* a, const SizeType lda,
-                  T* w) noexcept {
-  DLAF_ASSERT_HEAVY(m >= 0, m);
-  DLAF_ASSERT_HEAVY(n >= 0, n);
-
-  constexpr auto NoTrans = blas::Op::NoTrans;
-  constexpr auto ColMaj = blas::Layout::ColMajor;
-
-  common::internal::SingleThreadedBlasScope single;
-
-  blas::gemv(ColMaj, NoTrans, m, n, 1., a, lda, v, 1, 0., w, 1);
-  blas::ger(ColMaj, m, n, -tau, w, 1, v, 1, a, lda);
-}
-
 // As the compact band matrix is stored in a circular buffer it might happen that the operations
 // have to act on a matrix which lays on the last columns and first columns of the buffer.
 // The following versions take care of this case.
@@ -718,25 +678,6 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
     }
   }
 
-  // Maximum size / (2b-1) sweeps can be executed in parallel, however due to task combination it reduces
-  // to size / (2nb-1).
-  const auto max_workers =
-      std::min(ceilDiv(size, 2 * nb - 1), 2 * to_SizeType(get_num_threads("default")));
-
-  vector<Pipeline<SweepWorker<T>>> workers;
-  workers.reserve(max_workers);
-  for (SizeType i = 0; i < max_workers; ++i)
-    workers.emplace_back(SweepWorker<T>(size, b));
-
-  auto init_sweep = [a_ws](SizeType sweep, SweepWorker<T>& worker) { worker.startSweep(sweep, *a_ws); };
-  auto cont_sweep = [a_ws, b](SizeType nr_steps, SweepWorker<T>& worker,
-                              matrix::Tile<T, Device::CPU>&& tile_v, TileElementIndex index) {
-    for (SizeType j = 0; j < nr_steps; ++j) {
-      worker.compactCopyToTile(tile_v, index + TileElementSize(j * b, 0));
-      worker.doStep(*a_ws);
-    }
-  };
-
   auto policy_hp = dlaf::internal::Policy<Backend::MC>(pika::execution::thread_priority::high);
   auto copy_tridiag = [policy_hp, a_ws, &mat_trid](SizeType sweep, auto&& dep) {
     auto copy_tridiag_task = [a_ws](SizeType start, SizeType n_d, SizeType n_e, auto tile_t) {
@@ -767,25 +708,474 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
 
   const SizeType steps_per_task = nb / b;
   const SizeType sweeps = nrSweeps<T>(size);
+  const SizeType sweeps_per_task = getTuneParameters().band_to_tridiag_sweeps_per_task;
+  const auto nthreads = to_SizeType(get_num_threads("default"));
+
+  if (sweeps_per_task <= 1) {
+    // Maximum size / (2b-1) sweeps can be executed in parallel, however due to task combination it
+    // reduces to size / (2nb-1).
+    const auto max_workers = std::min(ceilDiv(size, 2 * nb - 1), 2 * nthreads);
+
+    vector<Pipeline<SweepWorker<T>>> workers;
+    workers.reserve(max_workers);
+    for (SizeType i = 0; i < max_workers; ++i)
+      workers.emplace_back(SweepWorker<T>(size, b));
+
+    auto init_sweep = [a_ws](SizeType sweep, SweepWorker<T>& worker) {
+      worker.startSweep(sweep, *a_ws);
+    };
+    auto cont_sweep = [a_ws, b](SizeType nr_steps, SweepWorker<T>& worker,
+                                matrix::Tile<T, Device::CPU>&& tile_v, TileElementIndex index) {
+      for (SizeType j = 0; j < nr_steps; ++j) {
+        worker.compactCopyToTile(tile_v, index + TileElementSize(j * b, 0));
+        worker.doStep(*a_ws);
+      }
+    };
+
+    for (SizeType sweep = 0, last_dep = deps.size() - 1; sweep < sweeps; ++sweep) {
+      auto& w_pipeline = workers[sweep % max_workers];
+
+      auto dep = dlaf::internal::whenAllLift(sweep, w_pipeline(), deps[0]) |
+                 dlaf::internal::transform(policy_hp, init_sweep);
+      copy_tridiag(sweep, std::move(dep));
+
+      const SizeType steps = nrStepsForSweep(sweep, size, b);
+
+      SizeType last_dep_new = 0;
+      for (SizeType step = 0; step < steps;) {
+        // First task might apply less steps to align with the boundaries of the HHR tile v.
+        SizeType nr_steps = steps_per_task - (step == 0 ? (sweep % nb) / b : 0);
+        // Last task only applies the remaining steps
+        nr_steps = std::min(nr_steps, steps - step);
+
+        auto dep_index = std::min(ceilDiv(step + nr_steps, nb / b), last_dep);
+
+        const GlobalElementIndex index_v((sweep / b + step) * b, sweep);
+
+        SizeType set_index = ceilDiv(step, nb / b);
+
+        deps[set_index] =
+            dlaf::internal::whenAllLift(nr_steps, w_pipeline(),
+                                        mat_v.readwrite(dist_v.globalTileIndex(index_v)),
+                                        dist_v.tileElementIndex(index_v), deps[dep_index]) |
+            dlaf::internal::transform(policy_hp, cont_sweep) | ex::split();
+
+        last_dep_new = set_index;
+        step += nr_steps;
+      }
+
+      // Limit next sweep to only use valid senders from this sweep.
+      last_dep = last_dep_new;
+    }
+  }
+  else {
+    // Multi-sweep mode: the sweeps are grouped in groups of sweeps_per_task consecutive sweeps.
+    // The tasks of each sweep are the same as above, but the tasks of the sweeps of a group are
+    // combined in a time-skewed order: the w-th task of the group (wave w) applies the (w-i)-th task
+    // of the i-th sweep of the group, for i = 0, 1, ..., in this order.
+    // This order is valid as the k-th task of a sweep depends only on the (k+1)-th task of the previous
+    // sweep (which belongs to the same wave), and it keeps the working set of a wave (the band columns
+    // touched by the tasks of the wave) in cache, while it is used by all the sweeps of the group.
+    // Only the first sweep of the group depends on tasks of another group (the last sweep of the
+    // previous group).
+    struct SweepTask {
+      SizeType nr_steps;
+      GlobalElementIndex index_v;
+      SizeType dep_index;
+    };
+    struct WaveStep {
+      SizeType worker;
+      SizeType sweep;
+      bool init;
+      SizeType nr_steps;
+      std::size_t tile_v;
+      TileElementIndex index_v;
+    };
+    using TileSender = decltype(mat_v.readwrite(std::declval<GlobalTileIndex>()));
+
+    const SizeType max_workers =
+        std::min(ceilDiv(size, sweeps_per_task * (2 * nb - 1)), 2 * nthreads);
+
+    vector<Pipeline<std::vector<SweepWorker<T>>>> workers;
+    workers.reserve(max_workers);
+    for (SizeType i = 0; i < max_workers; ++i) {
+      std::vector<SweepWorker<T>> group_workers;
+      group_workers.reserve(to_sizet(sweeps_per_task));
+      for (SizeType j = 0; j < sweeps_per_task; ++j)
+        group_workers.emplace_back(size, b);
+      workers.emplace_back(std::move(group_workers));
+    }
+
+    auto wave = [a_ws, b](const std::vector<WaveStep>& wave_steps,
+                          std::vector<SweepWorker<T>>& group_workers, auto&& tiles_v) {
+      for (const auto& wave_step : wave_steps) {
+        auto& worker = group_workers[to_sizet(wave_step.worker)];
+        auto& tile_v = tiles_v[wave_step.tile_v].get();
+
+        if (wave_step.init)
+          worker.startSweep(wave_step.sweep, *a_ws);
+        for (SizeType j = 0; j < wave_step.nr_steps; ++j) {
+          worker.compactCopyToTile(tile_v, wave_step.index_v + TileElementSize(j * b, 0));
+          worker.doStep(*a_ws);
+        }
+      }
+    };
+
+    // Senders of the tasks of the last sweep of the previous group (initially the copy of the band).
+    auto deps_prev = std::move(deps);
+
+    for (SizeType sweep_0 = 0; sweep_0 < sweeps; sweep_0 += sweeps_per_task) {
+      const SizeType group_size = std::min(sweeps_per_task, sweeps - sweep_0);
+      auto& w_pipeline = workers[(sweep_0 / sweeps_per_task) % max_workers];
+
+      // Tasks of each sweep of the group.
+      vector<vector<SweepTask>> tasks(group_size);
+      SizeType nr_waves = 0;
+      for (SizeType i = 0; i < group_size; ++i) {
+        const SizeType sweep = sweep_0 + i;
+        const SizeType steps = nrStepsForSweep(sweep, size, b);
+        const SizeType last_dep = (i == 0 ? deps_prev.size() : tasks[i - 1].size()) - 1;
+
+        for (SizeType step = 0; step < steps;) {
+          // First task might apply less steps to align with the boundaries of the HHR tile v.
+          SizeType nr_steps = steps_per_task - (step == 0 ? (sweep % nb) / b : 0);
+          // Last task only applies the remaining steps
+          nr_steps = std::min(nr_steps, steps - step);
+
+          tasks[i].push_back({nr_steps, GlobalElementIndex((sweep / b + step) * b, sweep),
+                              std::min(ceilDiv(step + nr_steps, nb / b), last_dep)});
+          step += nr_steps;
+        }
+        nr_waves = std::max(nr_waves, tasks[i].size() + i);
+      }
+
+      vector<vector<ex::any_sender<>>> deps_group(group_size);
+      for (SizeType i = 0; i < group_size; ++i)
+        deps_group[i].resize(tasks[i].size());
+
+      for (SizeType w = 0; w < nr_waves; ++w) {
+        std::vector<WaveStep> wave_steps;
+        std::vector<GlobalTileIndex> tiles_v_index;
+        std::vector<ex::any_sender<>> wave_deps;
+
+        for (SizeType i = 0; i < group_size; ++i) {
+          const SizeType k = w - i;
+          if (k < 0 || k >= tasks[i].size())
+            continue;
+          const auto& task = tasks[i][k];
+
+          const auto tile_index = dist_v.globalTileIndex(task.index_v);
+          auto it = std::find(tiles_v_index.begin(), tiles_v_index.end(), tile_index);
+          if (it == tiles_v_index.end())
+            it = tiles_v_index.insert(it, tile_index);
+
+          wave_steps.push_back({i, sweep_0 + i, k == 0, task.nr_steps,
+                                to_sizet(std::distance(tiles_v_index.begin(), it)),
+                                dist_v.tileElementIndex(task.index_v)});
+
+          if (i == 0) {
+            if (k == 0)
+              wave_deps.push_back(deps_prev[0]);
+            wave_deps.push_back(deps_prev[task.dep_index]);
+          }
+        }
+
+        std::vector<TileSender> tiles_v;
+        tiles_v.reserve(tiles_v_index.size());
+        for (const auto& tile_index : tiles_v_index)
+          tiles_v.push_back(mat_v.readwrite(tile_index));
+
+        auto wave_done = dlaf::internal::whenAllLift(std::move(wave_steps), w_pipeline(),
+                                                     ex::when_all_vector(std::move(tiles_v)),
+                                                     ex::when_all_vector(std::move(wave_deps))) |
+                         dlaf::internal::transform(policy_hp, wave) | ex::split();
+
+        for (SizeType i = 0; i < group_size; ++i) {
+          const SizeType k = w - i;
+          if (k < 0 || k >= tasks[i].size())
+            continue;
+          if (k == 0)
+            copy_tridiag(sweep_0 + i, wave_done);
+          deps_group[i][k] = wave_done;
+        }
+        // The sender of the last waves might not be used by any other task.
+        ex::start_detached(std::move(wave_done));
+      }
+
+      deps_prev = std::move(deps_group[group_size - 1]);
+    }
+
+    deps = std::move(deps_prev);
+  }
+
+  // copy the last elements of the diagonals
+  if (!isComplex_v<T>) {
+    // only needed for real types as they don't perform sweep size-2
+    copy_tridiag(size - 2, deps[0]);
+  }
+  copy_tridiag(size - 1, std::move(deps[0]));
+
+  return {std::move(mat_trid), std::move(mat_v)};
+}
+
+// Worker of the band to band reduction (see BandToBand::call_L).
+// Sweep s reduces the columns [s * band_out, (s + 1) * band_out) of the band matrix, and each of its
+// steps is the blocked counterpart of SweepWorker::doStep, where the single HH reflector is replaced by
+// a block of (up to) band_out HH reflectors applied with BLAS-3 kernels.
+template <class T>
+class BandToBandWorker {
+public:
+  BandToBandWorker(SizeType size, SizeType band_size, SizeType band_size_out)
+      : size_(size), band_size_(band_size), band_size_out_(band_size_out),
+        taus_(band_size_out), v_(band_size * band_size_out), t_(band_size_out * band_size_out),
+        w_(band_size * band_size), x_(band_size * band_size_out) {}
+
+  BandToBandWorker(const BandToBandWorker&) = delete;
+  BandToBandWorker(BandToBandWorker&&) = default;
+
+  BandToBandWorker& operator=(const BandToBandWorker&) = delete;
+  BandToBandWorker& operator=(BandToBandWorker&&) = default;
+
+  void startSweep(SizeType sweep, BandBlock<T>& a) noexcept {
+    sweep_ = sweep;
+    step_ = 0;
+
+    const SizeType j = firstRowHHR();
+    computeReflectors(sizeHHR(), a.ptr(band_size_out_, j - band_size_out_), a.ld());
+  }
+
+  // Copies the block of HH reflectors in compact form (the taus replace the unit diagonal).
+  void compactCopyToTile(matrix::Tile<T, Device::CPU>& tile_v, TileElementIndex index) const noexcept {
+    common::internal::SingleThreadedBlasScope single;
+
+    const SizeType m = sizeHHR();
+    lapack::lacpy(blas::Uplo::Lower, m, k_, v(), ldv(), tile_v.ptr(index), tile_v.ld());
+    for (SizeType i = 0; i < k_; ++i)
+      tile_v(index + TileElementSize(i, i)) = *taus_(i);
+  }
+
+  void doStep(BandBlock<T>& a) noexcept {
+    constexpr auto ColMaj = blas::Layout::ColMajor;
+    constexpr auto Left = blas::Side::Left;
+    constexpr auto Right = blas::Side::Right;
+    constexpr auto Lower = blas::Uplo::Lower;
+    constexpr auto Upper = blas::Uplo::Upper;
+    constexpr auto NoTrans = blas::Op::NoTrans;
+    constexpr auto ConjTrans = blas::Op::ConjTrans;
+    constexpr auto NonUnit = blas::Diag::NonUnit;
+
+    const SizeType j = firstRowHHR();
+    const SizeType n = sizeHHR();  // size diagonal tile and width off-diag tile
+    const SizeType m = std::min(band_size_, size_ - band_size_ - j);  // height off diagonal tile
+    const SizeType k = k_;
+
+    T* a_diag = a.ptr(0, j);
+    T* a_offdiag = a.ptr(n, j);
+
+    {
+      common::internal::SingleThreadedBlasScope single;
+
+      // Two-sided application on the diagonal tile: A = A - V X* - X V*, where
+      // X = W - 1/2 V T* V* W and W = A V T.
+      blas::hemm(ColMaj, Left, Lower, n, k, T(1), a_diag, a.ld(), v(), ldv(), T(0), w(), n);
+      blas::trmm(ColMaj, Right, Upper, NoTrans, NonUnit, n, k, T(1), t(), ldt(), w(), n);
+      blas::gemm(ColMaj, ConjTrans, NoTrans, k, k, n, T(1), v(), ldv(), w(), n, T(0), x(), k);
+      blas::trmm(ColMaj, Left, Upper, ConjTrans, NonUnit, k, k, T(1), t(), ldt(), x(), k);
+      blas::gemm(ColMaj, NoTrans, NoTrans, n, k, k, T(-0.5), v(), ldv(), x(), k, T(1), w(), n);
+      blas::her2k(ColMaj, Lower, NoTrans, n, k, T(-1), v(), ldv(), w(), n, BaseType<T>(1), a_diag,
+                  a.ld());
+
+      // Right application on the off diagonal tile: B = B - B V T V*.
+      if (m > 0) {
+        blas::gemm(ColMaj, NoTrans, NoTrans, m, k, n, T(1), a_offdiag, a.ld(), v(), ldv(), T(0), w(),
+                   m);
+        blas::trmm(ColMaj, Right, Upper, NoTrans, NonUnit, m, k, T(1), t(), ldt(), w(), m);
+        blas::gemm(ColMaj, NoTrans, ConjTrans, m, n, k, T(-1), w(), m, v(), ldv(), T(1), a_offdiag,
+                   a.ld());
+      }
+    }
+
+    // The first band_out columns of the bulge are annihilated and the remaining columns of the off
+    // diagonal tile are updated from the left. (The rest of the bulge is removed by the next sweeps.)
+    if (m > 1) {
+      computeReflectors(m, a_offdiag, a.ld());
+
+      common::internal::SingleThreadedBlasScope single;
+
+      const SizeType nc = n - band_size_out_;
+      T* a_right = a_offdiag + band_size_out_ * a.ld();
+      blas::gemm(ColMaj, ConjTrans, NoTrans, k_, nc, m, T(1), v(), ldv(), a_right, a.ld(), T(0), w(),
+                 k_);
+      blas::trmm(ColMaj, Left, Upper, ConjTrans, NonUnit, k_, nc, T(1), t(), ldt(), w(), k_);
+      blas::gemm(ColMaj, NoTrans, NoTrans, m, nc, k_, T(-1), v(), ldv(), w(), k_, T(1), a_right,
+                 a.ld());
+    }
+    step_ += 1;
+    // Note: the sweep is completed if m <= 1.
+  }
+
+private:
+  // Computes the QR factorization of the m x band_out matrix a, storing the HH reflectors V and their
+  // T factor in the worker and leaving only R in a.
+  void computeReflectors(const SizeType m, T* a, const SizeType lda) noexcept {
+    DLAF_ASSERT_HEAVY(m > 0, m);
+
+    using namespace lapack;
+
+    common::internal::SingleThreadedBlasScope single;
+
+    k_ = std::min(m, band_size_out_);
+    geqrf(m, band_size_out_, a, lda, taus_());
+
+    lacpy(blas::Uplo::Lower, m, k_, a, lda, v(), ldv());
+    laset(blas::Uplo::Upper, m, k_, T(0), T(1), v(), ldv());
+    if (m > 1)
+      laset(blas::Uplo::Lower, m - 1, k_, T(0), T(0), a + 1, lda);
+
+    larft(Direction::Forward, StoreV::Columnwise, m, k_, v(), ldv(), taus_(), t(), ldt());
+  }
+
+  SizeType firstRowHHR() const noexcept {
+    return firstRowBandToBand(sweep_, step_, band_size_, band_size_out_);
+  }
+
+  SizeType sizeHHR() const noexcept {
+    return std::min(band_size_, size_ - firstRowHHR());
+  }
+
+  T* v() noexcept {
+    return v_();
+  }
+  const T* v() const noexcept {
+    return v_();
+  }
+  SizeType ldv() const noexcept {
+    return band_size_;
+  }
+
+  T* t() noexcept {
+    return t_();
+  }
+  SizeType ldt() const noexcept {
+    return band_size_out_;
+  }
+
+  T* w() noexcept {
+    return w_();
+  }
+  T* x() noexcept {
+    return x_();
+  }
+
+  SizeType size_;
+  SizeType band_size_;
+  SizeType band_size_out_;
+  SizeType sweep_ = 0;
+  SizeType step_ = 0;
+  SizeType k_ = 0;
+  memory::MemoryView<T, Device::CPU> taus_;
+  memory::MemoryView<T, Device::CPU> v_;
+  memory::MemoryView<T, Device::CPU> t_;
+  memory::MemoryView<T, Device::CPU> w_;
+  memory::MemoryView<T, Device::CPU> x_;
+};
+
+template <Device D, class T>
+BandResult<T, Device::CPU> BandToBand<Backend::MC, D, T>::call_L(const SizeType b, const SizeType b_out,
+                                                                 Matrix<const T, D>& mat_a) noexcept {
+  // Note on the algorithm and dependency tracking:
+  // The algorithm has the same structure of the one of bandToTridiag (see BandToTridiag::call_L),
+  // where the i-th sweep acts on the band_out columns [i * b_out, (i + 1) * b_out) instead of a single
+  // column, and the single HH reflectors are replaced by blocks of b_out HH reflectors.
+  // The j-th step of sweep i acts on the columns [i' + 1 + j * b, i' + 1 + (j + 1) * b), where
+  // i' = (i + 1) * b_out - 1, i.e. on the same columns of step j of sweep i' of bandToTridiag.
+  // Therefore the same dependency tracking is used.
+
+  using common::Pipeline;
+  using common::internal::vector;
+  using util::ceilDiv;
+
+  using pika::resource::get_num_threads;
+
+  namespace ex = pika::execution::experimental;
+
+  // note: A is square and has square blocksize
+  const SizeType size = mat_a.size().cols();
+  const SizeType nrtiles = mat_a.nrTiles().cols();
+  const SizeType nb = mat_a.blockSize().cols();
+
+  // Need share pointer to keep the allocation until all the tasks are executed.
+  auto a_ws = std::make_shared<BandBlock<T>>(size, b);
+
+  Matrix<T, Device::CPU> mat_band({size, size}, {nb, nb});
+  Matrix<T, Device::CPU> mat_v({size, size}, {nb, nb});
+  const auto& dist_v = mat_v.distribution();
+
+  if (size == 0) {
+    return {std::move(mat_band), std::move(mat_v)};
+  }
+
+  const auto max_deps_size = nrtiles;
+  vector<ex::any_sender<>> deps;
+  deps.reserve(max_deps_size);
+
+  // Copy the band matrix
+  for (SizeType k = 0; k < nrtiles; ++k) {
+    auto sf = a_ws->template copyDiag<D>(k * nb, mat_a.read(GlobalTileIndex{k, k})) | ex::split();
+    if (k < nrtiles - 1) {
+      auto sf2 = a_ws->template copyOffDiag<D>(
+                     k * nb, ex::when_all(std::move(sf), mat_a.read(GlobalTileIndex{k + 1, k}))) |
+                 ex::split();
+      deps.push_back(std::move(sf2));
+    }
+    else {
+      deps.push_back(sf);
+    }
+  }
+
+  const auto max_workers =
+      std::min(ceilDiv(size, 2 * nb - 1), 2 * to_SizeType(get_num_threads("default")));
+
+  vector<Pipeline<BandToBandWorker<T>>> workers;
+  workers.reserve(max_workers);
+  for (SizeType i = 0; i < max_workers; ++i)
+    workers.emplace_back(BandToBandWorker<T>(size, b, b_out));
+
+  auto init_sweep = [a_ws](SizeType sweep, BandToBandWorker<T>& worker) {
+    worker.startSweep(sweep, *a_ws);
+  };
+  auto cont_sweep = [a_ws, b](SizeType nr_steps, BandToBandWorker<T>& worker,
+                              matrix::Tile<T, Device::CPU>&& tile_v, TileElementIndex index) {
+    for (SizeType j = 0; j < nr_steps; ++j) {
+      worker.compactCopyToTile(tile_v, index + TileElementSize(j * b, 0));
+      worker.doStep(*a_ws);
+    }
+  };
+
+  auto policy_hp = dlaf::internal::Policy<Backend::MC>(pika::execution::thread_priority::high);
+
+  const SizeType steps_per_task = nb / b;
+  const SizeType sweeps = nrSweepsBandToBand(size, b_out);
   for (SizeType sweep = 0, last_dep = deps.size() - 1; sweep < sweeps; ++sweep) {
     auto& w_pipeline = workers[sweep % max_workers];
+    // Index of the equivalent sweep of bandToTridiag.
+    const SizeType sweep_b2t = firstRowBandToBand(sweep, 0, b, b_out) - 1;
 
-    auto dep = dlaf::internal::whenAllLift(sweep, w_pipeline(), deps[0]) |
-               dlaf::internal::transform(policy_hp, init_sweep);
-    copy_tridiag(sweep, std::move(dep));
+    ex::start_detached(dlaf::internal::whenAllLift(sweep, w_pipeline(), deps[0]) |
+                       dlaf::internal::transform(policy_hp, init_sweep));
 
-    const SizeType steps = nrStepsForSweep(sweep, size, b);
+    const SizeType steps = nrStepsForSweepBandToBand(sweep, size, b, b_out);
 
     SizeType last_dep_new = 0;
     for (SizeType step = 0; step < steps;) {
       // First task might apply less steps to align with the boundaries of the HHR tile v.
-      SizeType nr_steps = steps_per_task - (step == 0 ? (sweep % nb) / b : 0);
+      SizeType nr_steps = steps_per_task - (step == 0 ? (sweep_b2t % nb) / b : 0);
       // Last task only applies the remaining steps
       nr_steps = std::min(nr_steps, steps - step);
 
       auto dep_index = std::min(ceilDiv(step + nr_steps, nb / b), last_dep);
 
-      const GlobalElementIndex index_v((sweep / b + step) * b, sweep);
+      const GlobalElementIndex index_v((sweep_b2t / b + step) * b, sweep * b_out);
 
       SizeType set_index = ceilDiv(step, nb / b);
 
@@ -802,14 +1192,53 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
     last_dep = last_dep_new;
   }
 
-  // copy the last elements of the diagonals
-  if (!isComplex_v<T>) {
-    // only needed for real types as they don't perform sweep size-2
-    copy_tridiag(size - 2, deps[0]);
+  // Copy the resulting band matrix when all the sweeps are completed.
+  // Note: all the tasks of the sweeps are serialized by the worker pipelines.
+  vector<ex::unique_any_sender<>> workers_done;
+  workers_done.reserve(max_workers);
+  for (auto& w_pipeline : workers)
+    workers_done.push_back(w_pipeline() | ex::drop_value());
+  auto sweeps_done = ex::when_all(ex::when_all_vector(std::move(deps)),
+                                  ex::when_all_vector(std::move(workers_done))) |
+                     ex::split();
+
+  // The elements of column j of the band are copied in the diagonal tile, and the elements that exceed
+  // the diagonal tile in the tile below.
+  auto copy_diag_out = [a_ws, b_out, nb](SizeType k, const matrix::Tile<T, Device::CPU>& tile) {
+    common::internal::SingleThreadedBlasScope single;
+
+    lapack::laset(blas::Uplo::General, tile.size().rows(), tile.size().cols(), T(0), T(0), tile.ptr(),
+                  tile.ld());
+    for (SizeType j = 0; j < tile.size().cols(); ++j) {
+      const SizeType nr = std::min(b_out + 1, tile.size().rows() - j);
+      blas::copy(nr, a_ws->ptr(0, k * nb + j), 1, tile.ptr({j, j}), 1);
+    }
+  };
+  auto copy_offdiag_out = [a_ws, b_out, nb](SizeType k, const matrix::Tile<T, Device::CPU>& tile) {
+    common::internal::SingleThreadedBlasScope single;
+
+    lapack::laset(blas::Uplo::General, tile.size().rows(), tile.size().cols(), T(0), T(0), tile.ptr(),
+                  tile.ld());
+    for (SizeType j = 0; j < tile.size().cols(); ++j) {
+      const SizeType offset = nb - j;
+      const SizeType nr = std::min(b_out + 1 - offset, tile.size().rows());
+      if (nr > 0)
+        blas::copy(nr, a_ws->ptr(offset, k * nb + j), 1, tile.ptr({0, j}), 1);
+    }
+  };
+
+  for (SizeType k = 0; k < nrtiles; ++k) {
+    ex::start_detached(
+        dlaf::internal::whenAllLift(k, mat_band.readwrite(GlobalTileIndex{k, k}), sweeps_done) |
+        dlaf::internal::transform(policy_hp, copy_diag_out));
+    if (k < nrtiles - 1) {
+      ex::start_detached(
+          dlaf::internal::whenAllLift(k, mat_band.readwrite(GlobalTileIndex{k + 1, k}), sweeps_done) |
+          dlaf::internal::transform(policy_hp, copy_offdiag_out));
+    }
   }
-  copy_tridiag(size - 1, std::move(deps[0]));
 
-  return {std::move(mat_trid), std::move(mat_v)};
+  return {std::move(mat_band), std::move(mat_v)};
 }
 
 struct VAccessHelper {
@@ -967,6 +1396,16 @@ private:
 template <Device D, class T>
 TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
     comm::CommunicatorGrid grid, const SizeType b, Matrix<const T, D>& mat_a) noexcept {
+  // Need a pipeline of comm for broadcasts.
+  common::Pipeline<comm::Communicator> comm_bcast(grid.fullCommunicator().clone());
+
+  return call_L(grid, comm_bcast, b, mat_a);
+}
+
+template <Device D, class T>
+TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
+    comm::CommunicatorGrid grid, common::Pipeline<comm::Communicator>& comm_bcast, const SizeType b,
+    Matrix<const T, D>& mat_a) noexcept {
   // Note on the algorithm, data distribution and dependency tracking:
   // The band matrix is redistribuited in 1D block cyclic. The new block size is a multiple of the
   // block_size of mat_a. As sweeps are performed the matrix is shifted one column to the left (The
@@ -1025,16 +1464,16 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
     return {std::move(mat_trid), std::move(mat_v)};
   }
 
+  // Note: the communicator used for the p2p communications (matched via tags) is cloned for each call,
+  // since messages of different calls could be matched by mistake if it was shared.
   auto comm = ex::just(grid.fullCommunicator().clone());
-  // Need a pipeline of comm for broadcasts.
-  common::Pipeline<comm::Communicator> comm_bcast(grid.fullCommunicator().clone());
 
   const auto rank = grid.rankFullCommunicator(grid.rank());
   const auto ranks = static_cast<comm::IndexT_MPI>(grid.size().linear_size());
   const auto prev_rank = (rank == 0 ? ranks - 1 : rank - 1);
   const auto next_rank = (rank + 1 == ranks ? 0 : rank + 1);
 
-  const SizeType nb_band = get1DBlockSize(nb);
+  const SizeType nb_band = get1DBlockSize(nb, size, ranks);
   const SizeType tiles_per_block = nb_band / nb;
   matrix::Distribution dist({1, size}, {1, nb_band}, {1, ranks}, {0, rank}, {0, 0});
 
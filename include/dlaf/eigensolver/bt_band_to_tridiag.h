@@ -69,6 +69,47 @@ void backTransformationBandToTridiag(const SizeType band_size, matrix::Matrix<T,
   internal::BackTransformationT2B<B, D, T>::call(band_size, mat_e, mat_hh);
 }
 
+// Eigenvalue back-transformation implementation on local memory, which applies the inverse of the
+// transformation used to reduce a band matrix to a band matrix with a smaller band size
+// (see bandToBand).
+//
+// It computes E -= V T V* E for each block of reflectors (in reverse order), where V and T are
+// obtained from the compact representation of the blocks of reflectors and their taus in @p mat_hh
+// described in the bandToBand documentation.
+//
+// @param mat_hh matrix containing the blocks of reflectors together with taus
+// @param mat_e matrix to which the inverse transformation is applied to
+// @param band_size band size of the original band matrix
+// @param band_size_out band size of the reduced band matrix
+// @pre mat_hh has a square size
+// @pre mat_hh has a square block size
+// @pre mat_e and mat_hh share the same number of rows
+// @pre mat_e block size and mat_hh block size share the same number of rows
+// @pre band_size is a divisor of mat_hh.blockSize().cols()
+// @pre band_size_out is a divisor of band_size, band_size_out < band_size and band_size_out >= 2
+// @pre mat_e is not distributed
+// @pre mat_hh is not distributed
+template <Backend B, Device D, class T>
+void backTransformationBandToBand(const SizeType band_size, const SizeType band_size_out,
+                                  matrix::Matrix<T, D>& mat_e,
+                                  matrix::Matrix<const T, Device::CPU>& mat_hh) {
+  DLAF_ASSERT(matrix::local_matrix(mat_e), mat_e);
+  DLAF_ASSERT(matrix::local_matrix(mat_hh), mat_hh);
+
+  DLAF_ASSERT(matrix::square_size(mat_hh), mat_hh);
+  DLAF_ASSERT(matrix::square_blocksize(mat_hh), mat_hh);
+
+  DLAF_ASSERT(mat_hh.size().rows() == mat_e.size().rows(), mat_hh, mat_e);
+  DLAF_ASSERT(mat_hh.blockSize().rows() == mat_e.blockSize().rows(), mat_hh, mat_e);
+
+  DLAF_ASSERT(mat_hh.blockSize().rows() % band_size == 0, mat_hh.blockSize(), band_size);
+  DLAF_ASSERT(band_size_out >= 2, band_size_out);
+  DLAF_ASSERT(band_size_out < band_size, band_size_out, band_size);
+  DLAF_ASSERT(band_size % band_size_out == 0, band_size, band_size_out);
+
+  internal::BackTransformationB2B<B, D, T>::call(band_size, band_size_out, mat_e, mat_hh);
+}
+
 template <Backend B, Device D, class T>
 void backTransformationBandToTridiag(comm::CommunicatorGrid grid, const SizeType band_size,
                                      matrix::Matrix<T, D>& mat_e,
@@ -10,8 +10,13 @@
 
 #pragma once
 
+#include <vector>
+
+#include <dlaf/common/pipeline.h>
+#include <dlaf/communication/communicator.h>
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/tile.h>
 #include <dlaf/types.h>
 
 namespace dlaf::eigensolver::internal {
@@ -21,17 +26,63 @@ struct BackTransformationT2B {
   static void call(const SizeType band_size, Matrix<T, D>& mat_e, Matrix<const T, Device::CPU>& mat_hh);
   static void call(comm::CommunicatorGrid grid, const SizeType band_size, Matrix<T, D>& mat_e,
                    Matrix<const T, Device::CPU>& mat_hh);
+  static void call(comm::CommunicatorGrid grid, common::Pipeline<comm::Communicator>& mpi_chain_row,
+                   common::Pipeline<comm::Communicator>& mpi_chain_col, const SizeType band_size,
+                   Matrix<T, D>& mat_e, Matrix<const T, Device::CPU>& mat_hh);
+};
+
+// Local back-transformation of the band to tridiagonal reduction, applied to E one block of tile
+// columns at a time (e.g. for pipelining it with the following back-transformations).
+//
+// V and W = V T of all the blocks of HH reflectors are computed once by the constructor and are reused
+// by all the calls. They are kept until the object is destroyed, which requires O(n^2) extra memory
+// (about max(2, bt_band_to_tridiag_hh_merge_steps) * n^2 elements for a n x n matrix E).
+template <Backend B, Device D, class T>
+class BackTransformationT2BColumnBlocks {
+public:
+  BackTransformationT2BColumnBlocks(const SizeType band_size, Matrix<T, D>& mat_e,
+                                    Matrix<const T, Device::CPU>& mat_hh);
+
+  // Apply the back-transformation to the tile columns [j_begin, j_end) of mat_e.
+  void call(const SizeType j_begin, const SizeType j_end);
+
+private:
+  SizeType b_;
+  SizeType nr_merged_ = 1;
+  SizeType group_size_ = 1;
+  Matrix<T, D>& mat_e_;
+  Matrix<const T, Device::CPU>& mat_hh_;
+  // V and W of the blocks of HH reflectors, in the order in which they are applied.
+  std::vector<matrix::ReadOnlyTileSender<T, D>> tiles_v_;
+  std::vector<matrix::ReadOnlyTileSender<T, D>> tiles_w_;
+};
+
+template <Backend B, Device D, class T>
+struct BackTransformationB2B {
+  static void call(const SizeType band_size, const SizeType band_size_out, Matrix<T, D>& mat_e,
+                   Matrix<const T, Device::CPU>& mat_hh);
+  // Apply the back-transformation just to the tile columns [j_begin, j_end) of mat_e.
+  static void call(const SizeType band_size, const SizeType band_size_out, Matrix<T, D>& mat_e,
+                   Matrix<const T, Device::CPU>& mat_hh, const SizeType j_begin, const SizeType j_end);
 };
 
 // ETI
 #define DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(KWORD, BACKEND, DEVICE, T) \
-  KWORD template struct BackTransformationT2B<BACKEND, DEVICE, T>;
+  KWORD template struct BackTransformationT2B<BACKEND, DEVICE, T>;             \
+  KWORD template class BackTransformationT2BColumnBlocks<BACKEND, DEVICE, T>;
+#define DLAF_EIGENSOLVER_BT_BAND_TO_BAND_ETI(KWORD, BACKEND, DEVICE, T) \
+  KWORD template struct BackTransformationB2B<BACKEND, DEVICE, T>;
 
 DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(extern, Backend::MC, Device::CPU, float)
 DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(extern, Backend::MC, Device::CPU, double)
 DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(extern, Backend::MC, Device::CPU, std::complex<float>)
 DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(extern, Backend::MC, Device::CPU, std::complex<double>)
 
+DLAF_EIGENSOLVER_BT_BAND_TO_BAND_ETI(extern, Backend::MC, Device::CPU, float)
+DLAF_EIGENSOLVER_BT_BAND_TO_BAND_ETI(extern, Backend::MC, Device::CPU, double)
+DLAF_EIGENSOLVER_BT_BAND_TO_BAND_ETI(extern, Backend::MC, Device::CPU, std::complex<float>)
+DLAF_EIGENSOLVER_BT_BAND_TO_BAND_ETI(extern, Backend::MC, Device::CPU, std::complex<double>)
+
 #ifdef DLAF_WITH_GPU
 DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(extern, Backend::GPU, Device::GPU, float)
 DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(extern, Backend::GPU, Device::GPU, double)
@@ -10,8 +10,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <pika/execution.hpp>
 #include <pika/thread.hpp>
@@ -153,6 +158,73 @@ std::tuple<matrix::Tile<T, Device::CPU>, matrix::Tile<T, Device::CPU>> computeVW
   return std::make_tuple(std::move(tile_v2), std::move(tile_w));
 }
 
+// Description of a block of HH reflectors of a merged group (see computeVWMerged).
+// A block with nrefls == 0 is not part of the group (i.e. the corresponding columns are zero).
+struct MergedHHBlock {
+  std::size_t index_hh = 0;
+  matrix::SubTileSpec spec_hh{};
+  SizeType rows_v = 0;
+  SizeType nrefls = 0;
+};
+
+// Merge the blocks of HH reflectors of consecutive steps of the same sweep block, in a single compact
+// WY block, i.e. H_{k-1} ... H_1 H_0 = I - V T V*, where H_k = I - V_k T_k V_k* is the block of the
+// k-th step (applied after the blocks of the previous steps).
+//
+// The block of the k-th step is stored in V starting from element (k * b, k * b) as it is stored in the
+// well formed form (see setupVWellFormed). Note that the resulting V is still zero above the diagonal
+// and each reflector is at most b elements long. T is lower block triangular with upper triangular
+// diagonal blocks T_k and T_{k,<k} = -T_k V_k* V_{<k} T_{<k}.
+//
+// Returns V and W = V T.
+template <class T, class TilesHH>
+std::tuple<matrix::Tile<T, Device::CPU>, matrix::Tile<T, Device::CPU>> computeVWMerged(
+    const SizeType b, const std::vector<MergedHHBlock>& blocks, const TilesHH& tiles_hh,
+    matrix::Tile<T, Device::CPU> tile_v, matrix::Tile<T, Device::CPU> tile_t,
+    matrix::Tile<T, Device::CPU> tile_w) {
+  using namespace blas;
+  using tile::internal::gemm;
+  using tile::internal::trmm;
+
+  common::internal::SingleThreadedBlasScope single;
+
+  const SizeType rows_v = tile_v.size().rows();
+  const SizeType cols_v = tile_v.size().cols();
+  lapack::laset(Uplo::General, rows_v, cols_v, T(0), T(0), tile_v.ptr(), tile_v.ld());
+  lapack::laset(Uplo::General, cols_v, cols_v, T(0), T(0), tile_t.ptr(), tile_t.ld());
+
+  for (std::size_t k = 0; k < blocks.size(); ++k) {
+    const MergedHHBlock& block = blocks[k];
+    if (block.nrefls == 0)
+      continue;
+
+    const SizeType j = to_SizeType(k) * b;
+    const auto tile_hh = tiles_hh[block.index_hh].get().subTileReference(block.spec_hh);
+    auto subtile_v = setupVWellFormed(b, tile_hh,
+                                      tile_v.subTileReference({{j, j}, {block.rows_v, block.nrefls}}));
+    auto subtile_t = tile_t.subTileReference({{j, j}, {block.nrefls, block.nrefls}});
+    computeTFactor(tile_hh.subTileReference({{0, 0}, {1, block.nrefls}}), subtile_v, subtile_t);
+
+    if (j == 0)
+      continue;
+
+    // T_{k,<k} = -T_k . (V_k* . V_{<k}) . T_{<k}, where W is used as workspace.
+    const SizeType ib = rows_v - j;
+    auto tmp = tile_w.subTileReference({{0, 0}, {block.nrefls, j}});
+    auto subtile_t_left = tile_t.subTileReference({{j, 0}, {block.nrefls, j}});
+    gemm(Op::ConjTrans, Op::NoTrans, T(1), tile_v.subTileReference({{j, j}, {ib, block.nrefls}}),
+         tile_v.subTileReference({{j, 0}, {ib, j}}), T(0), tmp);
+    gemm(Op::NoTrans, Op::NoTrans, T(1), tmp, tile_t.subTileReference({{0, 0}, {j, j}}), T(0),
+         subtile_t_left);
+    trmm(Side::Left, Uplo::Upper, Op::NoTrans, Diag::NonUnit, T(-1), subtile_t, subtile_t_left);
+  }
+
+  // W = V . T
+  gemm(Op::NoTrans, Op::NoTrans, T(1), tile_v, tile_t, T(0), tile_w);
+
+  return std::make_tuple(std::move(tile_v), std::move(tile_w));
+}
+
 template <class Tile, class CTile>
 std::tuple<CTile, CTile, Tile, Tile> applyHHToSingleTileRowSubtileHelper(  //
     const SizeType j, const SizeType jb, const CTile& tile_v, const CTile& tile_w, const Tile& tile_w2,
@@ -507,16 +579,14 @@ struct HHManager<Backend::MC, Device::CPU, T> {
 
   HHManager(const SizeType b, const std::size_t, matrix::Distribution, matrix::Distribution) : b(b) {}
 
-  template <class SenderHH>
-  auto computeVW(const SizeType nb_apply, const LocalTileIndex ij, const TileAccessHelper& helper,
-                 SenderHH&& tile_hh, matrix::Panel<Coord::Col, T, D>& mat_v,
-                 matrix::Panel<Coord::Col, T, D>& mat_t, matrix::Panel<Coord::Col, T, D>& mat_w) {
+  template <class SenderHH, class SenderV, class SenderT, class SenderW>
+  auto computeVW(const SizeType nb_apply, const LocalTileIndex, const TileAccessHelper&,
+                 SenderHH&& tile_hh, SenderV&& tile_v, SenderT&& tile_t, SenderW&& tile_w) {
     namespace ex = pika::execution::experimental;
 
     return dlaf::internal::whenAllLift(b, std::forward<SenderHH>(tile_hh), nb_apply,
-                                       splitTile(mat_v.readwrite(ij), helper.specHH()),
-                                       splitTile(mat_t.readwrite(ij), helper.specT()),
-                                       splitTile(mat_w.readwrite(ij), helper.specHH())) |
+                                       std::forward<SenderV>(tile_v), std::forward<SenderT>(tile_t),
+                                       std::forward<SenderW>(tile_w)) |
            dlaf::internal::transform(dlaf::internal::Policy<Backend::MC>(), bt_tridiag::computeVW<T>) |
            ex::split_tuple();
   }
@@ -535,10 +605,9 @@ struct HHManager<Backend::GPU, Device::GPU, T> {
             matrix::Distribution dist_w)
       : b(b), t_panels_h(n_workspaces, dist_t), w_panels_h(n_workspaces, dist_w) {}
 
-  template <class SenderHH>
+  template <class SenderHH, class SenderV, class SenderT, class SenderW>
   auto computeVW(const SizeType hhr_nb, const LocalTileIndex ij, const TileAccessHelper& helper,
-                 SenderHH&& tile_hh, matrix::Panel<Coord::Col, T, D>& mat_v,
-                 matrix::Panel<Coord::Col, T, D>& mat_t, matrix::Panel<Coord::Col, T, D>& mat_w) {
+                 SenderHH&& tile_hh, SenderV&& tile_v, SenderT&& tile_t, SenderW&& tile_w) {
     namespace ex = pika::execution::experimental;
 
     auto& mat_v_h = w_panels_h.nextResource();
@@ -581,10 +650,8 @@ struct HHManager<Backend::GPU, Device::GPU, T> {
           return std::make_tuple(std::move(tile_v), std::move(tile_w));
         };
 
-    return ex::when_all(std::move(tile_v_h), std::move(tile_t_h),
-                        splitTile(mat_v.readwrite(ij), helper.specHH()),
-                        splitTile(mat_t.readwrite(ij_t), t_spec),
-                        splitTile(mat_w.readwrite(ij), helper.specHH())) |
+    return ex::when_all(std::move(tile_v_h), std::move(tile_t_h), std::forward<SenderV>(tile_v),
+                        std::forward<SenderT>(tile_t), std::forward<SenderW>(tile_w)) |
            dlaf::internal::transform<dlaf::internal::TransformDispatchType::Blas>(
                dlaf::internal::Policy<Backend::GPU>(), copyVTandComputeW) |
            ex::split_tuple();
@@ -596,12 +663,240 @@ protected:
   common::RoundRobin<matrix::Panel<Coord::Col, T, Device::CPU>> w_panels_h;
 };
 #endif
+
+// Returns the number of HH reflectors of the given step of the sweep block j.
+// Note: reflectors with size = 1 must be ignored, except for the last step of the last sweep with
+//       complex type.
+template <class T>
+SizeType nrReflectorsStep(const matrix::Distribution& dist_hh, const SizeType b, const SizeType j,
+                          const SizeType step) {
+  const SizeType j_last_sweep = (nrSweeps<T>(dist_hh.size().cols()) - 1) / b;
+  const SizeType steps = nrStepsForSweep(j * b, dist_hh.size().cols(), b);
+  const GlobalElementIndex ij_el((j + step) * b, j * b);
+
+  const bool allowSize1 = isComplex_v<T> && j == j_last_sweep && step == steps - 1;
+  const GlobalElementSize delta(dist_hh.size().rows() - ij_el.row() - 1,
+                                std::min(b, dist_hh.size().cols() - ij_el.col()));
+  return std::min(b, std::min(delta.rows() - (allowSize1 ? 0 : 1), delta.cols()));
+}
+
+// Returns the number of consecutive steps of the same sweep block whose HH reflectors are merged
+// (see applyMergedHHs), or 1 if they are not merged.
+// Note: the number of merged steps has to divide nb / b, such that E can be retiled accordingly.
+template <Backend B>
+SizeType nrMergedSteps(const SizeType nb, const SizeType b) {
+  if constexpr (B != Backend::MC)
+    return 1;
+
+  const SizeType nr_steps_block = nb / b;
+  SizeType nr_merged = std::min(getTuneParameters().bt_band_to_tridiag_hh_merge_steps, nr_steps_block);
+  while (nr_merged > 1 && nr_steps_block % nr_merged != 0)
+    --nr_merged;
+  return std::max<SizeType>(nr_merged, 1);
+}
+
+// Applies the block of HH reflectors described by helper, i.e. V (tile_v) and W = V T (tile_w), to the
+// tile columns [j_begin, j_end) of E.
+template <Backend B, Device D, class T>
+void applyHHToE(const SizeType group_size, const TileAccessHelper& helper,
+                const matrix::ReadOnlyTileSender<T, D>& tile_v,
+                const matrix::ReadOnlyTileSender<T, D>& tile_w, matrix::Panel<Coord::Row, T, D>& mat_w2,
+                matrix::RetiledMatrix<T, D>& mat_e_rt, const SizeType j_begin, const SizeType j_end) {
+  using pika::execution::thread_priority;
+  namespace ex = pika::execution::experimental;
+
+  for (SizeType j_e = j_begin; j_e < j_end; ++j_e) {
+    const auto idx_e = helper.topIndexE(j_e);
+
+    if (!helper.affectsMultipleTiles()) {
+      ex::start_detached(
+          ex::when_all(ex::just(group_size), tile_v, tile_w, mat_w2.readwrite(LocalTileIndex(0, j_e)),
+                       mat_e_rt.readwrite(idx_e)) |
+          dlaf::internal::transform<dlaf::internal::TransformDispatchType::Blas>(
+              dlaf::internal::Policy<B>(thread_priority::normal), ApplyHHToSingleTileRow<B, T>{}));
+    }
+    else {
+      ex::start_detached(
+          ex::when_all(ex::just(group_size), tile_v, tile_w, mat_w2.readwrite(LocalTileIndex(0, j_e)),
+                       mat_e_rt.readwrite(idx_e), mat_e_rt.readwrite(helper.bottomIndexE(j_e))) |
+          dlaf::internal::transform<dlaf::internal::TransformDispatchType::Blas>(
+              dlaf::internal::Policy<B>(thread_priority::normal), ApplyHHToDoubleTileRow<B, T>{}));
+    }
+  }
+}
+
+// Computes V and W = V T of the merged blocks of HH reflectors of the sweep block j which are applied
+// starting from the second row of the tile i_e of E, retiled with tiles of nr_merged * b rows (see
+// applyMergedHHs and computeVWMerged).
+//
+// The tiles of V and W have to be (rows_v x nr_merged * b) with rows_v = min(nr_merged * b + b, m - i_e
+// * nr_merged * b) - 1, while the tile of T (used as workspace) has to be (nr_merged * b) x (nr_merged *
+// b).
+template <class T, class TileSenderV, class TileSenderT, class TileSenderW>
+auto computeMergedVW(const SizeType b, const SizeType nr_merged, Matrix<const T, Device::CPU>& mat_hh,
+                     const SizeType j, const SizeType i_e, TileSenderV&& tile_v, TileSenderT&& tile_t,
+                     TileSenderW&& tile_w) {
+  namespace ex = pika::execution::experimental;
+
+  constexpr auto B = Backend::MC;
+  constexpr auto D = Device::CPU;
+
+  const auto& dist_hh = mat_hh.distribution();
+  const SizeType steps = nrStepsForSweep(j * b, mat_hh.size().cols(), b);
+
+  std::vector<MergedHHBlock> blocks(to_sizet(nr_merged));
+  std::vector<LocalTileIndex> indices_hh;
+  std::vector<matrix::ReadOnlyTileSender<T, D>> tiles_hh;
+
+  for (SizeType k = 0; k < nr_merged; ++k) {
+    const SizeType i = i_e * nr_merged + k;
+    const SizeType step = i - j;
+    if (step < 0 || step >= steps)
+      continue;
+
+    const GlobalElementIndex ij_el(i * b, j * b);
+    const LocalTileIndex ij(dist_hh.localTileIndex(dist_hh.globalTileIndex(ij_el)));
+
+    auto it = std::find(indices_hh.begin(), indices_hh.end(), ij);
+    if (it == indices_hh.end()) {
+      indices_hh.push_back(ij);
+      tiles_hh.push_back(mat_hh.read(ij));
+      it = std::prev(indices_hh.end());
+    }
+
+    MergedHHBlock& block = blocks[to_sizet(k)];
+    block.index_hh = to_sizet(std::distance(indices_hh.begin(), it));
+    block.spec_hh = {dist_hh.tileElementIndex(ij_el),
+                     {std::min(b, dist_hh.size().rows() - ij_el.row()),
+                      std::min(b, dist_hh.size().cols() - ij_el.col())}};
+    block.rows_v = std::min(2 * b, mat_hh.size().rows() - ij_el.row()) - 1;
+    block.nrefls = nrReflectorsStep<T>(dist_hh, b, j, step);
+  }
+
+  auto [tile_v_unshared, tile_w_unshared] =
+      ex::when_all(ex::just(b, std::move(blocks)), ex::when_all_vector(std::move(tiles_hh)),
+                   std::forward<TileSenderV>(tile_v), std::forward<TileSenderT>(tile_t),
+                   std::forward<TileSenderW>(tile_w)) |
+      dlaf::internal::transform(dlaf::internal::Policy<B>(), [](auto&&... ts) {
+        return computeVWMerged<T>(std::forward<decltype(ts)>(ts)...);
+      }) |
+      ex::split_tuple();
+  return std::make_tuple(
+      matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_v_unshared))),
+      matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_w_unshared))));
+}
+
+// Applies the merged blocks of HH reflectors, i.e. V (tile_v) and W = V T (tile_w), computed by
+// computeMergedVW for the tile i_e of the retiled E, to its tile columns [j_begin, j_end).
+template <class T>
+void applyMergedHHToE(const SizeType b, const SizeType bm, const SizeType i_e,
+                      const matrix::ReadOnlyTileSender<T, Device::CPU>& tile_v,
+                      const matrix::ReadOnlyTileSender<T, Device::CPU>& tile_w,
+                      matrix::Panel<Coord::Row, T, Device::CPU>& mat_w2,
+                      matrix::RetiledMatrix<T, Device::CPU>& mat_e_rt, const SizeType j_begin,
+                      const SizeType j_end) {
+  using pika::execution::thread_priority;
+  namespace ex = pika::execution::experimental;
+
+  constexpr auto B = Backend::MC;
+
+  const auto& dist_e_rt = mat_e_rt.distribution();
+
+  const SizeType rows_e = mat_e_rt.size().rows() - i_e * bm;
+  const SizeType rows_v = std::min(bm + b, rows_e) - 1;
+  const SizeType rows_e_top = std::min(bm, rows_e);
+
+  for (SizeType j_e = j_begin; j_e < j_end; ++j_e) {
+    const GlobalTileIndex idx_e(i_e, j_e);
+
+    if (rows_v == rows_e_top - 1) {
+      ex::start_detached(
+          ex::when_all(ex::just(bm), tile_v, tile_w, mat_w2.readwrite(LocalTileIndex(0, j_e)),
+                       mat_e_rt.readwrite(idx_e)) |
+          dlaf::internal::transform<dlaf::internal::TransformDispatchType::Blas>(
+              dlaf::internal::Policy<B>(thread_priority::normal), ApplyHHToSingleTileRow<B, T>{}));
+    }
+    else {
+      const GlobalTileIndex idx_e_bottom(i_e + 1, j_e);
+      const matrix::SubTileSpec spec_bottom{{0, 0},
+                                            {rows_v + 1 - rows_e_top,
+                                             dist_e_rt.tileSize(idx_e_bottom).cols()}};
+      ex::start_detached(
+          ex::when_all(ex::just(bm), tile_v, tile_w, mat_w2.readwrite(LocalTileIndex(0, j_e)),
+                       mat_e_rt.readwrite(idx_e),
+                       splitTile(mat_e_rt.readwrite(idx_e_bottom), spec_bottom)) |
+          dlaf::internal::transform<dlaf::internal::TransformDispatchType::Blas>(
+              dlaf::internal::Policy<B>(thread_priority::normal), ApplyHHToDoubleTileRow<B, T>{}));
+    }
+  }
+}
+
+// Local back-transformation (MC backend), where the blocks of HH reflectors of nr_merged consecutive
+// steps of the same sweep block are merged in a single compact WY block (see computeVWMerged).
+//
+// E is retiled with tiles of nr_merged * b rows, such that the steps of a group are aligned with the
+// tiles of E, i.e. the merged reflectors of the group associated to the row tile i_e (which are applied
+// starting from its second row) are applied to the tile i_e and to the first b rows of the tile
+// i_e + 1 (if any).
+template <class T>
+void applyMergedHHs(const SizeType b, const SizeType nr_merged, Matrix<T, Device::CPU>& mat_e,
+                    Matrix<const T, Device::CPU>& mat_hh) {
+  using common::RoundRobin;
+  using matrix::Panel;
+
+  constexpr auto D = Device::CPU;
+
+  const SizeType bm = nr_merged * b;
+  const SizeType nsweeps = nrSweeps<T>(mat_hh.size().cols());
+
+  const LocalTileSize tiles_per_block(mat_e.blockSize().rows() / bm, 1);
+  matrix::RetiledMatrix<T, D> mat_e_rt(mat_e, tiles_per_block);
+
+  const SizeType nr_tiles_e = mat_e_rt.distribution().nrTiles().rows();
+
+  const TileElementSize w_tile_sz(bm + b - 1, bm);
+  const matrix::Distribution dist_w({nr_tiles_e * w_tile_sz.rows(), bm}, w_tile_sz);
+  const matrix::Distribution dist_t({nr_tiles_e * bm, bm}, {bm, bm});
+  const matrix::Distribution dist_w2({bm, mat_e_rt.size().cols()}, {bm, mat_e_rt.blockSize().cols()});
+
+  constexpr std::size_t n_workspaces = 2;
+  RoundRobin<Panel<Coord::Col, T, D>> t_panels(n_workspaces, dist_t);
+  RoundRobin<Panel<Coord::Col, T, D>> v_panels(n_workspaces, dist_w);
+  RoundRobin<Panel<Coord::Col, T, D>> w_panels(n_workspaces, dist_w);
+  RoundRobin<Panel<Coord::Row, T, D>> w2_panels(n_workspaces, dist_w2);
+
+  const SizeType j_last_sweep = (nsweeps - 1) / b;
+  for (SizeType j = j_last_sweep; j >= 0; --j) {
+    auto& mat_t = t_panels.nextResource();
+    auto& mat_v = v_panels.nextResource();
+    auto& mat_w = w_panels.nextResource();
+    auto& mat_w2 = w2_panels.nextResource();
+
+    const SizeType steps = nrStepsForSweep(j * b, mat_hh.size().cols(), b);
+    for (SizeType i_e = j / nr_merged; i_e * nr_merged < j + steps; ++i_e) {
+      const SizeType rows_v = std::min(bm + b, mat_e.size().rows() - i_e * bm) - 1;
+      const LocalTileIndex idx_ws(i_e, 0);
+
+      auto [tile_v, tile_w] =
+          computeMergedVW(b, nr_merged, mat_hh, j, i_e,
+                          splitTile(mat_v.readwrite(idx_ws), {{0, 0}, {rows_v, bm}}),
+                          mat_t.readwrite(idx_ws),
+                          splitTile(mat_w.readwrite(idx_ws), {{0, 0}, {rows_v, bm}}));
+
+      applyMergedHHToE<T>(b, bm, i_e, tile_v, tile_w, mat_w2, mat_e_rt, 0, mat_e_rt.nrTiles().cols());
+
+      mat_t.reset();
+      mat_v.reset();
+      mat_w.reset();
+      mat_w2.reset();
+    }
+  }
+}
 }
 
 template <Backend B, Device D, class T>
 void BackTransformationT2B<B, D, T>::call(const SizeType band_size, Matrix<T, D>& mat_e,
                                           Matrix<const T, Device::CPU>& mat_hh) {
-  using pika::execution::thread_priority;
   namespace ex = pika::execution::experimental;
 
   using common::iterate_range2d;
@@ -617,6 +912,15 @@ void BackTransformationT2B<B, D, T>::call(const SizeType band_size, Matrix<T, D>
     return;
 
   const SizeType b = band_size;
+
+  if constexpr (B == Backend::MC) {
+    const SizeType nr_merged = nrMergedSteps<B>(mat_e.blockSize().rows(), b);
+    if (nr_merged > 1) {
+      applyMergedHHs(b, nr_merged, mat_e, mat_hh);
+      return;
+    }
+  }
+
   const SizeType group_size = getTuneParameters().bt_band_to_tridiag_hh_apply_group_size;
   const SizeType nsweeps = nrSweeps<T>(mat_hh.size().cols());
 
@@ -670,14 +974,7 @@ void BackTransformationT2B<B, D, T>::call(const SizeType band_size, Matrix<T, D>
       const GlobalElementIndex ij_el(i * b, j * b);
       const LocalTileIndex ij(dist_hh.localTileIndex(dist_hh.globalTileIndex(ij_el)));
 
-      // Note:  reflector with size = 1 must be ignored, except for the last step of the last sweep
-      //        with complex type
-      const SizeType nrefls = [&]() {
-        const bool allowSize1 = isComplex_v<T> && j == j_last_sweep && step == steps - 1;
-        const GlobalElementSize delta(dist_hh.size().rows() - ij_el.row() - 1,
-                                      std::min(b, dist_hh.size().cols() - ij_el.col()));
-        return std::min(b, std::min(delta.rows() - (allowSize1 ? 0 : 1), delta.cols()));
-      }();
+      const SizeType nrefls = nrReflectorsStep<T>(dist_hh, b, j, step);
 
       const TileAccessHelper helper(b, nrefls, dist_hh, dist_e_rt, ij_el);
 
@@ -690,42 +987,316 @@ void BackTransformationT2B<B, D, T>::call(const SizeType band_size, Matrix<T, D>
 
       auto [tile_v_unshared, tile_w_unshared] =
           helperBackend.computeVW(group_size, ij, helper,
-                                  splitTile(mat_hh.read(ij), helper.specHHCompact()), mat_v, mat_t,
-                                  mat_w);
+                                  splitTile(mat_hh.read(ij), helper.specHHCompact()),
+                                  splitTile(mat_v.readwrite(ij), helper.specHH()),
+                                  splitTile(mat_t.readwrite(ij), helper.specT()),
+                                  splitTile(mat_w.readwrite(ij), helper.specHH()));
       auto tile_v = matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_v_unshared)));
       auto tile_w = matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_w_unshared)));
 
-      for (SizeType j_e = 0; j_e < dist_e_rt.nrTiles().cols(); ++j_e) {
-        const auto idx_e = helper.topIndexE(j_e);
+      applyHHToE<B>(group_size, helper, tile_v, tile_w, mat_w2, mat_e_rt, 0,
+                    mat_e_rt.nrTiles().cols());
 
-        if (!helper.affectsMultipleTiles()) {
-          ex::start_detached(
-              ex::when_all(ex::just(group_size), tile_v, tile_w,
-                           mat_w2.readwrite(LocalTileIndex(0, j_e)), mat_e_rt.readwrite(idx_e)) |
-              dlaf::internal::transform<dlaf::internal::TransformDispatchType::Blas>(
-                  dlaf::internal::Policy<B>(thread_priority::normal), ApplyHHToSingleTileRow<B, T>{}));
-        }
-        else {
-          ex::start_detached(
-              ex::when_all(ex::just(group_size), tile_v, tile_w,
-                           mat_w2.readwrite(LocalTileIndex(0, j_e)), mat_e_rt.readwrite(idx_e),
-                           mat_e_rt.readwrite(helper.bottomIndexE(j_e))) |
-              dlaf::internal::transform<dlaf::internal::TransformDispatchType::Blas>(
-                  dlaf::internal::Policy<B>(thread_priority::normal), ApplyHHToDoubleTileRow<B, T>{}));
+      mat_t.reset();
+      mat_v.reset();
+      mat_w.reset();
+      mat_w2.reset();
+    }
+  }
+}
+
+template <Backend B, Device D, class T>
+BackTransformationT2BColumnBlocks<B, D, T>::BackTransformationT2BColumnBlocks(
+    const SizeType band_size, Matrix<T, D>& mat_e, Matrix<const T, Device::CPU>& mat_hh)
+    : b_(band_size), mat_e_(mat_e), mat_hh_(mat_hh) {
+  namespace ex = pika::execution::experimental;
+
+  using common::RoundRobin;
+  using matrix::Panel;
+  using namespace bt_tridiag;
+
+  if (mat_hh.size().isEmpty() || mat_e.size().isEmpty())
+    return;
+
+  // Note: if no householder reflectors are going to be applied (in case of trivial matrix)
+  if (mat_hh.size().rows() <= (dlaf::isComplex_v<T> ? 1 : 2))
+    return;
+
+  const SizeType b = b_;
+  const SizeType nsweeps = nrSweeps<T>(mat_hh.size().cols());
+  const SizeType j_last_sweep = (nsweeps - 1) / b;
+
+  nr_merged_ = nrMergedSteps<B>(mat_e.blockSize().rows(), b);
+  group_size_ = getTuneParameters().bt_band_to_tridiag_hh_apply_group_size;
+
+  // Note: V and W of each sweep block are stored in a dedicated matrix, which is not kept by this
+  // object, as the tiles in tiles_v_ and tiles_w_ keep their memory alive.
+  if constexpr (B == Backend::MC) {
+    if (nr_merged_ > 1) {
+      const SizeType bm = nr_merged_ * b;
+      const TileElementSize w_tile_sz(bm + b - 1, bm);
+
+      for (SizeType j = j_last_sweep; j >= 0; --j) {
+        const SizeType steps = nrStepsForSweep(j * b, mat_hh.size().cols(), b);
+        const SizeType i_e_begin = j / nr_merged_;
+        const SizeType nr_groups = util::ceilDiv(j + steps, nr_merged_) - i_e_begin;
+
+        Matrix<T, D> mat_v({nr_groups * w_tile_sz.rows(), bm}, w_tile_sz);
+        Matrix<T, D> mat_w({nr_groups * w_tile_sz.rows(), bm}, w_tile_sz);
+        Matrix<T, D> mat_t({nr_groups * bm, bm}, {bm, bm});
+
+        for (SizeType g = 0; g < nr_groups; ++g) {
+          const SizeType i_e = i_e_begin + g;
+          const SizeType rows_v = std::min(bm + b, mat_e.size().rows() - i_e * bm) - 1;
+          const LocalTileIndex idx_ws(g, 0);
+
+          auto [tile_v, tile_w] =
+              computeMergedVW(b, nr_merged_, mat_hh, j, i_e,
+                              splitTile(mat_v.readwrite(idx_ws), {{0, 0}, {rows_v, bm}}),
+                              mat_t.readwrite(idx_ws),
+                              splitTile(mat_w.readwrite(idx_ws), {{0, 0}, {rows_v, bm}}));
+          tiles_v_.push_back(std::move(tile_v));
+          tiles_w_.push_back(std::move(tile_w));
         }
       }
+      return;
+    }
+  }
+
+  // Note: same distribution of E retiled with tiles of b rows (see call).
+  const auto& dist_e = mat_e.distribution();
+  const matrix::Distribution dist_e_rt(dist_e.size(), dist_e.blockSize(),
+                                       TileElementSize(b, dist_e.blockSize().cols()),
+                                       dist_e.commGridSize(), dist_e.rankIndex(),
+                                       dist_e.sourceRankIndex());
+  const auto& dist_hh = mat_hh.distribution();
+
+  const TileElementSize w_tile_sz(2 * b - 1, b);
+  const matrix::Distribution dist_t({mat_hh.size().rows(), b}, {b, b});
+  const matrix::Distribution dist_w({dist_e_rt.nrTiles().rows() * w_tile_sz.rows(), b}, w_tile_sz);
+
+  constexpr std::size_t n_workspaces = 2;
+  RoundRobin<Panel<Coord::Col, T, D>> t_panels(n_workspaces, dist_t);
+
+  HHManager<B, D, T> helperBackend(b, n_workspaces, dist_t, dist_w);
+
+  for (SizeType j = j_last_sweep; j >= 0; --j) {
+    const SizeType steps = nrStepsForSweep(j * b, mat_hh.size().cols(), b);
+
+    Matrix<T, D> mat_v({steps * w_tile_sz.rows(), b}, w_tile_sz);
+    Matrix<T, D> mat_w({steps * w_tile_sz.rows(), b}, w_tile_sz);
+
+    for (SizeType step = 0; step < steps; ++step) {
+      auto& mat_t = t_panels.nextResource();
+
+      const GlobalElementIndex ij_el((j + step) * b, j * b);
+      const LocalTileIndex ij(dist_hh.localTileIndex(dist_hh.globalTileIndex(ij_el)));
+      const LocalTileIndex idx_ws(step, 0);
+
+      const SizeType nrefls = nrReflectorsStep<T>(dist_hh, b, j, step);
+      const TileAccessHelper helper(b, nrefls, dist_hh, dist_e_rt, ij_el);
+
+      auto [tile_v, tile_w] = helperBackend.computeVW(
+          group_size_, ij, helper, splitTile(mat_hh.read(ij), helper.specHHCompact()),
+          splitTile(mat_v.readwrite(idx_ws), helper.specHH()),
+          splitTile(mat_t.readwrite(ij), helper.specT()),
+          splitTile(mat_w.readwrite(idx_ws), helper.specHH()));
+      tiles_v_.push_back(matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_v))));
+      tiles_w_.push_back(matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_w))));
 
       mat_t.reset();
-      mat_v.reset();
-      mat_w.reset();
+    }
+  }
+}
+
+template <Backend B, Device D, class T>
+void BackTransformationT2BColumnBlocks<B, D, T>::call(const SizeType j_begin, const SizeType j_end) {
+  using common::RoundRobin;
+  using matrix::Panel;
+  using namespace bt_tridiag;
+
+  DLAF_ASSERT(0 <= j_begin && j_begin <= j_end && j_end <= mat_e_.nrTiles().cols(), j_begin, j_end,
+              mat_e_.nrTiles().cols());
+
+  if (tiles_v_.empty() || j_begin == j_end)
+    return;
+
+  const SizeType b = b_;
+  const SizeType bm = nr_merged_ * b;
+  const SizeType j_last_sweep = (nrSweeps<T>(mat_hh_.size().cols()) - 1) / b;
+
+  const LocalTileSize tiles_per_block(mat_e_.blockSize().rows() / bm, 1);
+  matrix::RetiledMatrix<T, D> mat_e_rt(mat_e_, tiles_per_block);
+
+  const auto& dist_hh = mat_hh_.distribution();
+  const auto& dist_e_rt = mat_e_rt.distribution();
+
+  const matrix::Distribution dist_w2({bm, mat_e_rt.size().cols()}, {bm, mat_e_rt.blockSize().cols()});
+
+  constexpr std::size_t n_workspaces = 2;
+  RoundRobin<Panel<Coord::Row, T, D>> w2_panels(n_workspaces, dist_w2);
+
+  // Note: V and W are stored in tiles_v_ and tiles_w_ in the same order they are applied here.
+  std::size_t k = 0;
+  for (SizeType j = j_last_sweep; j >= 0; --j) {
+    auto& mat_w2 = w2_panels.nextResource();
+
+    const SizeType steps = nrStepsForSweep(j * b, mat_hh_.size().cols(), b);
+
+    if constexpr (B == Backend::MC) {
+      if (nr_merged_ > 1) {
+        for (SizeType i_e = j / nr_merged_; i_e * nr_merged_ < j + steps; ++i_e, ++k) {
+          applyMergedHHToE<T>(b, bm, i_e, tiles_v_[k], tiles_w_[k], mat_w2, mat_e_rt, j_begin, j_end);
+          mat_w2.reset();
+        }
+        continue;
+      }
+    }
+
+    for (SizeType step = 0; step < steps; ++step, ++k) {
+      const GlobalElementIndex ij_el((j + step) * b, j * b);
+      const SizeType nrefls = nrReflectorsStep<T>(dist_hh, b, j, step);
+      const TileAccessHelper helper(b, nrefls, dist_hh, dist_e_rt, ij_el);
+
+      if (nrefls < b)
+        mat_w2.setHeight(nrefls);
+
+      applyHHToE<B>(group_size_, helper, tiles_v_[k], tiles_w_[k], mat_w2, mat_e_rt, j_begin, j_end);
+
       mat_w2.reset();
     }
   }
 }
 
+template <Backend B, Device D, class T>
+void BackTransformationB2B<B, D, T>::call(const SizeType band_size, const SizeType band_size_out,
+                                          Matrix<T, D>& mat_e, Matrix<const T, Device::CPU>& mat_hh) {
+  call(band_size, band_size_out, mat_e, mat_hh, 0, mat_e.nrTiles().cols());
+}
+
+template <Backend B, Device D, class T>
+void BackTransformationB2B<B, D, T>::call(const SizeType band_size, const SizeType band_size_out,
+                                          Matrix<T, D>& mat_e, Matrix<const T, Device::CPU>& mat_hh,
+                                          const SizeType j_begin, const SizeType j_end) {
+  static_assert(B == Backend::MC && D == Device::CPU,
+                "The band to band back-transformation is available only for the MC backend");
+
+  namespace ex = pika::execution::experimental;
+
+  using common::iterate_range2d;
+
+  DLAF_ASSERT(0 <= j_begin && j_begin <= j_end && j_end <= mat_e.nrTiles().cols(), j_begin, j_end,
+              mat_e.nrTiles().cols());
+
+  if (mat_hh.size().isEmpty() || mat_e.size().isEmpty())
+    return;
+
+  const SizeType b = band_size;
+  const SizeType b_out = band_size_out;
+  const SizeType m = mat_hh.size().rows();
+  const SizeType nb = mat_hh.blockSize().rows();
+  const SizeType nsweeps = nrSweepsBandToBand(m, b_out);
+
+  if (nsweeps == 0)
+    return;
+
+  const auto& dist_hh = mat_hh.distribution();
+  const LocalTileSize nr_tiles_hh = dist_hh.localNrTiles();
+
+  // Each task applies all the blocks of HH reflectors, in reverse order, to a tile column of E.
+  // The blocks of HH reflectors (and their T factors) are cheap to set up compared to their
+  // application, hence they are recomputed by each task.
+  auto apply_hh = [b, b_out, m, nb, nsweeps, nr_tiles_hh, dist_hh](const auto& hh_tiles,
+                                                                    const auto& e_tiles) {
+    using namespace blas;
+
+    common::internal::SingleThreadedBlasScope single;
+
+    const SizeType ncols = e_tiles[0].get().size().cols();
+
+    std::vector<T> taus(to_sizet(b_out));
+    std::vector<T> v(to_sizet(b * b_out));
+    std::vector<T> t(to_sizet(b_out * b_out));
+    std::vector<T> w(to_sizet(b_out * ncols));
+
+    for (SizeType sweep = nsweeps - 1; sweep >= 0; --sweep) {
+      const SizeType sweep_b2t = firstRowBandToBand(sweep, 0, b, b_out) - 1;
+      const SizeType steps = nrStepsForSweepBandToBand(sweep, m, b, b_out);
+
+      for (SizeType step = steps - 1; step >= 0; --step) {
+        const SizeType first_row = firstRowBandToBand(sweep, step, b, b_out);
+        const SizeType len = std::min(b, m - first_row);
+        const SizeType k = std::min(len, b_out);
+
+        // Setup V (well formed) and T from the compact form.
+        const GlobalElementIndex ij_el((sweep_b2t / b + step) * b, sweep * b_out);
+        const GlobalTileIndex ij = dist_hh.globalTileIndex(ij_el);
+        const auto& tile_hh = hh_tiles[to_sizet(ij.row() + ij.col() * nr_tiles_hh.rows())].get();
+        const TileElementIndex ij_tile = dist_hh.tileElementIndex(ij_el);
+
+        lapack::lacpy(Uplo::Lower, len, k, tile_hh.ptr(ij_tile), tile_hh.ld(), v.data(), len);
+        lapack::laset(Uplo::Upper, len, k, T(0), T(1), v.data(), len);
+        for (SizeType i = 0; i < k; ++i)
+          taus[to_sizet(i)] = tile_hh(ij_tile + TileElementSize(i, i));
+        lapack::larft(lapack::Direction::Forward, lapack::StoreV::Columnwise, len, k, v.data(), len,
+                      taus.data(), t.data(), b_out);
+
+        // E = E - V T V* E, where the rows of E might be split between two tiles.
+        const SizeType i_tile = first_row / nb;
+        const SizeType i_el = first_row % nb;
+        const SizeType len_top = std::min(len, nb - i_el);
+        const SizeType len_bottom = len - len_top;
+
+        const auto& tile_e_top = e_tiles[to_sizet(i_tile)].get();
+        T* e_top = tile_e_top.ptr({i_el, 0});
+
+        gemm(Layout::ColMajor, Op::ConjTrans, Op::NoTrans, k, ncols, len_top, T(1), v.data(), len,
+             e_top, tile_e_top.ld(), T(0), w.data(), k);
+        if (len_bottom > 0) {
+          const auto& tile_e_bottom = e_tiles[to_sizet(i_tile + 1)].get();
+          gemm(Layout::ColMajor, Op::ConjTrans, Op::NoTrans, k, ncols, len_bottom, T(1),
+               v.data() + len_top, len, tile_e_bottom.ptr(), tile_e_bottom.ld(), T(1), w.data(), k);
+        }
+
+        trmm(Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans, Diag::NonUnit, k, ncols, T(1),
+             t.data(), b_out, w.data(), k);
+
+        gemm(Layout::ColMajor, Op::NoTrans, Op::NoTrans, len_top, ncols, k, T(-1), v.data(), len,
+             w.data(), k, T(1), e_top, tile_e_top.ld());
+        if (len_bottom > 0) {
+          const auto& tile_e_bottom = e_tiles[to_sizet(i_tile + 1)].get();
+          gemm(Layout::ColMajor, Op::NoTrans, Op::NoTrans, len_bottom, ncols, k, T(-1),
+               v.data() + len_top, len, w.data(), k, T(1), tile_e_bottom.ptr(), tile_e_bottom.ld());
+        }
+      }
+    }
+  };
+
+  const SizeType nr_tiles_e = mat_e.nrTiles().rows();
+  for (SizeType j_e = j_begin; j_e < j_end; ++j_e) {
+    auto e_range = iterate_range2d(LocalTileIndex(0, j_e), LocalTileSize(nr_tiles_e, 1));
+    ex::start_detached(dlaf::internal::transform(
+        dlaf::internal::Policy<B>(pika::execution::thread_priority::normal), apply_hh,
+        ex::when_all(ex::when_all_vector(matrix::selectRead(mat_hh, iterate_range2d(nr_tiles_hh))),
+                     ex::when_all_vector(matrix::select(mat_e, e_range)))));
+  }
+}
+
 template <Backend B, Device D, class T>
 void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid grid, const SizeType band_size,
                                           Matrix<T, D>& mat_e, Matrix<const T, Device::CPU>& mat_hh) {
+  common::Pipeline<comm::Communicator> mpi_chain_row(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_chain_col(grid.colCommunicator().clone());
+
+  call(grid, mpi_chain_row, mpi_chain_col, band_size, mat_e, mat_hh);
+}
+
+template <Backend B, Device D, class T>
+void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid grid,
+                                          common::Pipeline<comm::Communicator>& mpi_chain_row,
+                                          common::Pipeline<comm::Communicator>& mpi_chain_col,
+                                          const SizeType band_size, Matrix<T, D>& mat_e,
+                                          Matrix<const T, Device::CPU>& mat_hh) {
   using pika::execution::thread_priority;
   namespace ex = pika::execution::experimental;
 
@@ -792,11 +1363,11 @@ void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid grid, const Siz
   // P2P communication can happen out of order since they can be matched via tags, but this is not
   // possible for collective operations such as the broadcast.
   //
-  // For this reason, communications of the phase 1 will be ordered with a pipeline. Instead, for the
-  // second part, with the aim to not over constrain execution of the update, no order will be
+  // For this reason, communications of the phase 1 will be ordered with the given pipelines. Instead,
+  // for the second part, with the aim to not over constrain execution of the update, no order will be
   // enforced by relying solely on tags.
-  common::Pipeline<comm::Communicator> mpi_chain_row(grid.rowCommunicator().clone());
-  common::Pipeline<comm::Communicator> mpi_chain_col(grid.colCommunicator().clone());
+  // Note: the communicator used by the second part is cloned for each call, since unordered messages
+  // of different calls could be matched by mistake if it was shared.
   const auto mpi_col_comm = ex::just(grid.colCommunicator().clone());
 
   const SizeType idx_last_sweep_b = (nrSweeps<T>(mat_hh.size().cols()) - 1) / b;
@@ -921,9 +1492,12 @@ void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid grid, const Siz
       auto tile_hh = (rankHH == rank)
                          ? splitTile(mat_hh.read(ij_g), helper.specHHCompact())
                          : splitTile(panel_hh.read(ij_hh_panel), helper.specHHCompact(true));
+      const LocalTileIndex ij_ws = indexing_helper.wsIndexHH();
       auto [tile_v_unshared, tile_w_unshared] =
-          helperBackend.computeVW(current_group_size, indexing_helper.wsIndexHH(), helper,
-                                  std::move(tile_hh), mat_v, mat_t, mat_w);
+          helperBackend.computeVW(current_group_size, ij_ws, helper, std::move(tile_hh),
+                                  splitTile(mat_v.readwrite(ij_ws), helper.specHH()),
+                                  splitTile(mat_t.readwrite(ij_ws), helper.specT()),
+                                  splitTile(mat_w.readwrite(ij_ws), helper.specHH()));
       auto tile_v = matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_v_unshared)));
       auto tile_w = matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_w_unshared)));
 
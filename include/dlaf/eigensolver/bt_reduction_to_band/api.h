@@ -9,8 +9,14 @@
 //
 #pragma once
 
+#include <vector>
+
+#include <dlaf/common/pipeline.h>
 #include <dlaf/common/vector.h>
+#include <dlaf/communication/communicator.h>
+#include <dlaf/communication/communicator_grid.h>
 #include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/panel.h>
 #include <dlaf/types.h>
 
 namespace dlaf::eigensolver::internal {
@@ -23,11 +29,43 @@ struct BackTransformationReductionToBand {
   static void call(comm::CommunicatorGrid grid, const SizeType b, Matrix<T, device>& mat_c,
                    Matrix<const T, device>& mat_v,
                    common::internal::vector<pika::shared_future<common::internal::vector<T>>> taus);
+  static void call(comm::CommunicatorGrid grid,
+                   common::Pipeline<comm::Communicator>& mpi_row_task_chain,
+                   common::Pipeline<comm::Communicator>& mpi_col_task_chain, const SizeType b,
+                   Matrix<T, device>& mat_c, Matrix<const T, device>& mat_v,
+                   common::internal::vector<pika::shared_future<common::internal::vector<T>>> taus);
+};
+
+// Local back-transformation of the reduction to band, applied to C one block of tile columns at a
+// time (e.g. for pipelining it with the previous back-transformations).
+//
+// V and W = V T of all the panels of HH reflectors are computed once by the constructor and are reused
+// by all the calls. They are kept until the object is destroyed, which requires O(m^2) extra memory
+// (about m^2 elements for a m x n matrix C).
+template <Backend B, Device D, class T>
+class BackTransformationReductionToBandColumnBlocks {
+public:
+  BackTransformationReductionToBandColumnBlocks(
+      const SizeType b, Matrix<T, D>& mat_c, Matrix<const T, D>& mat_v,
+      common::internal::vector<pika::shared_future<common::internal::vector<T>>> taus);
+
+  // Apply the back-transformation to the tile columns [j_begin, j_end) of mat_c.
+  void call(const SizeType j_begin, const SizeType j_end);
+
+private:
+  SizeType b_;
+  SizeType group_size_ = 1;
+  Matrix<T, D>& mat_c_;
+  Matrix<const T, D>& mat_v_;
+  // V and W of the (groups of merged) panels of HH reflectors, in the order in which they are applied.
+  std::vector<matrix::Panel<Coord::Col, T, D>> panels_v_;
+  std::vector<matrix::Panel<Coord::Col, T, D>> panels_w_;
 };
 
 // ETI
-#define DLAF_EIGENSOLVER_BT_REDUCTION_TO_BAND_ETI(KWORD, BACKEND, DEVICE, DATATYPE) \
-  KWORD template struct BackTransformationReductionToBand<BACKEND, DEVICE, DATATYPE>;
+#define DLAF_EIGENSOLVER_BT_REDUCTION_TO_BAND_ETI(KWORD, BACKEND, DEVICE, DATATYPE)   \
+  KWORD template struct BackTransformationReductionToBand<BACKEND, DEVICE, DATATYPE>; \
+  KWORD template class BackTransformationReductionToBandColumnBlocks<BACKEND, DEVICE, DATATYPE>;
 
 DLAF_EIGENSOLVER_BT_REDUCTION_TO_BAND_ETI(extern, Backend::MC, Device::CPU, float)
 DLAF_EIGENSOLVER_BT_REDUCTION_TO_BAND_ETI(extern, Backend::MC, Device::CPU, double)
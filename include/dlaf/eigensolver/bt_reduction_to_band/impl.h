@@ -9,6 +9,10 @@
 //
 #pragma once
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include <pika/future.hpp>
 #include <pika/thread.hpp>
 
@@ -19,6 +23,7 @@
 #include <dlaf/blas/tile.h>
 #include <dlaf/common/index2d.h>
 #include <dlaf/common/pipeline.h>
+#include <dlaf/common/range2d.h>
 #include <dlaf/common/round_robin.h>
 #include <dlaf/common/single_threaded_blas.h>
 #include <dlaf/common/vector.h>
@@ -35,6 +40,8 @@
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/panel.h>
 #include <dlaf/matrix/views.h>
+#include <dlaf/tune.h>
+#include <dlaf/util_math.h>
 #include <dlaf/util_matrix.h>
 
 namespace dlaf::eigensolver::internal {
@@ -54,6 +61,13 @@ struct Helpers<Backend::MC> {
     lapack::laset(blas::Uplo::Upper, dst.size().rows(), dst.size().cols() - j_diag, T{0.}, T{1.},
                   dst.ptr({0, j_diag}), dst.ld());
   }
+
+  template <class T>
+  static void setHHUpperTile(SizeType j_diag, const matrix::Tile<T, Device::CPU>& tile) {
+    common::internal::SingleThreadedBlasScope single;
+    lapack::laset(blas::Uplo::Upper, tile.size().rows(), tile.size().cols() - j_diag, T{0.}, T{1.},
+                  tile.ptr({0, j_diag}), tile.ld());
+  }
 };
 
 #ifdef DLAF_WITH_GPU
@@ -66,6 +80,13 @@ struct Helpers<Backend::GPU> {
     gpulapack::laset(blas::Uplo::Upper, dst.size().rows(), dst.size().cols() - j_diag, T{0.}, T{1.},
                      dst.ptr({0, j_diag}), dst.ld(), stream);
   }
+
+  template <class T>
+  static void setHHUpperTile(SizeType j_diag, const matrix::Tile<T, Device::GPU>& tile,
+                             whip::stream_t stream) {
+    gpulapack::laset(blas::Uplo::Upper, tile.size().rows(), tile.size().cols() - j_diag, T{0.}, T{1.},
+                     tile.ptr({0, j_diag}), tile.ld(), stream);
+  }
 };
 #endif
 
@@ -80,6 +101,34 @@ void copyAndSetHHUpperTiles(SizeType j_diag, SrcSender&& src, DstSender&& dst) {
       dlaf::internal::whenAllLift(j_diag, std::forward<SrcSender>(src), std::forward<DstSender>(dst))));
 }
 
+template <Backend backend, typename TileSender>
+void setHHUpperTile(SizeType j_diag, TileSender&& tile) {
+  using ElementType = dlaf::internal::SenderElementType<TileSender>;
+
+  pika::execution::experimental::start_detached(dlaf::internal::transform(
+      dlaf::internal::Policy<backend>(pika::execution::thread_priority::high),
+      Helpers<backend>::template setHHUpperTile<ElementType>,
+      dlaf::internal::whenAllLift(j_diag, std::forward<TileSender>(tile))));
+}
+
+// Returns the concatenation of the taus of the given consecutive blocks of reflectors.
+template <class T>
+pika::shared_future<common::internal::vector<T>> mergeTaus(
+    std::vector<pika::shared_future<common::internal::vector<T>>> taus_blocks) {
+  namespace ex = pika::execution::experimental;
+  using common::internal::vector;
+
+  return ex::when_all_vector(std::move(taus_blocks)) |
+         ex::then([](std::vector<vector<T>>&& taus_blocks) {
+           vector<T> taus;
+           for (auto& taus_block : taus_blocks)
+             for (auto& tau : taus_block)
+               taus.emplace_back(std::move(tau));
+           return taus;
+         }) |
+         ex::make_future();
+}
+
 template <Backend backend, class TSender, class SourcePanelSender, class PanelTileSender>
 void trmmPanel(pika::execution::thread_priority priority, TSender&& t, SourcePanelSender&& v,
                PanelTileSender&& w) {
@@ -115,6 +164,246 @@ void gemmTrailingMatrix(pika::execution::thread_priority priority, PanelTileSend
                                   ElementType(1.0), std::forward<MatrixTileSender>(c)) |
       tile::gemm(dlaf::internal::Policy<backend>(priority)));
 }
+
+// Returns the number of HH reflectors of the (merged) panels [k_begin, k_end) of mb reflectors each.
+inline SizeType nrReflectors(const SizeType total_nr_reflector, const SizeType mb,
+                             const SizeType k_begin, const SizeType k_end) {
+  return std::min(k_end * mb, total_nr_reflector) - k_begin * mb;
+}
+
+// Sets up in panelV the k-th panel of HH reflectors stored in mat_v, and computes W = V T in panelW,
+// where T is computed in the tile k of panelT.
+template <Backend B, Device D, class T>
+void computePanelVW(const SizeType b, const SizeType k, Matrix<const T, D>& mat_v,
+                    pika::shared_future<common::internal::vector<T>> taus,
+                    matrix::Panel<Coord::Col, T, D>& panelV, matrix::Panel<Coord::Col, T, D>& panelW,
+                    matrix::Panel<Coord::Row, T, D>& panelT) {
+  auto np = pika::execution::thread_priority::normal;
+
+  const SizeType mb = mat_v.blockSize().rows();
+
+  // Note: "-1" added to deal with size 1 reflector.
+  const SizeType total_nr_reflector = mat_v.size().rows() - b - 1;
+  const SizeType nr_reflectors = nrReflectors(total_nr_reflector, mb, k, k + 1);
+
+  const GlobalElementIndex v_offset(k * mb + b, k * mb);
+  const matrix::SubPanelView panel_view(mat_v.distribution(), v_offset, nr_reflectors);
+
+  panelV.setRangeStart(v_offset);
+  panelW.setRangeStart(v_offset);
+
+  panelT.setHeight(nr_reflectors);
+  panelW.setWidth(nr_reflectors);
+  panelV.setWidth(nr_reflectors);
+
+  for (const auto& i : panel_view.iteratorLocal()) {
+    // Column index of the HH reflector which starts in the first row of this tile.
+    const SizeType j_diag = std::max<SizeType>(0, i.row() * mb - panel_view.offsetElement().row());
+
+    if (j_diag < nr_reflectors) {
+      auto tile_v = splitTile(mat_v.read(i), panel_view(i));
+      copyAndSetHHUpperTiles<B>(j_diag, std::move(tile_v), panelV.readwrite(i));
+    }
+    else if (j_diag < mb) {
+      panelV.setTile(i, splitTile(mat_v.read(i), panel_view(i)));
+    }
+    else {
+      panelV.setTile(i, mat_v.read(i));
+    }
+  }
+
+  const LocalTileIndex t_index{Coord::Col, k};
+  dlaf::factorization::internal::computeTFactor<B>(panelV, std::move(taus), panelT.readwrite(t_index));
+
+  // W = V T
+  auto tile_t = panelT.read(t_index);
+  for (const auto& idx : panelW.iteratorLocal()) {
+    trmmPanel<B>(np, tile_t, panelV.read(idx), panelW.readwrite(idx));
+  }
+}
+
+// Sets up in panelV the HH reflectors of the g-th group of group_size panels stored in mat_v, merged in
+// a single compact WY block (see applyMergedPanels), and computes W = V T in panelW, where T is computed
+// in the tile g of panelT (see distributionT).
+template <Backend B, Device D, class T>
+void computeMergedPanelsVW(
+    const SizeType b, const SizeType group_size, const SizeType g, Matrix<const T, D>& mat_v,
+    const common::internal::vector<pika::shared_future<common::internal::vector<T>>>& taus,
+    matrix::Panel<Coord::Col, T, D>& panelV, matrix::Panel<Coord::Col, T, D>& panelW,
+    matrix::Panel<Coord::Row, T, D>& panelT) {
+  namespace ex = pika::execution::experimental;
+
+  auto hp = pika::execution::thread_priority::high;
+  auto np = pika::execution::thread_priority::normal;
+
+  const SizeType mb = mat_v.blockSize().rows();
+
+  // Note: "-1" added to deal with size 1 reflector.
+  const SizeType total_nr_reflector = mat_v.size().rows() - b - 1;
+  const SizeType k_begin = g * group_size;
+  const SizeType k_end = std::min(k_begin + group_size, util::ceilDiv(total_nr_reflector, mb));
+  const SizeType nr_reflectors = nrReflectors(total_nr_reflector, mb, k_begin, k_end);
+
+  const GlobalElementIndex v_offset(k_begin * mb + b, k_begin * mb);
+  const matrix::SubPanelView panel_view(mat_v.distribution(), v_offset,
+                                        nrReflectors(total_nr_reflector, mb, k_begin, k_begin + 1));
+
+  panelV.setRangeStart(GlobalElementIndex(v_offset.row(), 0));
+  panelW.setRangeStart(GlobalElementIndex(v_offset.row(), 0));
+
+  panelT.setHeight(nr_reflectors);
+  panelV.setWidth(nr_reflectors);
+  panelW.setWidth(nr_reflectors);
+
+  // The reflectors of the different panels are stored in different tiles of mat_v, hence they are
+  // always copied into the workspace. The part above the diagonal of the merged block (which contains
+  // the R factors of the panels after the first one) is then set by laset.
+  for (const auto& i : panel_view.iteratorLocal()) {
+    const matrix::SubTileSpec spec = panel_view(i);
+
+    for (SizeType k = k_begin; k < k_end; ++k) {
+      const TileElementSize size(spec.size.rows(), nrReflectors(total_nr_reflector, mb, k, k + 1));
+      const matrix::SubTileSpec spec_v{{spec.origin.row(), 0}, size};
+      const matrix::SubTileSpec spec_panel{{0, (k - k_begin) * mb}, size};
+
+      ex::start_detached(
+          dlaf::internal::whenAllLift(splitTile(mat_v.read(LocalTileIndex(i.row(), k)), spec_v),
+                                      splitTile(panelV.readwrite(i), spec_panel)) |
+          matrix::copy(dlaf::internal::Policy<B>(hp)));
+    }
+
+    // Column index of the HH reflector which starts in the first row of this tile.
+    const SizeType j_diag = std::max<SizeType>(0, i.row() * mb - panel_view.offsetElement().row());
+
+    if (j_diag < nr_reflectors)
+      setHHUpperTile<B>(j_diag, panelV.readwrite(i));
+  }
+
+  std::vector<pika::shared_future<common::internal::vector<T>>> taus_blocks;
+  taus_blocks.reserve(to_sizet(k_end - k_begin));
+  for (SizeType k = k_begin; k < k_end; ++k)
+    taus_blocks.push_back(taus[k]);
+
+  const LocalTileIndex t_index{Coord::Col, g};
+  dlaf::factorization::internal::computeTFactor<B>(panelV, mergeTaus(std::move(taus_blocks)),
+                                                   panelT.readwrite(t_index));
+
+  // W = V T
+  auto tile_t = panelT.read(t_index);
+  for (const auto& idx : panelW.iteratorLocal()) {
+    trmmPanel<B>(np, tile_t, panelV.read(idx), panelW.readwrite(idx));
+  }
+}
+
+// Applies the block of nr_reflectors HH reflectors, i.e. V (panelV) and W = V T (panelW), whose first
+// reflector starts at the row c_row of C, to the tile columns [j_begin, j_end) of C, i.e.
+// C = C - V W2, with W2 = W* C.
+template <Backend B, Device D, class T>
+void applyPanelVW(const SizeType c_row, const SizeType nr_reflectors,
+                  matrix::Panel<Coord::Col, T, D>& panelV, matrix::Panel<Coord::Col, T, D>& panelW,
+                  matrix::Panel<Coord::Row, T, D>& panelW2, Matrix<T, D>& mat_c, const SizeType j_begin,
+                  const SizeType j_end) {
+  auto hp = pika::execution::thread_priority::high;
+  auto np = pika::execution::thread_priority::normal;
+
+  const SizeType m = mat_c.nrTiles().rows();
+
+  const matrix::SubMatrixView mat_c_view(mat_c.distribution(), GlobalElementIndex(c_row, 0));
+  const auto mat_c_range = common::iterate_range2d(LocalTileIndex(mat_c_view.begin().row(), j_begin),
+                                                   LocalTileIndex(m, j_end));
+
+  panelW2.setRange(GlobalTileIndex(Coord::Col, j_begin), GlobalTileIndex(Coord::Col, j_end));
+  panelW2.setHeight(nr_reflectors);
+
+  // W2 = W C
+  matrix::util::set0<B>(hp, panelW2);
+  for (const auto& ij : mat_c_range) {
+    gemmUpdateW2<B>(np, panelW.read(ij), splitTile(mat_c.read(ij), mat_c_view(ij)),
+                    panelW2.readwrite(ij));
+  }
+
+  // Update trailing matrix: C = C - V W2
+  for (const auto& ij : mat_c_range) {
+    gemmTrailingMatrix<B>(np, panelV.read(ij), panelW2.read(ij),
+                          splitTile(mat_c.readwrite(ij), mat_c_view(ij)));
+  }
+
+  panelW2.reset();
+}
+
+// Returns the distribution of the workspace W2 used by applyPanelVW with blocks of group_size merged
+// panels of HH reflectors.
+inline matrix::Distribution distributionW2(const matrix::Distribution& dist_c, const SizeType mb,
+                                           const SizeType group_size) {
+  const SizeType group_width = group_size * mb;
+  return {LocalElementSize(group_width, dist_c.size().cols()),
+          TileElementSize(group_width, dist_c.blockSize().cols())};
+}
+
+// Returns the distribution of the workspaces V and W used with blocks of group_size merged panels of
+// HH reflectors (see computeMergedPanelsVW).
+inline matrix::Distribution distributionMergedVW(const matrix::Distribution& dist_v,
+                                                 const SizeType group_size) {
+  const SizeType mb = dist_v.blockSize().rows();
+  const SizeType group_width = group_size * mb;
+  return {LocalElementSize(dist_v.size().rows(), group_width), TileElementSize(mb, group_width)};
+}
+
+// Returns the distribution of the workspace T used with blocks of group_size merged panels of HH
+// reflectors, in which the T factor of the g-th block is stored in the tile g.
+inline matrix::Distribution distributionT(const SizeType total_nr_reflector, const SizeType mb,
+                                          const SizeType group_size) {
+  const SizeType group_width = group_size * mb;
+  return {LocalElementSize(group_width, total_nr_reflector),
+          TileElementSize(group_width, group_width)};
+}
+
+// Local back-transformation in which the HH reflectors of merge_panels consecutive panels are merged
+// in a single compact WY block (V, T), such that C is updated with GEMMs of rank (merge_panels * mb)
+// instead of rank mb.
+// Note: the groups of panels are aligned to multiples of merge_panels, therefore only the last group
+// (i.e. the first one to be applied) can have fewer reflectors.
+template <Backend B, Device D, class T>
+void applyMergedPanels(
+    const SizeType merge_panels, const SizeType b, Matrix<T, D>& mat_c, Matrix<const T, D>& mat_v,
+    const common::internal::vector<pika::shared_future<common::internal::vector<T>>>& taus) {
+  const SizeType mb = mat_v.blockSize().rows();
+
+  // Note: "-1" added to deal with size 1 reflector.
+  const SizeType total_nr_reflector = mat_v.size().rows() - b - 1;
+  const SizeType nr_reflector_blocks = util::ceilDiv(total_nr_reflector, mb);
+
+  // The reflectors of a group are stored in a single tile column of V and W and in a single tile row of
+  // W2.
+  const SizeType group_size = std::min(merge_panels, nr_reflector_blocks);
+  const matrix::Distribution dist_vg = distributionMergedVW(mat_v.distribution(), group_size);
+  const matrix::Distribution dist_w2g = distributionW2(mat_c.distribution(), mb, group_size);
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panelsV(n_workspaces, dist_vg);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panelsW(n_workspaces, dist_vg);
+  common::RoundRobin<matrix::Panel<Coord::Row, T, D>> panelsW2(n_workspaces, dist_w2g);
+  matrix::Panel<Coord::Row, T, D> panelT(distributionT(total_nr_reflector, mb, group_size));
+
+  const SizeType nr_groups = util::ceilDiv(nr_reflector_blocks, group_size);
+
+  for (SizeType g = nr_groups - 1; g >= 0; --g) {
+    const SizeType k_begin = g * group_size;
+    const SizeType k_end = std::min(k_begin + group_size, nr_reflector_blocks);
+
+    auto& panelV = panelsV.nextResource();
+    auto& panelW = panelsW.nextResource();
+    auto& panelW2 = panelsW2.nextResource();
+
+    computeMergedPanelsVW<B>(b, group_size, g, mat_v, taus, panelV, panelW, panelT);
+    applyPanelVW<B>(k_begin * mb + b, nrReflectors(total_nr_reflector, mb, k_begin, k_end), panelV,
+                    panelW, panelW2, mat_c, 0, mat_c.nrTiles().cols());
+
+    panelV.reset();
+    panelW.reset();
+    panelT.reset();
+  }
+}
 }
 
 // Implementation based on:
@@ -126,9 +415,6 @@ void BackTransformationReductionToBand<backend, device, T>::call(
     common::internal::vector<pika::shared_future<common::internal::vector<T>>> taus) {
   using namespace bt_red_band;
 
-  auto hp = pika::execution::thread_priority::high;
-  auto np = pika::execution::thread_priority::normal;
-
   const SizeType m = mat_c.nrTiles().rows();
   const SizeType n = mat_c.nrTiles().cols();
   const SizeType mb = mat_v.blockSize().rows();
@@ -142,6 +428,12 @@ void BackTransformationReductionToBand<backend, device, T>::call(
   if (total_nr_reflector <= 0)
     return;
 
+  const SizeType merge_panels = getTuneParameters().bt_reduction_to_band_merge_panels;
+  if (merge_panels > 1 && total_nr_reflector > mb) {
+    applyMergedPanels<backend>(merge_panels, b, mat_c, mat_v, taus);
+    return;
+  }
+
   const auto dist_v = mat_v.distribution();
   const auto dist_c = mat_c.distribution();
 
@@ -156,91 +448,124 @@ void BackTransformationReductionToBand<backend, device, T>::call(
   const SizeType nr_reflector_blocks = dist_t.nrTiles().cols();
 
   for (SizeType k = nr_reflector_blocks - 1; k >= 0; --k) {
-    bool is_last = (k == nr_reflector_blocks - 1);
-    const SizeType nr_reflectors = dist_t.tileSize({0, k}).cols();
-
-    const GlobalElementIndex v_offset(k * mb + b, k * mb);
-    const GlobalElementIndex c_offset(k * mb + b, 0);
-
-    const matrix::SubPanelView panel_view(dist_v, v_offset, nr_reflectors);
-    const matrix::SubMatrixView mat_c_view(dist_c, c_offset);
-
     auto& panelV = panelsV.nextResource();
     auto& panelW = panelsW.nextResource();
     auto& panelW2 = panelsW2.nextResource();
 
-    panelV.setRangeStart(v_offset);
-    panelW.setRangeStart(v_offset);
+    computePanelVW<backend>(b, k, mat_v, taus[k], panelV, panelW, panelT);
+    applyPanelVW<backend>(k * mb + b, dist_t.tileSize({0, k}).cols(), panelV, panelW, panelW2, mat_c,
+                          0, n);
 
-    if (is_last) {
-      panelT.setHeight(nr_reflectors);
-      panelW2.setHeight(nr_reflectors);
-      panelW.setWidth(nr_reflectors);
-      panelV.setWidth(nr_reflectors);
-    }
+    panelV.reset();
+    panelW.reset();
+    panelT.reset();
+  }
+}
 
-    for (const auto& i : panel_view.iteratorLocal()) {
-      // Column index of the HH reflector which starts in the first row of this tile.
-      const SizeType j_diag =
-          std::max<SizeType>(0, i.row() * mat_v.blockSize().rows() - panel_view.offsetElement().row());
+template <Backend B, Device D, class T>
+BackTransformationReductionToBandColumnBlocks<B, D, T>::BackTransformationReductionToBandColumnBlocks(
+    const SizeType b, Matrix<T, D>& mat_c, Matrix<const T, D>& mat_v,
+    common::internal::vector<pika::shared_future<common::internal::vector<T>>> taus)
+    : b_(b), mat_c_(mat_c), mat_v_(mat_v) {
+  using namespace bt_red_band;
 
-      if (j_diag < nr_reflectors) {
-        auto tile_v = splitTile(mat_v.read(i), panel_view(i));
-        copyAndSetHHUpperTiles<backend>(j_diag, std::move(tile_v), panelV.readwrite(i));
-      }
-      else if (j_diag < mb) {
-        panelV.setTile(i, splitTile(mat_v.read(i), panel_view(i)));
-      }
-      else {
-        panelV.setTile(i, mat_v.read(i));
-      }
-    }
+  const SizeType mb = mat_v.blockSize().rows();
 
-    auto taus_panel = taus[k];
-    const LocalTileIndex t_index{Coord::Col, k};
-    dlaf::factorization::internal::computeTFactor<backend>(panelV, taus_panel,
-                                                           panelT.readwrite(t_index));
+  if (mat_c.size().isEmpty())
+    return;
 
-    // W = V T
-    auto tile_t = panelT.read(t_index);
-    for (const auto& idx : panelW.iteratorLocal()) {
-      trmmPanel<backend>(np, tile_t, panelV.read(idx), panelW.readwrite(idx));
-    }
+  // Note: "-1" added to deal with size 1 reflector.
+  const SizeType total_nr_reflector = mat_v.size().rows() - b - 1;
 
-    // W2 = W C
-    matrix::util::set0<backend>(hp, panelW2);
-    for (const auto& ij : mat_c_view.iteratorLocal()) {
-      gemmUpdateW2<backend>(np, panelW.read(ij), splitTile(mat_c.read(ij), mat_c_view(ij)),
-                            panelW2.readwrite(ij));
-    }
+  if (total_nr_reflector <= 0)
+    return;
 
-    // Update trailing matrix: C = C - V W2
-    for (const auto& ij : mat_c_view.iteratorLocal()) {
-      gemmTrailingMatrix<backend>(np, panelV.read(ij), panelW2.read(ij),
-                                  splitTile(mat_c.readwrite(ij), mat_c_view(ij)));
-    }
+  const SizeType nr_reflector_blocks = util::ceilDiv(total_nr_reflector, mb);
+  const SizeType merge_panels = getTuneParameters().bt_reduction_to_band_merge_panels;
+  if (merge_panels > 1 && total_nr_reflector > mb)
+    group_size_ = std::min(merge_panels, nr_reflector_blocks);
 
-    panelV.reset();
-    panelW.reset();
-    panelW2.reset();
+  const matrix::Distribution dist_vg = distributionMergedVW(mat_v.distribution(), group_size_);
+  matrix::Panel<Coord::Row, T, D> panelT(distributionT(total_nr_reflector, mb, group_size_));
+
+  const SizeType nr_groups = util::ceilDiv(nr_reflector_blocks, group_size_);
+  panels_v_.reserve(to_sizet(nr_groups));
+  panels_w_.reserve(to_sizet(nr_groups));
+
+  // Note: V and W are allocated just from the first tile row they use.
+  for (SizeType g = nr_groups - 1; g >= 0; --g) {
+    const SizeType k_begin = g * group_size_;
+    const GlobalTileIndex start(dist_vg.globalTileIndex(GlobalElementIndex(k_begin * mb + b, 0)));
+
+    auto& panelV = panels_v_.emplace_back(dist_vg, start);
+    auto& panelW = panels_w_.emplace_back(dist_vg, start);
+
+    if (group_size_ > 1)
+      computeMergedPanelsVW<B>(b, group_size_, g, mat_v, taus, panelV, panelW, panelT);
+    else
+      computePanelVW<B>(b, k_begin, mat_v, taus[k_begin], panelV, panelW, panelT);
     panelT.reset();
   }
 }
 
+template <Backend B, Device D, class T>
+void BackTransformationReductionToBandColumnBlocks<B, D, T>::call(const SizeType j_begin,
+                                                                 const SizeType j_end) {
+  using namespace bt_red_band;
+
+  DLAF_ASSERT(0 <= j_begin && j_begin <= j_end && j_end <= mat_c_.nrTiles().cols(), j_begin, j_end,
+              mat_c_.nrTiles().cols());
+
+  if (panels_v_.empty() || j_begin == j_end)
+    return;
+
+  const SizeType b = b_;
+  const SizeType mb = mat_v_.blockSize().rows();
+
+  // Note: "-1" added to deal with size 1 reflector.
+  const SizeType total_nr_reflector = mat_v_.size().rows() - b - 1;
+  const SizeType nr_reflector_blocks = util::ceilDiv(total_nr_reflector, mb);
+  const SizeType nr_groups = util::ceilDiv(nr_reflector_blocks, group_size_);
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Row, T, D>> panelsW2(
+      n_workspaces, distributionW2(mat_c_.distribution(), mb, group_size_));
+
+  // Note: V and W are stored in panels_v_ and panels_w_ in the same order they are applied here.
+  for (std::size_t index = 0; index < panels_v_.size(); ++index) {
+    const SizeType g = nr_groups - 1 - to_SizeType(index);
+    const SizeType k_begin = g * group_size_;
+    const SizeType k_end = std::min(k_begin + group_size_, nr_reflector_blocks);
+
+    applyPanelVW<B>(k_begin * mb + b, nrReflectors(total_nr_reflector, mb, k_begin, k_end),
+                    panels_v_[index], panels_w_[index], panelsW2.nextResource(), mat_c_, j_begin,
+                    j_end);
+  }
+}
+
 template <Backend B, Device D, class T>
 void BackTransformationReductionToBand<B, D, T>::call(
     comm::CommunicatorGrid grid, const SizeType b, Matrix<T, D>& mat_c, Matrix<const T, D>& mat_v,
     common::internal::vector<pika::shared_future<common::internal::vector<T>>> taus) {
+  // Set up MPI
+  common::Pipeline<comm::Communicator> mpi_row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_col_task_chain(grid.colCommunicator().clone());
+
+  call(grid, mpi_row_task_chain, mpi_col_task_chain, b, mat_c, mat_v, std::move(taus));
+}
+
+template <Backend B, Device D, class T>
+void BackTransformationReductionToBand<B, D, T>::call(
+    comm::CommunicatorGrid grid, common::Pipeline<comm::Communicator>& mpi_row_task_chain,
+    common::Pipeline<comm::Communicator>& mpi_col_task_chain, const SizeType b, Matrix<T, D>& mat_c,
+    Matrix<const T, D>& mat_v,
+    common::internal::vector<pika::shared_future<common::internal::vector<T>>> taus) {
   namespace ex = pika::execution::experimental;
   using namespace bt_red_band;
 
   auto hp = pika::execution::thread_priority::high;
   auto np = pika::execution::thread_priority::normal;
 
-  // Set up MPI
-  common::Pipeline<comm::Communicator> mpi_col_task_chain(grid.colCommunicator().clone());
-  common::Pipeline<comm::Communicator> mpi_row_task_chain(grid.rowCommunicator().clone());
-
   auto dist_v = mat_v.distribution();
   auto dist_c = mat_c.distribution();
 
@@ -134,4 +134,387 @@ EigensolverResult<T, D> eigensolver(comm::CommunicatorGrid grid, blas::Uplo uplo
   eigensolver<B, D, T>(grid, uplo, mat, eigenvalues, eigenvectors);
   return {std::move(eigenvalues), std::move(eigenvectors)};
 }
+
+/// Standard Eigensolver.
+///
+/// It solves the standard eigenvalue problem A * x = lambda * x, re-using the workspaces owned by
+/// @p plan instead of allocating them at each call.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed. @p eigenvalues will contain all the eigenvalues
+/// lambda, while @p eigenvectors will contain all the corresponding eigenvectors x.
+///
+/// Implementation on local memory.
+///
+/// @param plan is a local plan created for the distribution of @p eigenvectors
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+/// @param eigenvectors is a N x N matrix which on output contains the eigenvectors
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvectors are ready (see EigensolverReport)
+template <Backend B, Device D, class T>
+void eigensolver(EigensolverPlan<T, D>& plan, blas::Uplo uplo, Matrix<T, D>& mat,
+                 Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
+                 EigensolverReport* report = nullptr) {
+  DLAF_ASSERT(!plan.isDistributed(), plan.isDistributed());
+  DLAF_ASSERT(plan.isCompatible(eigenvectors.distribution()), eigenvectors);
+  DLAF_ASSERT(matrix::local_matrix(mat), mat);
+  DLAF_ASSERT(square_size(mat), mat);
+  DLAF_ASSERT(square_blocksize(mat), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.size().rows() == eigenvectors.size().rows(), eigenvalues, eigenvectors);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == eigenvectors.blockSize().rows(), eigenvalues,
+              eigenvectors);
+  DLAF_ASSERT(matrix::local_matrix(eigenvectors), eigenvectors);
+  DLAF_ASSERT(square_size(eigenvectors), eigenvectors);
+  DLAF_ASSERT(square_blocksize(eigenvectors), eigenvectors);
+  DLAF_ASSERT(eigenvectors.size() == mat.size(), eigenvectors, mat);
+  DLAF_ASSERT(eigenvectors.blockSize() == mat.blockSize(), eigenvectors, mat);
+
+  internal::Eigensolver<B, D, T>::call(plan, uplo, mat, eigenvalues, eigenvectors, report);
+}
+
+/// Standard Eigensolver.
+///
+/// It solves the standard eigenvalue problem A * x = lambda * x, re-using the workspaces and the
+/// communicator pipelines owned by @p plan instead of creating them at each call.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed. @p eigenvalues will contain all the eigenvalues
+/// lambda, while @p eigenvectors will contain all the corresponding eigenvectors x.
+///
+/// Implementation on distributed memory.
+///
+/// @param grid is the communicator grid on which the matrix @p mat has been distributed,
+/// @param plan is a distributed plan created on @p grid for the distribution of @p eigenvectors
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+/// @param eigenvectors is a N x N matrix which on output contains the eigenvectors
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvectors are ready (see EigensolverReport)
+template <Backend B, Device D, class T>
+void eigensolver(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan, blas::Uplo uplo,
+                 Matrix<T, D>& mat, Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
+                 EigensolverReport* report = nullptr) {
+  DLAF_ASSERT(plan.isDistributed(), plan.isDistributed());
+  DLAF_ASSERT(plan.isCompatible(eigenvectors.distribution()), eigenvectors);
+  DLAF_ASSERT(matrix::equal_process_grid(mat, grid), mat);
+  DLAF_ASSERT(square_size(mat), mat);
+  DLAF_ASSERT(square_blocksize(mat), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.size().rows() == eigenvectors.size().rows(), eigenvalues, eigenvectors);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == eigenvectors.blockSize().rows(), eigenvalues,
+              eigenvectors);
+  DLAF_ASSERT(matrix::equal_process_grid(eigenvectors, grid), eigenvectors);
+  DLAF_ASSERT(square_size(eigenvectors), eigenvectors);
+  DLAF_ASSERT(square_blocksize(eigenvectors), eigenvectors);
+  DLAF_ASSERT(eigenvectors.size() == mat.size(), eigenvectors, mat);
+  DLAF_ASSERT(eigenvectors.blockSize() == mat.blockSize(), eigenvectors, mat);
+
+  internal::Eigensolver<B, D, T>::call(grid, plan, uplo, mat, eigenvalues, eigenvectors, report);
+}
+
+/// Standard Eigensolver (subset of the spectrum).
+///
+/// It solves the standard eigenvalue problem A * x = lambda * x, computing just the eigenvectors
+/// corresponding to the eigenvalues with indices in the range [@p eval_idx_begin, @p eval_idx_end),
+/// where eigenvalues are sorted in ascending order.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed. @p eigenvalues will contain all the eigenvalues
+/// lambda, while the j-th column of @p eigenvectors will contain the eigenvector corresponding to
+/// the eigenvalue with index @p eval_idx_begin + j.
+///
+/// Implementation on local memory.
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+/// @param eigenvectors is a N x K matrix which on output contains the requested eigenvectors,
+///        where K = @p eval_idx_end - @p eval_idx_begin
+/// @param eval_idx_begin is the index of the first requested eigenvalue
+/// @param eval_idx_end is the index of the last requested eigenvalue plus one
+/// @pre 0 <= @p eval_idx_begin <= @p eval_idx_end <= N
+template <Backend B, Device D, class T>
+void eigensolver(blas::Uplo uplo, Matrix<T, D>& mat, Matrix<BaseType<T>, D>& eigenvalues,
+                 Matrix<T, D>& eigenvectors, const SizeType eval_idx_begin,
+                 const SizeType eval_idx_end) {
+  DLAF_ASSERT(matrix::local_matrix(mat), mat);
+  DLAF_ASSERT(square_size(mat), mat);
+  DLAF_ASSERT(square_blocksize(mat), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.size().rows() == mat.size().rows(), eigenvalues, mat);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat.blockSize().rows(), eigenvalues, mat);
+  DLAF_ASSERT(0 <= eval_idx_begin && eval_idx_begin <= eval_idx_end &&
+                  eval_idx_end <= mat.size().rows(),
+              eval_idx_begin, eval_idx_end, mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvectors), eigenvectors);
+  DLAF_ASSERT(eigenvectors.size() ==
+                  GlobalElementSize(mat.size().rows(), eval_idx_end - eval_idx_begin),
+              eigenvectors, mat, eval_idx_begin, eval_idx_end);
+  DLAF_ASSERT(eigenvectors.blockSize() == mat.blockSize(), eigenvectors, mat);
+
+  internal::Eigensolver<B, D, T>::call(uplo, mat, eigenvalues, eigenvectors, eval_idx_begin,
+                                       eval_idx_end);
+}
+
+/// Standard Eigensolver (subset of the spectrum).
+///
+/// It solves the standard eigenvalue problem A * x = lambda * x, computing just the eigenvectors
+/// corresponding to the eigenvalues with indices in the range [@p eval_idx_begin, @p eval_idx_end),
+/// where eigenvalues are sorted in ascending order.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+///
+/// Implementation on local memory.
+///
+/// @return struct ReturnEigensolverType with all the eigenvalues, and the requested eigenvectors as a
+/// N x (@p eval_idx_end - @p eval_idx_begin) Matrix
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eval_idx_begin is the index of the first requested eigenvalue
+/// @param eval_idx_end is the index of the last requested eigenvalue plus one
+/// @pre 0 <= @p eval_idx_begin <= @p eval_idx_end <= N
+template <Backend B, Device D, class T>
+EigensolverResult<T, D> eigensolver(blas::Uplo uplo, Matrix<T, D>& mat, const SizeType eval_idx_begin,
+                                    const SizeType eval_idx_end) {
+  const SizeType size = mat.size().rows();
+  matrix::Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(size, 1),
+                                             TileElementSize(mat.blockSize().rows(), 1));
+  matrix::Matrix<T, D> eigenvectors(LocalElementSize(size, eval_idx_end - eval_idx_begin),
+                                    mat.blockSize());
+
+  eigensolver<B, D, T>(uplo, mat, eigenvalues, eigenvectors, eval_idx_begin, eval_idx_end);
+  return {std::move(eigenvalues), std::move(eigenvectors)};
+}
+
+/// Standard Eigensolver (subset of the spectrum).
+///
+/// It solves the standard eigenvalue problem A * x = lambda * x, computing just the eigenvectors
+/// corresponding to the eigenvalues with indices in the range [@p eval_idx_begin, @p eval_idx_end),
+/// where eigenvalues are sorted in ascending order.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed. @p eigenvalues will contain all the eigenvalues
+/// lambda, while the j-th column of @p eigenvectors will contain the eigenvector corresponding to
+/// the eigenvalue with index @p eval_idx_begin + j.
+///
+/// Implementation on distributed memory.
+///
+/// @param grid is the communicator grid on which the matrix @p mat has been distributed,
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+/// @param eigenvectors is a N x K matrix which on output contains the requested eigenvectors,
+///        where K = @p eval_idx_end - @p eval_idx_begin
+/// @param eval_idx_begin is the index of the first requested eigenvalue
+/// @param eval_idx_end is the index of the last requested eigenvalue plus one
+/// @pre 0 <= @p eval_idx_begin <= @p eval_idx_end <= N
+template <Backend B, Device D, class T>
+void eigensolver(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat,
+                 Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
+                 const SizeType eval_idx_begin, const SizeType eval_idx_end) {
+  DLAF_ASSERT(matrix::equal_process_grid(mat, grid), mat);
+  DLAF_ASSERT(square_size(mat), mat);
+  DLAF_ASSERT(square_blocksize(mat), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.size().rows() == mat.size().rows(), eigenvalues, mat);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat.blockSize().rows(), eigenvalues, mat);
+  DLAF_ASSERT(0 <= eval_idx_begin && eval_idx_begin <= eval_idx_end &&
+                  eval_idx_end <= mat.size().rows(),
+              eval_idx_begin, eval_idx_end, mat);
+  DLAF_ASSERT(matrix::equal_process_grid(eigenvectors, grid), eigenvectors);
+  DLAF_ASSERT(eigenvectors.size() ==
+                  GlobalElementSize(mat.size().rows(), eval_idx_end - eval_idx_begin),
+              eigenvectors, mat, eval_idx_begin, eval_idx_end);
+  DLAF_ASSERT(eigenvectors.blockSize() == mat.blockSize(), eigenvectors, mat);
+
+  internal::Eigensolver<B, D, T>::call(grid, uplo, mat, eigenvalues, eigenvectors, eval_idx_begin,
+                                       eval_idx_end);
+}
+
+/// Standard Eigensolver (subset of the spectrum).
+///
+/// Same as the overload without @p plan, but the N x N matrices needed by the D&C tridiagonal
+/// eigensolver (used when the requested subset is large) are owned by @p plan and re-used by all the
+/// calls executed with it.
+///
+/// Implementation on local memory.
+///
+/// @param plan is a local plan created for the distribution of @p mat
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+/// @param eigenvectors is a N x K matrix which on output contains the requested eigenvectors,
+///        where K = @p eval_idx_end - @p eval_idx_begin
+/// @param eval_idx_begin is the index of the first requested eigenvalue
+/// @param eval_idx_end is the index of the last requested eigenvalue plus one
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvectors are ready (see EigensolverReport)
+/// @pre 0 <= @p eval_idx_begin <= @p eval_idx_end <= N
+template <Backend B, Device D, class T>
+void eigensolver(EigensolverPlan<T, D>& plan, blas::Uplo uplo, Matrix<T, D>& mat,
+                 Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
+                 const SizeType eval_idx_begin, const SizeType eval_idx_end,
+                 EigensolverReport* report = nullptr) {
+  DLAF_ASSERT(!plan.isDistributed(), plan.isDistributed());
+  DLAF_ASSERT(plan.isCompatible(mat.distribution()), mat);
+  DLAF_ASSERT(matrix::local_matrix(mat), mat);
+  DLAF_ASSERT(square_size(mat), mat);
+  DLAF_ASSERT(square_blocksize(mat), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.size().rows() == mat.size().rows(), eigenvalues, mat);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat.blockSize().rows(), eigenvalues, mat);
+  DLAF_ASSERT(0 <= eval_idx_begin && eval_idx_begin <= eval_idx_end &&
+                  eval_idx_end <= mat.size().rows(),
+              eval_idx_begin, eval_idx_end, mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvectors), eigenvectors);
+  DLAF_ASSERT(eigenvectors.size() ==
+                  GlobalElementSize(mat.size().rows(), eval_idx_end - eval_idx_begin),
+              eigenvectors, mat, eval_idx_begin, eval_idx_end);
+  DLAF_ASSERT(eigenvectors.blockSize() == mat.blockSize(), eigenvectors, mat);
+
+  internal::Eigensolver<B, D, T>::call(plan, uplo, mat, eigenvalues, eigenvectors, eval_idx_begin,
+                                       eval_idx_end, report);
+}
+
+/// Standard Eigensolver (subset of the spectrum).
+///
+/// Same as the overload without @p plan, but the N x N matrices needed by the D&C tridiagonal
+/// eigensolver (used when the requested subset is large) and the communicator pipelines are owned by
+/// @p plan and re-used by all the calls executed with it.
+///
+/// Implementation on distributed memory.
+///
+/// @param grid is the communicator grid on which the matrix @p mat has been distributed,
+/// @param plan is a distributed plan created on @p grid for the distribution of @p mat
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+/// @param eigenvectors is a N x K matrix which on output contains the requested eigenvectors,
+///        where K = @p eval_idx_end - @p eval_idx_begin
+/// @param eval_idx_begin is the index of the first requested eigenvalue
+/// @param eval_idx_end is the index of the last requested eigenvalue plus one
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvectors are ready (see EigensolverReport)
+/// @pre 0 <= @p eval_idx_begin <= @p eval_idx_end <= N
+template <Backend B, Device D, class T>
+void eigensolver(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan, blas::Uplo uplo,
+                 Matrix<T, D>& mat, Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
+                 const SizeType eval_idx_begin, const SizeType eval_idx_end,
+                 EigensolverReport* report = nullptr) {
+  DLAF_ASSERT(plan.isDistributed(), plan.isDistributed());
+  DLAF_ASSERT(plan.isCompatible(mat.distribution()), mat);
+  DLAF_ASSERT(matrix::equal_process_grid(mat, grid), mat);
+  DLAF_ASSERT(square_size(mat), mat);
+  DLAF_ASSERT(square_blocksize(mat), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.size().rows() == mat.size().rows(), eigenvalues, mat);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat.blockSize().rows(), eigenvalues, mat);
+  DLAF_ASSERT(0 <= eval_idx_begin && eval_idx_begin <= eval_idx_end &&
+                  eval_idx_end <= mat.size().rows(),
+              eval_idx_begin, eval_idx_end, mat);
+  DLAF_ASSERT(matrix::equal_process_grid(eigenvectors, grid), eigenvectors);
+  DLAF_ASSERT(eigenvectors.size() ==
+                  GlobalElementSize(mat.size().rows(), eval_idx_end - eval_idx_begin),
+              eigenvectors, mat, eval_idx_begin, eval_idx_end);
+  DLAF_ASSERT(eigenvectors.blockSize() == mat.blockSize(), eigenvectors, mat);
+
+  internal::Eigensolver<B, D, T>::call(grid, plan, uplo, mat, eigenvalues, eigenvectors,
+                                       eval_idx_begin, eval_idx_end, report);
+}
+
+/// Standard Eigensolver (subset of the spectrum).
+///
+/// It solves the standard eigenvalue problem A * x = lambda * x, computing just the eigenvectors
+/// corresponding to the eigenvalues with indices in the range [@p eval_idx_begin, @p eval_idx_end),
+/// where eigenvalues are sorted in ascending order.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+///
+/// Implementation on distributed memory.
+///
+/// @return struct ReturnEigensolverType with all the eigenvalues, and the requested eigenvectors as a
+/// N x (@p eval_idx_end - @p eval_idx_begin) Matrix
+/// @param grid is the communicator grid on which the matrix @p mat has been distributed,
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eval_idx_begin is the index of the first requested eigenvalue
+/// @param eval_idx_end is the index of the last requested eigenvalue plus one
+/// @pre 0 <= @p eval_idx_begin <= @p eval_idx_end <= N
+template <Backend B, Device D, class T>
+EigensolverResult<T, D> eigensolver(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat,
+                                    const SizeType eval_idx_begin, const SizeType eval_idx_end) {
+  const SizeType size = mat.size().rows();
+  matrix::Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(size, 1),
+                                             TileElementSize(mat.blockSize().rows(), 1));
+  matrix::Matrix<T, D> eigenvectors(GlobalElementSize(size, eval_idx_end - eval_idx_begin),
+                                    mat.blockSize(), grid);
+
+  eigensolver<B, D, T>(grid, uplo, mat, eigenvalues, eigenvectors, eval_idx_begin, eval_idx_end);
+  return {std::move(eigenvalues), std::move(eigenvectors)};
+}
+
+/// Standard Eigensolver (eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the standard eigenvalue problem A * x = lambda * x,
+/// without computing any eigenvector.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed. @p eigenvalues will contain all the eigenvalues
+/// lambda in ascending order.
+///
+/// Implementation on local memory.
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvalues are ready (see EigensolverReport)
+template <Backend B, Device D, class T>
+void eigensolver(blas::Uplo uplo, Matrix<T, D>& mat, Matrix<BaseType<T>, D>& eigenvalues,
+                 EigensolverReport* report = nullptr) {
+  DLAF_ASSERT(matrix::local_matrix(mat), mat);
+  DLAF_ASSERT(square_size(mat), mat);
+  DLAF_ASSERT(square_blocksize(mat), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.size() == GlobalElementSize(mat.size().rows(), 1), eigenvalues, mat);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat.blockSize().rows(), eigenvalues, mat);
+
+  internal::Eigensolver<B, D, T>::call(uplo, mat, eigenvalues, report);
+}
+
+/// Standard Eigensolver (eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the standard eigenvalue problem A * x = lambda * x,
+/// without computing any eigenvector.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed. @p eigenvalues will contain all the eigenvalues
+/// lambda in ascending order.
+///
+/// Implementation on distributed memory.
+///
+/// @param grid is the communicator grid on which the matrix @p mat has been distributed,
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+/// @param mat contains the Hermitian matrix A
+/// @param eigenvalues is a N x 1 local matrix which on output contains the eigenvalues
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvalues are ready (see EigensolverReport)
+template <Backend B, Device D, class T>
+void eigensolver(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat,
+                 Matrix<BaseType<T>, D>& eigenvalues, EigensolverReport* report = nullptr) {
+  DLAF_ASSERT(matrix::equal_process_grid(mat, grid), mat);
+  DLAF_ASSERT(square_size(mat), mat);
+  DLAF_ASSERT(square_blocksize(mat), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.size() == GlobalElementSize(mat.size().rows(), 1), eigenvalues, mat);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat.blockSize().rows(), eigenvalues, mat);
+
+  internal::Eigensolver<B, D, T>::call(grid, uplo, mat, eigenvalues, report);
+}
 }
@@ -10,9 +10,19 @@
 
 #pragma once
 
+#include <cstddef>
+#include <optional>
+
 #include <dlaf/blas/tile.h>
+#include <dlaf/common/pipeline.h>
 #include <dlaf/common/vector.h>
+#include <dlaf/communication/communicator.h>
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/eigensolver/eigensolver/report.h>
+#include <dlaf/eigensolver/internal/get_tridiag_memory_mode.h>
+#include <dlaf/eigensolver/tridiag_solver/memory_mode.h>
+#include <dlaf/eigensolver/tridiag_solver/workspace.h>
+#include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/types.h>
 
@@ -24,14 +34,174 @@ struct EigensolverResult {
   Matrix<T, D> eigenvectors;
 };
 
+/// Reusable state of the standard eigensolver.
+///
+/// It owns the workspaces of the tridiagonal eigensolver and, for the distributed implementation, the
+/// communicator pipelines, so that they are allocated (resp. duplicated) just once and then re-used by
+/// all the eigensolver calls executed with the plan (e.g. in a self-consistent loop).
+/// The pipelines are used by all the stages of the distributed eigensolver, with the exception of the
+/// communicators used for the messages matched just via tags (band to tridiagonal and its
+/// back-transformation), which are still duplicated by each call.
+///
+/// Note: the Householder reflectors (and their taus) computed by the reduction stages are outputs of
+/// each call, hence they are not owned by the plan, as well as the panel workspaces of the other
+/// stages, whose size is O(N x nb).
+///
+/// A plan can be used just with eigenvector matrices having the distribution it has been created with
+/// or, when just a subset of the eigenvectors is computed, with matrices A having such distribution.
+/// Calls executed with the same plan are serialized by the dependencies on the workspaces.
+///
+/// The workspaces are allocated on first use, so that a plan used just with tridiagonal solvers which
+/// do not need them (e.g. MRRR for small subsets of the spectrum) does not allocate any n x n matrix.
+template <class T, Device D>
+class EigensolverPlan {
+public:
+  /// Create a plan for the local eigensolver.
+  ///
+  /// @param dist_evecs is the distribution of the N x N eigenvector matrix,
+  /// @param tridiag_mode is the memory mode of the tridiagonal eigensolver (see TridiagMemoryMode).
+  EigensolverPlan(const matrix::Distribution& dist_evecs,
+                  const TridiagMemoryMode tridiag_mode = internal::getTridiagMemoryMode())
+      : distributed_(false), dist_evecs_(dist_evecs), tridiag_mode_(tridiag_mode),
+        full_task_chain_(comm::Communicator()), row_task_chain_(comm::Communicator()),
+        col_task_chain_(comm::Communicator()), col_panel_task_chain_(comm::Communicator()) {}
+
+  /// Create a plan for the distributed eigensolver.
+  ///
+  /// The distributed tridiagonal eigensolver always uses TridiagMemoryMode::Standard.
+  ///
+  /// @param grid is the communicator grid on which the matrices are distributed,
+  /// @param dist_evecs is the distribution of the N x N eigenvector matrix.
+  EigensolverPlan(comm::CommunicatorGrid grid, const matrix::Distribution& dist_evecs)
+      : distributed_(true), dist_evecs_(dist_evecs), tridiag_mode_(TridiagMemoryMode::Standard),
+        full_task_chain_(grid.fullCommunicator().clone()),
+        row_task_chain_(grid.rowCommunicator().clone()),
+        col_task_chain_(grid.colCommunicator().clone()),
+        col_panel_task_chain_(grid.colCommunicator().clone()) {}
+
+  EigensolverPlan(const EigensolverPlan&) = delete;
+  EigensolverPlan(EigensolverPlan&&) = default;
+  EigensolverPlan& operator=(const EigensolverPlan&) = delete;
+  EigensolverPlan& operator=(EigensolverPlan&&) = default;
+
+  bool isDistributed() const noexcept {
+    return distributed_;
+  }
+
+  const matrix::Distribution& distribution() const noexcept {
+    return dist_evecs_;
+  }
+
+  /// Return true if the plan can be used with eigenvectors distributed as @p dist.
+  bool isCompatible(const matrix::Distribution& dist) const noexcept {
+    return dist == dist_evecs_;
+  }
+
+  TridiagMemoryMode tridiagMemoryMode() const noexcept {
+    return tridiag_mode_;
+  }
+
+  /// Return the peak memory (in bytes) allocated on this rank by the tridiagonal eigensolver stage,
+  /// including the workspaces owned by the plan.
+  std::size_t tridiagPeakMemoryBytes() const noexcept {
+    return internal::TridiagSolverWorkSpaces<BaseType<T>, D>::peakMemoryBytes(
+        dist_evecs_, distributed_, isComplex_v<T>, tridiag_mode_);
+  }
+
+  internal::TridiagSolverWorkSpaces<BaseType<T>, D>& tridiagWorkSpaces() {
+    if (!tridiag_ws_)
+      tridiag_ws_.emplace(dist_evecs_, distributed_, isComplex_v<T>, tridiag_mode_);
+    return *tridiag_ws_;
+  }
+
+  /// Return the real N x N matrix used to store all the eigenvectors of the tridiagonal matrix when
+  /// just a subset of them is requested by the caller.
+  ///
+  /// For complex types it is the auxiliary real eigenvector matrix of the tridiagonal workspaces.
+  Matrix<BaseType<T>, D>& tridiagEigenvectors() {
+    if constexpr (isComplex_v<T>) {
+      return tridiagWorkSpaces().real_evecs;
+    }
+    else {
+      if (!tridiag_evecs_)
+        tridiag_evecs_.emplace(dist_evecs_);
+      return *tridiag_evecs_;
+    }
+  }
+
+  common::Pipeline<comm::Communicator>& fullTaskChain() noexcept {
+    return full_task_chain_;
+  }
+  common::Pipeline<comm::Communicator>& rowTaskChain() noexcept {
+    return row_task_chain_;
+  }
+  common::Pipeline<comm::Communicator>& colTaskChain() noexcept {
+    return col_task_chain_;
+  }
+  /// Return the column pipeline reserved to the panel computations of the reduction to band, which
+  /// have to be independent from the ones of colTaskChain().
+  common::Pipeline<comm::Communicator>& colPanelTaskChain() noexcept {
+    return col_panel_task_chain_;
+  }
+
+private:
+  bool distributed_;
+  matrix::Distribution dist_evecs_;
+  TridiagMemoryMode tridiag_mode_;
+
+  std::optional<internal::TridiagSolverWorkSpaces<BaseType<T>, D>> tridiag_ws_;
+  std::optional<Matrix<BaseType<T>, D>> tridiag_evecs_;
+
+  common::Pipeline<comm::Communicator> full_task_chain_;
+  common::Pipeline<comm::Communicator> row_task_chain_;
+  common::Pipeline<comm::Communicator> col_task_chain_;
+  common::Pipeline<comm::Communicator> col_panel_task_chain_;
+};
+
 namespace internal {
 
 template <Backend B, Device D, class T>
 struct Eigensolver {
+  static void call(EigensolverPlan<T, D>& plan, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                   Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                   EigensolverReport* report = nullptr);
+  static void call(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan, blas::Uplo uplo,
+                   Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                   EigensolverReport* report = nullptr);
+
+  // Same as the overloads above, but the stages are added to @p recorder, which is not finished.
+  static void call(EigensolverPlan<T, D>& plan, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                   Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                   EigensolverReportRecorder& recorder);
+  static void call(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan, blas::Uplo uplo,
+                   Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                   EigensolverReportRecorder& recorder);
+
   static void call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
                    Matrix<T, D>& mat_e);
   static void call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
                    Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e);
+
+  static void call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                   Matrix<T, D>& mat_e, SizeType eval_idx_begin, SizeType eval_idx_end);
+  static void call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                   Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e, SizeType eval_idx_begin,
+                   SizeType eval_idx_end);
+  static void call(EigensolverPlan<T, D>& plan, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                   Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e, SizeType eval_idx_begin,
+                   SizeType eval_idx_end, EigensolverReport* report = nullptr);
+  static void call(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan, blas::Uplo uplo,
+                   Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                   SizeType eval_idx_begin, SizeType eval_idx_end,
+                   EigensolverReport* report = nullptr);
+
+  static void call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                   EigensolverReport* report = nullptr);
+  static void call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                   Matrix<BaseType<T>, D>& evals, EigensolverReport* report = nullptr);
+  static void call(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan, blas::Uplo uplo,
+                   Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                   EigensolverReport* report = nullptr);
 };
 
 // ETI
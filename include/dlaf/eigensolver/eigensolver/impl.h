@@ -9,61 +9,822 @@
 //
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <complex>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include <pika/execution.hpp>
+
 #include <dlaf/blas/tile.h>
+#include <dlaf/common/pipeline.h>
+#include <dlaf/common/range2d.h>
 #include <dlaf/common/vector.h>
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/kernels/p2p.h>
 #include <dlaf/eigensolver/band_to_tridiag.h>
 #include <dlaf/eigensolver/bt_band_to_tridiag.h>
 #include <dlaf/eigensolver/bt_reduction_to_band.h>
 #include <dlaf/eigensolver/eigensolver/api.h>
+#include <dlaf/eigensolver/eigensolver/report.h>
 #include <dlaf/eigensolver/internal/get_band_size.h>
+#include <dlaf/eigensolver/internal/get_tridiag_subset_solver.h>
 #include <dlaf/eigensolver/reduction_to_band.h>
 #include <dlaf/eigensolver/tridiag_solver.h>
+#include <dlaf/eigensolver/tridiag_solver/kernels.h>
 #include <dlaf/lapack/tile.h>
 #include <dlaf/matrix/copy.h>
+#include <dlaf/matrix/copy_tile.h>
 #include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/tile.h>
+#include <dlaf/sender/policy.h>
+#include <dlaf/sender/when_all_lift.h>
+#include <dlaf/tune.h>
 #include <dlaf/types.h>
 #include <dlaf/util_matrix.h>
 
 namespace dlaf::eigensolver::internal {
 
+// Calls @p copy_fn(idx_src, spec_src, idx_dst, spec_dst) for each pair of sub-tiles needed to copy
+// the columns [j_begin, j_begin + ncols) of a matrix with distribution @p dist_src into the columns
+// [0, ncols) of a matrix with distribution @p dist_dst, where ncols is the number of columns of
+// @p dist_dst.
+//
+// Note: the column range does not need to be aligned with the tile boundaries of @p dist_src, hence
+// each destination tile is assembled from at most two sub-tiles of the source.
+template <class CopyFn>
+void forEachColumnsSubTile(const SizeType j_begin, const matrix::Distribution& dist_src,
+                           const matrix::Distribution& dist_dst, CopyFn&& copy_fn) {
+  for (SizeType j_dst = 0; j_dst < dist_dst.nrTiles().cols(); ++j_dst) {
+    const SizeType j_el_dst = dist_dst.globalElementFromGlobalTileAndTileElement<Coord::Col>(j_dst, 0);
+    const SizeType ncols = dist_dst.tileSize<Coord::Col>(j_dst);
+
+    for (SizeType j_sub = 0; j_sub < ncols;) {
+      const SizeType j_el_src = j_begin + j_el_dst + j_sub;
+      const SizeType j_src = dist_src.globalTileFromGlobalElement<Coord::Col>(j_el_src);
+      const SizeType j_tile_el_src = dist_src.tileElementFromGlobalElement<Coord::Col>(j_el_src);
+      const SizeType nsub =
+          std::min(ncols - j_sub, dist_src.distanceToAdjacentTile<Coord::Col>(j_el_src));
+
+      for (SizeType i_loc = 0; i_loc < dist_dst.localNrTiles().rows(); ++i_loc) {
+        const SizeType i = dist_dst.globalTileFromLocalTile<Coord::Row>(i_loc);
+        const SizeType nrows = dist_dst.tileSize<Coord::Row>(i);
+
+        copy_fn(GlobalTileIndex(i, j_src), matrix::SubTileSpec{{0, j_tile_el_src}, {nrows, nsub}},
+                GlobalTileIndex(i, j_dst), matrix::SubTileSpec{{0, j_sub}, {nrows, nsub}});
+      }
+
+      j_sub += nsub;
+    }
+  }
+}
+
+// Create a local matrix with a single (mb x mb) tile set to the identity.
+//
+// Sub-tiles of its tile are used in combination with hemm to build full Hermitian diagonal tiles, as it
+// allows to re-use the optimized tile kernels available for all backends.
+template <Backend B, Device D, class T>
+Matrix<T, D> makeIdentityTile(const SizeType mb) {
+  namespace ex = pika::execution::experimental;
+
+  Matrix<T, D> identity(LocalElementSize(mb, mb), TileElementSize(mb, mb));
+  ex::start_detached(dlaf::internal::whenAllLift(blas::Uplo::General, T(0), T(1),
+                                                 identity.readwrite(LocalTileIndex(0, 0))) |
+                     tile::laset(dlaf::internal::Policy<B>()));
+  return identity;
+}
+
+template <Backend B, class IdentitySender, class DiagSender, class WorkspaceSender>
+void hermitianDiagonalTileFromUpper(IdentitySender&& identity, DiagSender&& a_jj,
+                                    WorkspaceSender&& ws) {
+  namespace ex = pika::execution::experimental;
+  using ElementType = dlaf::internal::SenderElementType<WorkspaceSender>;
+
+  ex::start_detached(dlaf::internal::whenAllLift(blas::Side::Left, blas::Uplo::Upper, ElementType(1),
+                                                 std::forward<DiagSender>(a_jj),
+                                                 std::forward<IdentitySender>(identity),
+                                                 ElementType(0), std::forward<WorkspaceSender>(ws)) |
+                     tile::hemm(dlaf::internal::Policy<B>()));
+}
+
+template <Backend B, class UpperSender, class LowerSender>
+void conjTransposeTile(UpperSender&& a_ji, LowerSender&& a_ij) {
+  namespace ex = pika::execution::experimental;
+
+  ex::start_detached(ex::when_all(std::forward<UpperSender>(a_ji), std::forward<LowerSender>(a_ij)) |
+                     tile::conjTranspose(dlaf::internal::Policy<B>()));
+}
+
+// Store the Hermitian matrix, referenced by its upper triangle in @p mat_a, also in its lower
+// triangle (diagonal tiles become full Hermitian tiles).
+//
+// It allows algorithms that just reference the lower triangle to work with upper triangular input,
+// without additional full-size matrices. Just tiles of the lower triangle are written.
+// Note: it is an explicit (in place) conjugate transpose, hence upper triangular input costs an
+// additional pass over the matrix (O(n^2 mb) flops) compared to lower triangular input.
+template <Backend B, Device D, class T>
+void copyUpperToLower(Matrix<T, D>& mat_a) {
+  namespace ex = pika::execution::experimental;
+  using matrix::copy;
+
+  const matrix::Distribution& dist = mat_a.distribution();
+  const SizeType nrtiles = dist.nrTiles().rows();
+  const SizeType mb = dist.blockSize().rows();
+
+  if (nrtiles == 0)
+    return;
+
+  const auto cp_policy = dlaf::internal::Policy<matrix::internal::CopyBackend_v<D, D>>{};
+
+  Matrix<T, D> identity = makeIdentityTile<B, D, T>(mb);
+  Matrix<T, D> ws_diag(LocalElementSize(mb, mb), TileElementSize(mb, mb));
+
+  const LocalTileIndex zero(0, 0);
+  for (SizeType j = 0; j < nrtiles; ++j) {
+    const SizeType nb_j = dist.tileSize<Coord::Col>(j);
+    const matrix::SubTileSpec spec_j{{0, 0}, {nb_j, nb_j}};
+    const GlobalTileIndex jj(j, j);
+
+    hermitianDiagonalTileFromUpper<B>(matrix::splitTile(identity.read(zero), spec_j), mat_a.read(jj),
+                                      matrix::splitTile(ws_diag.readwrite(zero), spec_j));
+    ex::start_detached(ex::when_all(matrix::splitTile(ws_diag.read(zero), spec_j),
+                                    mat_a.readwrite(jj)) |
+                       copy(cp_policy));
+
+    for (SizeType i = j + 1; i < nrtiles; ++i)
+      conjTransposeTile<B>(mat_a.read(GlobalTileIndex(j, i)), mat_a.readwrite(GlobalTileIndex(i, j)));
+  }
+}
+
+// \overload copyUpperToLower()
+//
+// Distributed version: tiles whose mirrored tile is local are transposed locally, while the other ones
+// are received from the rank owning the mirrored tile (and then transposed locally). No tile is
+// exchanged between other pairs of ranks. Nevertheless, upper triangular input costs an additional
+// communication round (the non-local tiles of the upper triangle) before the reduction to band.
+// The communications are ordered by @p mpi_task_chain, a pipeline of the full communicator of @p grid.
+template <Backend B, Device D, class T>
+void copyUpperToLower(comm::CommunicatorGrid grid, common::Pipeline<comm::Communicator>& mpi_task_chain,
+                      Matrix<T, D>& mat_a) {
+  namespace ex = pika::execution::experimental;
+  using matrix::copy;
+
+  const matrix::Distribution& dist = mat_a.distribution();
+  const SizeType nrtiles = dist.nrTiles().rows();
+  const SizeType mb = dist.blockSize().rows();
+
+  if (nrtiles == 0)
+    return;
+
+  const auto cp_policy = dlaf::internal::Policy<matrix::internal::CopyBackend_v<D, D>>{};
+  const comm::Index2D this_rank = grid.rank();
+
+  Matrix<T, D> identity = makeIdentityTile<B, D, T>(mb);
+  Matrix<T, D> ws_diag(LocalElementSize(mb, mb), TileElementSize(mb, mb));
+
+  // Workspace for receiving upper tiles, one for each local tile row. Each tile is (mb x mb), so
+  // that it fits any received tile.
+  const SizeType nrtiles_local = std::max<SizeType>(1, dist.localNrTiles().rows());
+  Matrix<T, D> ws_recv(LocalElementSize(nrtiles_local * mb, mb), TileElementSize(mb, mb));
+
+  const LocalTileIndex zero(0, 0);
+  for (SizeType j = 0; j < nrtiles; ++j) {
+    const SizeType nb_j = dist.tileSize<Coord::Col>(j);
+    const matrix::SubTileSpec spec_j{{0, 0}, {nb_j, nb_j}};
+    const GlobalTileIndex jj(j, j);
+
+    if (dist.rankIndex() == dist.rankGlobalTile(jj)) {
+      hermitianDiagonalTileFromUpper<B>(matrix::splitTile(identity.read(zero), spec_j), mat_a.read(jj),
+                                        matrix::splitTile(ws_diag.readwrite(zero), spec_j));
+      ex::start_detached(ex::when_all(matrix::splitTile(ws_diag.read(zero), spec_j),
+                                      mat_a.readwrite(jj)) |
+                         copy(cp_policy));
+    }
+
+    for (SizeType i = j + 1; i < nrtiles; ++i) {
+      const GlobalTileIndex ij(i, j);
+      const GlobalTileIndex ji(j, i);
+      const comm::Index2D rank_ij = dist.rankGlobalTile(ij);
+      const comm::Index2D rank_ji = dist.rankGlobalTile(ji);
+      // Note: each tile has its own tag, such that the matching does not rely on the message order.
+      const comm::IndexT_MPI tag = to_int(i + j * nrtiles);
+
+      if (this_rank == rank_ij && this_rank == rank_ji) {
+        conjTransposeTile<B>(mat_a.read(ji), mat_a.readwrite(ij));
+      }
+      else if (this_rank == rank_ji) {
+        ex::start_detached(comm::scheduleSend(mpi_task_chain(), grid.rankFullCommunicator(rank_ij), tag,
+                                              mat_a.read(ji)));
+      }
+      else if (this_rank == rank_ij) {
+        const SizeType i_local = dist.localTileFromGlobalTile<Coord::Row>(i);
+        const LocalTileIndex ws_idx(i_local, 0);
+        const matrix::SubTileSpec spec_ji{{0, 0}, dist.tileSize(ji)};
+
+        ex::start_detached(comm::scheduleRecv(mpi_task_chain(), grid.rankFullCommunicator(rank_ji), tag,
+                                              matrix::splitTile(ws_recv.readwrite(ws_idx), spec_ji)));
+        conjTransposeTile<B>(matrix::splitTile(ws_recv.read(ws_idx), spec_ji), mat_a.readwrite(ij));
+      }
+    }
+  }
+}
+
+// Copies the tile of @p src into the tile of @p dst, converting it to complex if TDst is
+// std::complex<T>.
+template <class T, class TDst, Device D, class SrcSender, class DstSender>
+void copyOrCastToComplexTile(SrcSender&& src, DstSender&& dst) {
+  namespace ex = pika::execution::experimental;
+  using matrix::copy;
+
+  if constexpr (std::is_same_v<T, TDst>) {
+    const auto cp_policy = dlaf::internal::Policy<matrix::internal::CopyBackend_v<D, D>>{};
+    ex::start_detached(ex::when_all(std::forward<SrcSender>(src), std::forward<DstSender>(dst)) |
+                       copy(cp_policy));
+  }
+  else {
+    castToComplexAsync<D>(std::forward<SrcSender>(src), std::forward<DstSender>(dst));
+  }
+}
+
+// Copy the columns [j_begin, j_begin + mat_dst.size().cols()) of @p mat_src into @p mat_dst.
+//
+// If TDst is std::complex<T> the columns are converted to complex while being copied, hence no
+// intermediate real matrix is needed.
+//
+// @pre mat_src and mat_dst have the same number of rows and the same block size,
+// @pre j_begin + mat_dst.size().cols() <= mat_src.size().cols().
+template <class T, class TDst, Device D>
+void copyColumns(const SizeType j_begin, Matrix<const T, D>& mat_src, Matrix<TDst, D>& mat_dst) {
+  static_assert(std::is_same_v<T, TDst> || std::is_same_v<std::complex<T>, TDst>);
+
+  DLAF_ASSERT(mat_src.size().rows() == mat_dst.size().rows(), mat_src, mat_dst);
+  DLAF_ASSERT(mat_src.blockSize() == mat_dst.blockSize(), mat_src, mat_dst);
+  DLAF_ASSERT(j_begin >= 0 && j_begin + mat_dst.size().cols() <= mat_src.size().cols(), j_begin,
+              mat_src, mat_dst);
+
+  forEachColumnsSubTile(j_begin, mat_src.distribution(), mat_dst.distribution(),
+                        [&](const GlobalTileIndex idx_src, const matrix::SubTileSpec& spec_src,
+                            const GlobalTileIndex idx_dst, const matrix::SubTileSpec& spec_dst) {
+                          copyOrCastToComplexTile<T, TDst, D>(
+                              matrix::splitTile(mat_src.read(idx_src), spec_src),
+                              matrix::splitTile(mat_dst.readwrite(idx_dst), spec_dst));
+                        });
+}
+
+// \overload copyColumns()
+//
+// Distributed version: the columns are exchanged among the ranks of the same row of @p grid, using
+// @p mpi_row_task_chain (a pipeline of the row communicator of @p grid).
+// If TDst is std::complex<T>, the received real sub-tiles are stored in a workspace of one tile per
+// local tile row, and then converted into @p mat_dst.
+//
+// @pre mat_src and mat_dst are distributed on @p grid with the same row distribution.
+template <class T, class TDst, Device D>
+void copyColumns(comm::CommunicatorGrid grid, common::Pipeline<comm::Communicator>& mpi_row_task_chain,
+                 const SizeType j_begin, Matrix<const T, D>& mat_src, Matrix<TDst, D>& mat_dst) {
+  static_assert(std::is_same_v<T, TDst> || std::is_same_v<std::complex<T>, TDst>);
+  namespace ex = pika::execution::experimental;
+
+  const matrix::Distribution& dist_src = mat_src.distribution();
+  const matrix::Distribution& dist_dst = mat_dst.distribution();
+
+  DLAF_ASSERT(mat_src.size().rows() == mat_dst.size().rows(), mat_src, mat_dst);
+  DLAF_ASSERT(mat_src.blockSize() == mat_dst.blockSize(), mat_src, mat_dst);
+  DLAF_ASSERT(dist_src.sourceRankIndex().row() == dist_dst.sourceRankIndex().row(), mat_src, mat_dst);
+  DLAF_ASSERT(j_begin >= 0 && j_begin + mat_dst.size().cols() <= mat_src.size().cols(), j_begin,
+              mat_src, mat_dst);
+
+  const comm::IndexT_MPI this_rank_col = grid.rank().col();
+
+  constexpr bool cast = !std::is_same_v<T, TDst>;
+  const SizeType mb = dist_dst.blockSize().rows();
+  const SizeType nrtiles_ws = cast ? std::max<SizeType>(1, dist_dst.localNrTiles().rows()) : 0;
+  Matrix<T, D> ws_recv(LocalElementSize(nrtiles_ws * mb, cast ? mb : 0), TileElementSize(mb, mb));
+
+  forEachColumnsSubTile(
+      j_begin, dist_src, dist_dst,
+      [&](const GlobalTileIndex idx_src, const matrix::SubTileSpec& spec_src,
+          const GlobalTileIndex idx_dst, const matrix::SubTileSpec& spec_dst) {
+        const comm::IndexT_MPI rank_src = dist_src.rankGlobalTile<Coord::Col>(idx_src.col());
+        const comm::IndexT_MPI rank_dst = dist_dst.rankGlobalTile<Coord::Col>(idx_dst.col());
+
+        // Note: p2p messages between the same pair of ranks are matched in the same order they are
+        // scheduled, hence it is enough to use the destination tile column as tag.
+        const comm::IndexT_MPI tag = to_int(idx_dst.col());
+
+        if (rank_src == this_rank_col && rank_dst == this_rank_col) {
+          copyOrCastToComplexTile<T, TDst, D>(
+              matrix::splitTile(mat_src.read(idx_src), spec_src),
+              matrix::splitTile(mat_dst.readwrite(idx_dst), spec_dst));
+        }
+        else if (rank_src == this_rank_col) {
+          ex::start_detached(comm::scheduleSend(mpi_row_task_chain(), rank_dst, tag,
+                                                matrix::splitTile(mat_src.read(idx_src), spec_src)));
+        }
+        else if (rank_dst == this_rank_col) {
+          if constexpr (cast) {
+            const LocalTileIndex ws_idx(dist_dst.localTileFromGlobalTile<Coord::Row>(idx_dst.row()), 0);
+            const matrix::SubTileSpec spec_ws{{0, 0}, spec_dst.size};
+
+            ex::start_detached(
+                comm::scheduleRecv(mpi_row_task_chain(), rank_src, tag,
+                                   matrix::splitTile(ws_recv.readwrite(ws_idx), spec_ws)));
+            castToComplexAsync<D>(matrix::splitTile(ws_recv.read(ws_idx), spec_ws),
+                                  matrix::splitTile(mat_dst.readwrite(idx_dst), spec_dst));
+          }
+          else {
+            ex::start_detached(
+                comm::scheduleRecv(mpi_row_task_chain(), rank_src, tag,
+                                   matrix::splitTile(mat_dst.readwrite(idx_dst), spec_dst)));
+          }
+        }
+      });
+}
+
+// Computes with the D&C tridiagonal eigensolver all the eigenvectors of @p tridiag, and copies into
+// @p mat_e just the ones with index in [eval_idx_begin, eval_idx_begin + mat_e.size().cols()).
+//
+// Note: all the eigenvectors are stored in the real N x N matrix owned by @p plan, hence no other
+// N x N matrix is allocated. For complex types the selected eigenvectors are converted to complex
+// while being copied into @p mat_e.
+template <Backend B, Device D, class T>
+void tridiagSolverColumns(EigensolverPlan<T, D>& plan, Matrix<BaseType<T>, Device::CPU>& tridiag,
+                          Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                          const SizeType eval_idx_begin) {
+  Matrix<BaseType<T>, D>& mat_e_tridiag = plan.tridiagEigenvectors();
+  TridiagSolver<B, D, BaseType<T>>::call(tridiag, evals, mat_e_tridiag, plan.tridiagWorkSpaces());
+
+  copyColumns(eval_idx_begin, mat_e_tridiag, mat_e);
+}
+
+// \overload tridiagSolverColumns()
+//
+// Distributed version, which uses the communicator pipelines owned by @p plan.
+template <Backend B, Device D, class T>
+void tridiagSolverColumns(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan,
+                          Matrix<BaseType<T>, Device::CPU>& tridiag, Matrix<BaseType<T>, D>& evals,
+                          Matrix<T, D>& mat_e, const SizeType eval_idx_begin) {
+  Matrix<BaseType<T>, D>& mat_e_tridiag = plan.tridiagEigenvectors();
+  TridiagSolver<B, D, BaseType<T>>::call(grid, plan.fullTaskChain(), plan.rowTaskChain(),
+                                         plan.colTaskChain(), tridiag, evals, mat_e_tridiag,
+                                         plan.tridiagWorkSpaces());
+
+  copyColumns(grid, plan.rowTaskChain(), eval_idx_begin, mat_e_tridiag, mat_e);
+}
+
+// Results of the local reduction of a band matrix to tridiagonal form, which is performed either
+// directly, or in two stages via an intermediate band matrix with band size band_size_tridiag
+// (see getIntermediateBandSize).
+template <class T>
+struct BandToTridiagStages {
+  SizeType band_size;
+  SizeType band_size_tridiag;
+  std::optional<BandResult<T, Device::CPU>> band;
+  TridiagResult<T, Device::CPU> tridiag;
+};
+
+template <Backend B, Device D, class T>
+BandToTridiagStages<T> bandToTridiagStages(const SizeType band_size, Matrix<const T, D>& mat_a) {
+  // Note: the back-transformation of the intermediate reduction is available only for the MC backend.
+  if constexpr (B == Backend::MC) {
+    const SizeType band_size_tridiag = getIntermediateBandSize(band_size);
+    if (band_size_tridiag < band_size) {
+      auto ret_band = bandToBand<Backend::MC>(blas::Uplo::Lower, band_size, band_size_tridiag, mat_a);
+      auto ret = bandToTridiag<Backend::MC>(blas::Uplo::Lower, band_size_tridiag, ret_band.band);
+      return {band_size, band_size_tridiag, std::move(ret_band), std::move(ret)};
+    }
+  }
+
+  return {band_size, band_size, std::nullopt,
+          bandToTridiag<Backend::MC>(blas::Uplo::Lower, band_size, mat_a)};
+}
+
+template <class T>
+double bandToTridiagStagesFlops(const double n, const BandToTridiagStages<T>& stages) {
+  return bandToTridiagFlops<T>(n, stages.band_size) +
+         (stages.band ? bandToTridiagFlops<T>(n, stages.band_size_tridiag) : 0);
+}
+
+template <Backend B, Device D, class T>
+void backTransformationBandToTridiagStages(BandToTridiagStages<T>& stages, Matrix<T, D>& mat_e) {
+  backTransformationBandToTridiag<B>(stages.band_size_tridiag, mat_e, stages.tridiag.hh_reflectors);
+
+  if constexpr (B == Backend::MC) {
+    if (stages.band)
+      backTransformationBandToBand<B>(stages.band_size, stages.band_size_tridiag, mat_e,
+                                      stages.band->hh_reflectors);
+  }
+}
+
+// Applies to mat_e the back-transformations of the band to tridiagonal reduction (see
+// backTransformationBandToTridiagStages) and of the reduction to band.
+//
+// If eigensolver_bt_pipeline_col_tiles > 0, mat_e is streamed through the two back-transformations in
+// blocks of that number of tile columns, i.e. the tasks of both back-transformations of a column block
+// are scheduled before the ones of the next column block. This way the second back-transformation can
+// start on the first column blocks, while the first one is still working on the next ones, and each
+// column block is still hot in cache between the two applications. V and W of each block of HH
+// reflectors are computed just once and reused by all the column blocks. At most
+// eigensolver_bt_pipeline_lookahead column blocks are in flight, i.e. the tasks of a column block can
+// start only after the column block lookahead positions before it has been completed. This is enforced
+// with sender dependencies (the first access to each tile of a column block depends on the completion
+// of that column block), hence the function only schedules the work and never waits.
+//
+// The back-transformations are added to @p recorder as two separate stages, or as a single one if they
+// are pipelined.
+template <Backend B, Device D, class T>
+void backTransformations(
+    const SizeType band_size, BandToTridiagStages<T>& stages, Matrix<T, D>& mat_e,
+    Matrix<const T, D>& mat_v,
+    common::internal::vector<pika::shared_future<common::internal::vector<T>>> taus,
+    EigensolverReportRecorder& recorder) {
+  namespace ex = pika::execution::experimental;
+
+  const SizeType nr_col_tiles = mat_e.nrTiles().cols();
+  const SizeType block_tiles = getTuneParameters().eigensolver_bt_pipeline_col_tiles;
+  const SizeType lookahead =
+      std::max<SizeType>(1, getTuneParameters().eigensolver_bt_pipeline_lookahead);
+
+  const double m = mat_e.size().rows();
+  const double n = mat_e.size().cols();
+  const double flops_bt_band2trid =
+      (stages.band ? 2 : 1) * backTransformationBandToTridiagFlops<T>(m, n);
+  const double flops_bt_red2band = backTransformationReductionToBandFlops<T>(m, n, band_size);
+
+  if (block_tiles <= 0 || block_tiles >= nr_col_tiles) {
+    backTransformationBandToTridiagStages<B>(stages, mat_e);
+    recorder.addStage("bt_band2trid", flops_bt_band2trid, 0, mat_e);
+    backTransformationReductionToBand<B>(band_size, mat_e, mat_v, std::move(taus));
+    recorder.addStage("bt_red2band", flops_bt_red2band, 0, mat_e);
+    return;
+  }
+
+  BackTransformationT2BColumnBlocks<B, D, T> bt_band2trid(stages.band_size_tridiag, mat_e,
+                                                          stages.tridiag.hh_reflectors);
+  BackTransformationReductionToBandColumnBlocks<B, D, T> bt_red2band(band_size, mat_e, mat_v,
+                                                                    std::move(taus));
+
+  // Note: blocks_done[i] is completed when the column block i has been fully back-transformed.
+  std::vector<ex::any_sender<>> blocks_done;
+  for (SizeType j_begin = 0; j_begin < nr_col_tiles; j_begin += block_tiles) {
+    const SizeType j_end = std::min(j_begin + block_tiles, nr_col_tiles);
+    const LocalTileIndex block_end(mat_e.nrTiles().rows(), j_end);
+    const auto block_tiles_range = common::iterate_range2d(LocalTileIndex(0, j_begin), block_end);
+
+    // The first access to each tile of the column block waits for the column block lookahead positions
+    // before it, hence all the following accesses (i.e. the back-transformations) wait for it too.
+    if (to_SizeType(blocks_done.size()) >= lookahead) {
+      const auto& prev_block_done = blocks_done[blocks_done.size() - to_sizet(lookahead)];
+      for (const auto& ij : block_tiles_range)
+        ex::start_detached(ex::when_all(prev_block_done, mat_e.readwrite(ij)) | ex::drop_value());
+    }
+
+    bt_band2trid.call(j_begin, j_end);
+    if constexpr (B == Backend::MC) {
+      if (stages.band)
+        BackTransformationB2B<B, D, T>::call(stages.band_size, stages.band_size_tridiag, mat_e,
+                                             stages.band->hh_reflectors, j_begin, j_end);
+    }
+    bt_red2band.call(j_begin, j_end);
+
+    std::vector<ex::unique_any_sender<>> tiles_done;
+    for (const auto& ij : block_tiles_range)
+      tiles_done.emplace_back(mat_e.read(ij) | ex::drop_value());
+    blocks_done.emplace_back(ex::when_all_vector(std::move(tiles_done)) | ex::ensure_started() |
+                             ex::split());
+  }
+  recorder.addStage("bt_band2trid+bt_red2band", flops_bt_band2trid + flops_bt_red2band, 0, mat_e);
+}
+
+// Distributed reduction to band (see reductionToBand) using the communicator pipelines of @p plan.
+template <Backend B, Device D, class T>
+common::internal::vector<pika::shared_future<common::internal::vector<T>>> reductionToBandWithPlan(
+    EigensolverPlan<T, D>& plan, Matrix<T, D>& mat_a, const SizeType band_size) {
+  return groupTausFromBandsToTiles(ReductionToBand<B, D, T>::call(plan.colPanelTaskChain(),
+                                                                  plan.rowTaskChain(),
+                                                                  plan.colTaskChain(), mat_a,
+                                                                  band_size),
+                                   band_size, mat_a.blockSize().rows());
+}
+
+// Distributed band to tridiagonal reduction (see bandToTridiag) using the communicator pipelines of
+// @p plan.
+template <Device D, class T>
+TridiagResult<T, Device::CPU> bandToTridiagWithPlan(comm::CommunicatorGrid grid,
+                                                    EigensolverPlan<T, D>& plan,
+                                                    const SizeType band_size,
+                                                    Matrix<const T, D>& mat_a) {
+  // If the grid contains only one rank force local implementation.
+  if (grid.size() == comm::Size2D(1, 1))
+    return bandToTridiag<Backend::MC>(blas::Uplo::Lower, band_size, mat_a);
+
+  return BandToTridiag<Backend::MC, D, T>::call_L(grid, plan.fullTaskChain(), band_size, mat_a);
+}
+
 template <Backend B, Device D, class T>
 void Eigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
                                 Matrix<T, D>& mat_e) {
+  EigensolverPlan<T, D> plan(mat_e.distribution());
+  Eigensolver<B, D, T>::call(plan, uplo, mat_a, evals, mat_e);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(EigensolverPlan<T, D>& plan, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                                EigensolverReport* report) {
+  EigensolverReportRecorder recorder(report);
+  Eigensolver<B, D, T>::call(plan, uplo, mat_a, evals, mat_e, recorder);
+  recorder.finish(mat_e);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(EigensolverPlan<T, D>& plan, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                                EigensolverReportRecorder& recorder) {
+  DLAF_ASSERT(!plan.isDistributed(), plan.isDistributed());
+  DLAF_ASSERT(plan.isCompatible(mat_e.distribution()), mat_e);
+
   const SizeType band_size = getBandSize(mat_a.blockSize().rows());
+  const double n = mat_a.size().rows();
 
-  // need uplo check as reduction to band doesn't have the uplo argument yet.
-  if (uplo != blas::Uplo::Lower)
+  if (uplo == blas::Uplo::General)
     DLAF_UNIMPLEMENTED(uplo);
 
+  // Note: reduction to band references just the lower triangle.
+  if (uplo == blas::Uplo::Upper)
+    copyUpperToLower<B>(mat_a);
+
   auto taus = reductionToBand<B>(mat_a, band_size);
-  auto ret = bandToTridiag<Backend::MC>(uplo, band_size, mat_a);
+  recorder.addStage("red2band", reductionToBandFlops<T>(n, band_size), 0, mat_a);
 
-  eigensolver::tridiagSolver<B>(ret.tridiagonal, evals, mat_e);
+  auto ret = bandToTridiagStages<B, D, T>(band_size, mat_a);
+  recorder.addStage("band2trid", bandToTridiagStagesFlops(n, ret), 0, ret.tridiag.tridiagonal,
+                    ret.tridiag.hh_reflectors);
 
-  backTransformationBandToTridiag<B>(band_size, mat_e, ret.hh_reflectors);
-  backTransformationReductionToBand<B>(band_size, mat_e, mat_a, taus);
+  TridiagSolver<B, D, BaseType<T>>::call(ret.tridiag.tridiagonal, evals, mat_e,
+                                         plan.tridiagWorkSpaces());
+  recorder.addStage("tridiag", tridiagSolverFlops<T>(n), 0, evals, mat_e);
+
+  backTransformations<B>(band_size, ret, mat_e, mat_a, std::move(taus), recorder);
 }
 
 template <Backend B, Device D, class T>
 void Eigensolver<B, D, T>::call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
                                 Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e) {
+  EigensolverPlan<T, D> plan(grid, mat_e.distribution());
+  Eigensolver<B, D, T>::call(grid, plan, uplo, mat_a, evals, mat_e);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan,
+                                blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                                Matrix<T, D>& mat_e, EigensolverReport* report) {
+  EigensolverReportRecorder recorder(report);
+  Eigensolver<B, D, T>::call(grid, plan, uplo, mat_a, evals, mat_e, recorder);
+  recorder.finish(mat_e);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan,
+                                blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                                Matrix<T, D>& mat_e, EigensolverReportRecorder& recorder) {
+  DLAF_ASSERT(plan.isDistributed(), plan.isDistributed());
+  DLAF_ASSERT(plan.isCompatible(mat_e.distribution()), mat_e);
+
+  const SizeType band_size = getBandSize(mat_a.blockSize().rows());
+  const double n = mat_a.size().rows();
+  const double nb = mat_a.blockSize().rows();
+  const CommunicationModel comm_model(grid.size());
+
+  if (uplo == blas::Uplo::General)
+    DLAF_UNIMPLEMENTED(uplo);
+
+  // Note: reduction to band references just the lower triangle.
+  if (uplo == blas::Uplo::Upper)
+    copyUpperToLower<B>(grid, plan.fullTaskChain(), mat_a);
+
+  auto taus = reductionToBandWithPlan<B>(plan, mat_a, band_size);
+  recorder.addStage("red2band", reductionToBandFlops<T>(n, band_size),
+                    comm_model.hermitianPanels<T>(n), mat_a);
+
+  auto ret = bandToTridiagWithPlan(grid, plan, band_size, mat_a);
+  recorder.addStage("band2trid", bandToTridiagFlops<T>(n, band_size),
+                    comm_model.band<T>(n, band_size), ret.tridiagonal, ret.hh_reflectors);
+
+  TridiagSolver<B, D, BaseType<T>>::call(grid, plan.fullTaskChain(), plan.rowTaskChain(),
+                                         plan.colTaskChain(), ret.tridiagonal, evals, mat_e,
+                                         plan.tridiagWorkSpaces());
+  recorder.addStage("tridiag", tridiagSolverFlops<T>(n), comm_model.tridiag<T>(n, nb), evals, mat_e);
+
+  BackTransformationT2B<B, D, T>::call(grid, plan.rowTaskChain(), plan.colTaskChain(), band_size, mat_e,
+                                       ret.hh_reflectors);
+  recorder.addStage("bt_band2trid", backTransformationBandToTridiagFlops<T>(n, n),
+                    comm_model.backTransformation<T>(n, n), mat_e);
+
+  BackTransformationReductionToBand<B, D, T>::call(grid, plan.rowTaskChain(), plan.colTaskChain(),
+                                                   band_size, mat_e, mat_a, std::move(taus));
+  recorder.addStage("bt_red2band", backTransformationReductionToBandFlops<T>(n, n, band_size),
+                    comm_model.backTransformation<T>(n - band_size, n), mat_e);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                                Matrix<T, D>& mat_e, const SizeType eval_idx_begin,
+                                const SizeType eval_idx_end) {
+  // Note: the workspaces of the plan are allocated just if the D&C tridiagonal solver is used.
+  EigensolverPlan<T, D> plan(mat_a.distribution());
+  Eigensolver<B, D, T>::call(plan, uplo, mat_a, evals, mat_e, eval_idx_begin, eval_idx_end);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                                const SizeType eval_idx_begin, const SizeType eval_idx_end) {
+  // Note: the workspaces of the plan are allocated just if the D&C tridiagonal solver is used.
+  EigensolverPlan<T, D> plan(grid, mat_a.distribution());
+  Eigensolver<B, D, T>::call(grid, plan, uplo, mat_a, evals, mat_e, eval_idx_begin, eval_idx_end);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(EigensolverPlan<T, D>& plan, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                                const SizeType eval_idx_begin, const SizeType eval_idx_end,
+                                EigensolverReport* report) {
+  DLAF_ASSERT(!plan.isDistributed(), plan.isDistributed());
+  DLAF_ASSERT(plan.isCompatible(mat_a.distribution()), mat_a);
+  DLAF_ASSERT(mat_e.size().cols() == eval_idx_end - eval_idx_begin, mat_e, eval_idx_begin,
+              eval_idx_end);
+
+  const SizeType band_size = getBandSize(mat_a.blockSize().rows());
+  const double n = mat_a.size().rows();
+  EigensolverReportRecorder recorder(report);
+
+  if (uplo == blas::Uplo::General)
+    DLAF_UNIMPLEMENTED(uplo);
+
+  // Note: reduction to band references just the lower triangle.
+  if (uplo == blas::Uplo::Upper)
+    copyUpperToLower<B>(mat_a);
+
+  auto taus = reductionToBand<B>(mat_a, band_size);
+  recorder.addStage("red2band", reductionToBandFlops<T>(n, band_size), 0, mat_a);
+
+  auto ret = bandToTridiagStages<B, D, T>(band_size, mat_a);
+  recorder.addStage("band2trid", bandToTridiagStagesFlops(n, ret), 0, ret.tridiag.tridiagonal,
+                    ret.tridiag.hh_reflectors);
+
+  // Note:
+  // For small subsets, just the requested eigenvectors of the tridiagonal matrix are computed with MRRR.
+  // Otherwise, the D&C tridiagonal solver computes all the eigenvectors (in the matrix owned by the
+  // plan), but just the ones in the requested range are kept, so that the back-transformations are
+  // applied to (and their cost scales with) just them.
+  if (useTridiagSubsetSolver(mat_a.size().rows(), eval_idx_end - eval_idx_begin)) {
+    eigensolver::tridiagSolver<B>(ret.tridiag.tridiagonal, evals, mat_e, eval_idx_begin,
+                                  eval_idx_end);
+    recorder.addStage("tridiag", tridiagSubsetSolverFlops<T>(n, eval_idx_end - eval_idx_begin), 0,
+                      evals, mat_e);
+  }
+  else {
+    tridiagSolverColumns<B>(plan, ret.tridiag.tridiagonal, evals, mat_e, eval_idx_begin);
+    recorder.addStage("tridiag", tridiagSolverFlops<T>(n), 0, evals, mat_e);
+  }
+
+  backTransformations<B>(band_size, ret, mat_e, mat_a, std::move(taus), recorder);
+  recorder.finish(mat_e);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan,
+                                blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                                Matrix<T, D>& mat_e, const SizeType eval_idx_begin,
+                                const SizeType eval_idx_end, EigensolverReport* report) {
+  DLAF_ASSERT(plan.isDistributed(), plan.isDistributed());
+  DLAF_ASSERT(plan.isCompatible(mat_a.distribution()), mat_a);
+  DLAF_ASSERT(mat_e.size().cols() == eval_idx_end - eval_idx_begin, mat_e, eval_idx_begin,
+              eval_idx_end);
+
+  const SizeType band_size = getBandSize(mat_a.blockSize().rows());
+  const double n = mat_a.size().rows();
+  const double nb = mat_a.blockSize().rows();
+  const double k = eval_idx_end - eval_idx_begin;
+  const CommunicationModel comm_model(grid.size());
+  EigensolverReportRecorder recorder(report);
+
+  if (uplo == blas::Uplo::General)
+    DLAF_UNIMPLEMENTED(uplo);
+
+  // Note: reduction to band references just the lower triangle.
+  if (uplo == blas::Uplo::Upper)
+    copyUpperToLower<B>(grid, plan.fullTaskChain(), mat_a);
+
+  auto taus = reductionToBandWithPlan<B>(plan, mat_a, band_size);
+  recorder.addStage("red2band", reductionToBandFlops<T>(n, band_size),
+                    comm_model.hermitianPanels<T>(n), mat_a);
+
+  auto ret = bandToTridiagWithPlan(grid, plan, band_size, mat_a);
+  recorder.addStage("band2trid", bandToTridiagFlops<T>(n, band_size),
+                    comm_model.band<T>(n, band_size), ret.tridiagonal, ret.hh_reflectors);
+
+  // Note:
+  // For small subsets, just the requested eigenvectors of the tridiagonal matrix are computed with MRRR.
+  // Otherwise, the D&C tridiagonal solver computes all the eigenvectors (in the matrix owned by the
+  // plan), but just the ones in the requested range are kept, so that the back-transformations are
+  // applied to (and their cost scales with) just them.
+  if (useTridiagSubsetSolver(mat_a.size().rows(), eval_idx_end - eval_idx_begin)) {
+    // Note: each rank computes its eigenvectors locally, without any communication.
+    eigensolver::tridiagSolver<B>(grid, ret.tridiagonal, evals, mat_e, eval_idx_begin, eval_idx_end);
+    recorder.addStage("tridiag", tridiagSubsetSolverFlops<T>(n, k), 0, evals, mat_e);
+  }
+  else {
+    tridiagSolverColumns<B>(grid, plan, ret.tridiagonal, evals, mat_e, eval_idx_begin);
+    recorder.addStage("tridiag", tridiagSolverFlops<T>(n), comm_model.tridiag<T>(n, nb), evals,
+                      mat_e);
+  }
+
+  BackTransformationT2B<B, D, T>::call(grid, plan.rowTaskChain(), plan.colTaskChain(), band_size, mat_e,
+                                       ret.hh_reflectors);
+  recorder.addStage("bt_band2trid", backTransformationBandToTridiagFlops<T>(n, k),
+                    comm_model.backTransformation<T>(n, k), mat_e);
+
+  BackTransformationReductionToBand<B, D, T>::call(grid, plan.rowTaskChain(), plan.colTaskChain(),
+                                                   band_size, mat_e, mat_a, std::move(taus));
+  recorder.addStage("bt_red2band", backTransformationReductionToBandFlops<T>(n, k, band_size),
+                    comm_model.backTransformation<T>(n, k), mat_e);
+  recorder.finish(mat_e);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                                EigensolverReport* report) {
   const SizeType band_size = getBandSize(mat_a.blockSize().rows());
+  const double n = mat_a.size().rows();
+  EigensolverReportRecorder recorder(report);
 
-  // need uplo check as reduction to band doesn't have the uplo argument yet.
-  if (uplo != blas::Uplo::Lower)
+  if (uplo == blas::Uplo::General)
     DLAF_UNIMPLEMENTED(uplo);
 
-  auto taus = reductionToBand<B>(grid, mat_a, band_size);
-  auto ret = bandToTridiag<Backend::MC>(grid, uplo, band_size, mat_a);
+  // Note: reduction to band references just the lower triangle.
+  if (uplo == blas::Uplo::Upper)
+    copyUpperToLower<B>(mat_a);
+
+  // Note: the Householder reflectors of both reduction stages are not needed, since there are no
+  // eigenvectors to back-transform.
+  reductionToBand<B>(mat_a, band_size);
+  recorder.addStage("red2band", reductionToBandFlops<T>(n, band_size), 0, mat_a);
+
+  auto ret = bandToTridiagStages<B, D, T>(band_size, mat_a);
+  recorder.addStage("band2trid", bandToTridiagStagesFlops(n, ret), 0, ret.tridiag.tridiagonal);
+
+  eigensolver::tridiagSolver<B>(ret.tridiag.tridiagonal, evals);
+  recorder.addStage("tridiag", tridiagEigenvaluesFlops<T>(n), 0, evals);
+  recorder.finish(evals);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                Matrix<BaseType<T>, D>& evals, EigensolverReport* report) {
+  // Note: the workspaces of the plan are never allocated, since no eigenvector is computed.
+  EigensolverPlan<T, D> plan(grid, mat_a.distribution());
+  Eigensolver<B, D, T>::call(grid, plan, uplo, mat_a, evals, report);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(comm::CommunicatorGrid grid, EigensolverPlan<T, D>& plan,
+                                blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                                EigensolverReport* report) {
+  DLAF_ASSERT(plan.isDistributed(), plan.isDistributed());
+  DLAF_ASSERT(plan.isCompatible(mat_a.distribution()), mat_a);
+
+  const SizeType band_size = getBandSize(mat_a.blockSize().rows());
+  const double n = mat_a.size().rows();
+  const CommunicationModel comm_model(grid.size());
+  EigensolverReportRecorder recorder(report);
+
+  if (uplo == blas::Uplo::General)
+    DLAF_UNIMPLEMENTED(uplo);
+
+  // Note: reduction to band references just the lower triangle.
+  if (uplo == blas::Uplo::Upper)
+    copyUpperToLower<B>(grid, plan.fullTaskChain(), mat_a);
+
+  // Note: the Householder reflectors of both reduction stages are not needed, since there are no
+  // eigenvectors to back-transform.
+  reductionToBandWithPlan<B>(plan, mat_a, band_size);
+  recorder.addStage("red2band", reductionToBandFlops<T>(n, band_size),
+                    comm_model.hermitianPanels<T>(n), mat_a);
 
-  eigensolver::tridiagSolver<B>(grid, ret.tridiagonal, evals, mat_e);
+  auto ret = bandToTridiagWithPlan(grid, plan, band_size, mat_a);
+  recorder.addStage("band2trid", bandToTridiagFlops<T>(n, band_size),
+                    comm_model.band<T>(n, band_size), ret.tridiagonal);
 
-  backTransformationBandToTridiag<B>(grid, band_size, mat_e, ret.hh_reflectors);
-  backTransformationReductionToBand<B>(grid, band_size, mat_e, mat_a, taus);
+  // Note: the tridiagonal matrix is available on all ranks, hence each one computes the eigenvalues
+  // locally without any communication.
+  eigensolver::tridiagSolver<B>(ret.tridiagonal, evals);
+  recorder.addStage("tridiag", tridiagEigenvaluesFlops<T>(n), 0, evals);
+  recorder.finish(evals);
 }
 }
@@ -0,0 +1,273 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pika/execution.hpp>
+#include <pika/future.hpp>
+
+#include <dlaf/common/range2d.h>
+#include <dlaf/common/timer.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/types.h>
+
+namespace dlaf::eigensolver {
+
+/// Performance figures of a stage of the eigensolver.
+struct EigensolverStageReport {
+  std::string name;
+  /// Time (in seconds) from the end of the previous stage (or from the beginning of the call) to the
+  /// end of this stage, where a stage ends when all its results are available on this rank.
+  double time = 0;
+  /// Estimated number of floating point operations of the stage (on all the ranks).
+  double flops = 0;
+  /// Estimated number of bytes communicated by this rank during the stage.
+  ///
+  /// Note: it is not measured, it is a closed-form estimate of the communication volume of the
+  /// algorithm (see internal::CommunicationModel), which e.g. ignores deflation in the tridiagonal
+  /// eigensolver. It is 0 for local implementations.
+  double estimated_bytes = 0;
+
+  /// Achieved GFlop/s (on all the ranks).
+  double gigaflops() const noexcept {
+    return time > 0 ? flops / time / 1e9 : 0;
+  }
+};
+
+/// Per-stage performance report of an eigensolver call.
+///
+/// The stages of a call are appended to @p stages asynchronously, i.e. they are available once the
+/// eigenvectors computed by the call are ready (e.g. after eigenvectors.waitLocalTiles()).
+///
+/// Note: the stages are asynchronous and they overlap, hence the time of a stage includes the parts of
+/// the following stages that are executed before it ends.
+struct EigensolverReport {
+  std::vector<EigensolverStageReport> stages;
+
+  double time() const noexcept {
+    double time = 0;
+    for (const auto& stage : stages)
+      time += stage.time;
+    return time;
+  }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const EigensolverReport& report) {
+  for (const auto& stage : report.stages)
+    os << stage.name << " " << stage.time << "s " << stage.flops / 1e9 << "GFlop "
+       << stage.gigaflops() << "GFlop/s " << stage.estimated_bytes / 1e9 << "GB (estimated)"
+       << std::endl;
+  os << "total " << report.time() << "s" << std::endl;
+  return os;
+}
+
+namespace internal {
+
+// Estimated number of floating point operations of the stages (the same models used by the miniapps).
+// Note: for the tridiagonal eigensolver it is the cost without deflation.
+template <class T>
+double reductionToBandFlops(const double n, const double b) {
+  const double add_mul = std::max(0., 2. / 3. * n * n * n - n * n * b);
+  return total_ops<T>(add_mul, add_mul);
+}
+
+template <class T>
+double bandToTridiagFlops(const double n, const double b) {
+  const double add_mul = 3 * n * n * b;
+  return total_ops<T>(add_mul, add_mul);
+}
+
+template <class T>
+double tridiagSolverFlops(const double n) {
+  const double add_mul = 2. / 3. * n * n * n;
+  return total_ops<BaseType<T>>(add_mul, add_mul);
+}
+
+template <class T>
+double tridiagSubsetSolverFlops(const double n, const double k) {
+  const double add_mul = n * k;
+  return total_ops<BaseType<T>>(add_mul, add_mul);
+}
+
+template <class T>
+double tridiagEigenvaluesFlops(const double n) {
+  const double add_mul = n * n;
+  return total_ops<BaseType<T>>(add_mul, add_mul);
+}
+
+template <class T>
+double backTransformationBandToTridiagFlops(const double m, const double n) {
+  const double add_mul = m * m * n;
+  return total_ops<T>(add_mul, add_mul);
+}
+
+template <class T>
+double backTransformationReductionToBandFlops(const double m, const double n, const double b) {
+  const double add_mul = std::max(0., m - b) * std::max(0., m - b) * n;
+  return total_ops<T>(add_mul, add_mul);
+}
+
+template <class T>
+double choleskyFlops(const double n) {
+  const double add_mul = n * n * n / 6;
+  return total_ops<T>(add_mul, add_mul);
+}
+
+template <class T>
+double genToStdFlops(const double n) {
+  const double add_mul = n * n * n / 2;
+  return total_ops<T>(add_mul, add_mul);
+}
+
+template <class T>
+double triangularSolverFlops(const double m, const double n) {
+  const double add_mul = n * m * m / 2;
+  return total_ops<T>(add_mul, add_mul);
+}
+
+// Estimated number of bytes communicated by each rank of a (pr x pc) grid by the distributed stages,
+// based on the panels broadcasted (and reduced) along the rows and the columns of the grid.
+// These are closed-form estimates, no communication is actually measured. In particular the tridiagonal
+// eigensolver estimate ignores deflation, hence it is an upper bound.
+// Note: local implementations do not communicate.
+struct CommunicationModel {
+  CommunicationModel() = default;
+  CommunicationModel(const comm::Size2D grid_size)
+      : pr(grid_size.rows()), pc(grid_size.cols()), distributed(grid_size.linear_size() > 1) {}
+
+  // Panels of the whole lower triangle broadcasted along rows and columns.
+  template <class T>
+  double triangularPanels(const double n) const noexcept {
+    return distributed ? sizeof(T) * n * n / 2 * (1 / pr + 1 / pc) : 0;
+  }
+
+  // Panels of the whole lower triangle broadcasted (and reduced) along rows and columns twice.
+  template <class T>
+  double hermitianPanels(const double n) const noexcept {
+    return 2 * triangularPanels<T>(n);
+  }
+
+  // Band redistributed among all the ranks and the tridiagonal matrix gathered on all of them.
+  template <class T>
+  double band(const double n, const double b) const noexcept {
+    return distributed ? sizeof(T) * 3 * n * b / (pr * pc) + sizeof(BaseType<T>) * 2 * n : 0;
+  }
+
+  // Eigenvectors exchanged at each merge of the divide and conquer (without deflation).
+  template <class T>
+  double tridiag(const double n, const double nb) const noexcept {
+    const double nr_merges = std::ceil(std::log2(std::max(1., n / nb)));
+    return distributed ? sizeof(BaseType<T>) * 2 * n * n / (pr * pc) * nr_merges : 0;
+  }
+
+  // Reflectors (m x m lower triangle) broadcasted along the rows and the partial results of the
+  // (m x n) eigenvectors reduced along the columns.
+  template <class T>
+  double backTransformation(const double m, const double n) const noexcept {
+    return distributed ? sizeof(T) * (m * m / 2 / pr + m * n / pc) : 0;
+  }
+
+  double pr = 1;
+  double pc = 1;
+  bool distributed = false;
+};
+
+// Records the stages of an eigensolver call in an EigensolverReport, without adding any
+// synchronization: the end of a stage is timestamped by a task for each local tile of its results,
+// which depends just on that tile, and the report is filled by a task which depends on all of them.
+// If the report is nullptr nothing is recorded.
+class EigensolverReportRecorder {
+public:
+  explicit EigensolverReportRecorder(EigensolverReport* report) noexcept : report_(report) {}
+
+  EigensolverReportRecorder(const EigensolverReportRecorder&) = delete;
+  EigensolverReportRecorder& operator=(const EigensolverReportRecorder&) = delete;
+
+  bool enabled() const noexcept {
+    return report_ != nullptr;
+  }
+
+  // Add a stage, which ends when all the local tiles of @p mats are ready.
+  template <class... MatrixTypes>
+  void addStage(std::string name, const double flops, const double estimated_bytes,
+                MatrixTypes&... mats) {
+    namespace ex = pika::execution::experimental;
+
+    if (!enabled())
+      return;
+
+    std::vector<pika::shared_future<double>> tile_ends;
+    (timestampLocalTiles(mats, tile_ends), ...);
+
+    auto max_end = [](std::vector<double>&& ends) {
+      return ends.empty() ? 0. : *std::max_element(ends.begin(), ends.end());
+    };
+
+    stages_.push_back({std::move(name), 0, flops, estimated_bytes});
+    stage_ends_.emplace_back(
+        ex::make_future(ex::when_all_vector(std::move(tile_ends)) | ex::then(std::move(max_end))));
+  }
+
+  // Append the stages added until now to the report, once they ended.
+  //
+  // The report is filled by a task which reads all the local tiles of @p mat, hence it is available
+  // as soon as the tiles of @p mat can be accessed in read-write mode.
+  template <class MatrixType>
+  void finish(MatrixType& mat) {
+    namespace ex = pika::execution::experimental;
+
+    if (!enabled())
+      return;
+
+    std::vector<typename MatrixType::ReadOnlySenderType> tiles;
+    for (const auto& ij : common::iterate_range2d(mat.distribution().localNrTiles()))
+      tiles.push_back(mat.read(ij));
+
+    ex::start_detached(ex::when_all(ex::when_all_vector(std::move(tiles)),
+                                    ex::when_all_vector(std::move(stage_ends_))) |
+                       ex::then([report = report_, stages = std::move(stages_)](
+                                    auto&&, std::vector<double>&& ends) mutable {
+                         double end_prev = 0;
+                         for (std::size_t i = 0; i < stages.size(); ++i) {
+                           stages[i].time = std::max(0., ends[i] - end_prev);
+                           end_prev = std::max(end_prev, ends[i]);
+                           report->stages.push_back(std::move(stages[i]));
+                         }
+                       }));
+
+    stages_.clear();
+    stage_ends_.clear();
+  }
+
+private:
+  template <class MatrixType>
+  void timestampLocalTiles(MatrixType& mat, std::vector<pika::shared_future<double>>& ends) const {
+    namespace ex = pika::execution::experimental;
+
+    for (const auto& ij : common::iterate_range2d(mat.distribution().localNrTiles()))
+      ends.emplace_back(ex::make_future(mat.read(ij) |
+                                        ex::then([timer = timer_](auto) { return timer.elapsed(); })));
+  }
+
+  EigensolverReport* report_;
+  common::Timer<> timer_;
+  std::vector<EigensolverStageReport> stages_;
+  std::vector<pika::shared_future<double>> stage_ends_;
+};
+
+}
+}
@@ -13,7 +13,9 @@
 
 #include <blas.hh>
 
+#include <dlaf/communication/communicator_grid.h>
 #include <dlaf/eigensolver/gen_eigensolver/api.h>
+#include <dlaf/factorization/cholesky.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/types.h>
 #include <dlaf/util_matrix.h>
@@ -38,9 +40,12 @@ namespace dlaf::eigensolver {
 /// @param mat_b contains the Hermitian positive definite matrix B
 /// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
 /// @param eigenvectors is a N x N matrix which on output contains the eigenvectors
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvectors are ready (see EigensolverReport)
 template <Backend B, Device D, class T>
 void genEigensolver(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<T, D>& mat_b,
-                    Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors) {
+                    Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
+                    EigensolverReport* report = nullptr) {
   DLAF_ASSERT(matrix::local_matrix(mat_a), mat_a);
   DLAF_ASSERT(matrix::local_matrix(mat_b), mat_b);
   DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
@@ -59,7 +64,7 @@ void genEigensolver(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<T, D>& mat_b,
   DLAF_ASSERT(eigenvectors.size() == mat_a.size(), eigenvectors, mat_a);
   DLAF_ASSERT(eigenvectors.blockSize() == mat_a.blockSize(), eigenvectors, mat_a);
 
-  internal::GenEigensolver<B, D, T>::call(uplo, mat_a, mat_b, eigenvalues, eigenvectors);
+  internal::GenEigensolver<B, D, T>::call(uplo, mat_a, mat_b, eigenvalues, eigenvectors, report);
 }
 
 /// Generalized Eigensolver.
@@ -118,10 +123,12 @@ EigensolverResult<T, D> genEigensolver(blas::Uplo uplo, Matrix<T, D>& mat_a, Mat
 /// @param mat_b contains the Hermitian positive definite matrix B
 /// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
 /// @param eigenvectors is a N x N matrix which on output contains the eigenvectors
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvectors are ready (see EigensolverReport)
 template <Backend B, Device D, class T>
 void genEigensolver(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
                     Matrix<T, D>& mat_b, Matrix<BaseType<T>, D>& eigenvalues,
-                    Matrix<T, D>& eigenvectors) {
+                    Matrix<T, D>& eigenvectors, EigensolverReport* report = nullptr) {
   DLAF_ASSERT(matrix::equal_process_grid(mat_a, grid), mat_a, grid);
   DLAF_ASSERT(matrix::equal_process_grid(mat_b, grid), mat_b, grid);
   DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
@@ -140,7 +147,7 @@ void genEigensolver(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>&
   DLAF_ASSERT(eigenvectors.size() == mat_a.size(), eigenvectors, mat_a);
   DLAF_ASSERT(eigenvectors.blockSize() == mat_a.blockSize(), eigenvectors, mat_a);
 
-  internal::GenEigensolver<B, D, T>::call(grid, uplo, mat_a, mat_b, eigenvalues, eigenvectors);
+  internal::GenEigensolver<B, D, T>::call(grid, uplo, mat_a, mat_b, eigenvalues, eigenvectors, report);
 }
 
 /// Generalized Eigensolver.
@@ -181,4 +188,293 @@ EigensolverResult<T, D> genEigensolver(comm::CommunicatorGrid grid, blas::Uplo u
 
   return {std::move(eigenvalues), std::move(eigenvectors)};
 }
+
+/// Generalized Eigensolver (eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the generalized eigenvalue problem A * x = lambda * B * x,
+/// without computing any eigenvector.
+///
+/// On exit:
+/// - the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+/// - @p mat_b contains the Cholesky decomposition of B
+/// - @p eigenvalues contains all the eigenvalues lambda in ascending order
+///
+/// Implementation on local memory.
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat_a and @p mat_b will be referenced
+/// @param mat_a contains the Hermitian matrix A
+/// @param mat_b contains the Hermitian positive definite matrix B
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+template <Backend B, Device D, class T>
+void genEigensolver(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<T, D>& mat_b,
+                    Matrix<BaseType<T>, D>& eigenvalues) {
+  DLAF_ASSERT(matrix::local_matrix(mat_a), mat_a);
+  DLAF_ASSERT(matrix::local_matrix(mat_b), mat_b);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_size(mat_b), mat_b);
+  DLAF_ASSERT(matrix::square_blocksize(mat_b), mat_b);
+  DLAF_ASSERT(mat_a.size() == mat_b.size(), mat_a, mat_b);
+  DLAF_ASSERT(mat_a.blockSize() == mat_b.blockSize(), mat_a, mat_b);
+  DLAF_ASSERT(eigenvalues.size() == GlobalElementSize(mat_a.size().rows(), 1), eigenvalues, mat_a);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat_a.blockSize().rows(), eigenvalues, mat_a);
+
+  internal::GenEigensolver<B, D, T>::call(uplo, mat_a, mat_b, eigenvalues);
+}
+
+/// Generalized Eigensolver (eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the generalized eigenvalue problem A * x = lambda * B * x,
+/// without computing any eigenvector.
+///
+/// On exit:
+/// - the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+/// - @p mat_b contains the Cholesky decomposition of B
+/// - @p eigenvalues contains all the eigenvalues lambda in ascending order
+///
+/// Implementation on distributed memory.
+///
+/// @param grid is the communicator grid on which the matrices @p mat_a and @p mat_b have been
+/// distributed,
+/// @param uplo specifies if upper or lower triangular part of @p mat_a and @p mat_b will be referenced
+/// @param mat_a contains the Hermitian matrix A
+/// @param mat_b contains the Hermitian positive definite matrix B
+/// @param eigenvalues is a N x 1 local matrix which on output contains the eigenvalues
+template <Backend B, Device D, class T>
+void genEigensolver(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                    Matrix<T, D>& mat_b, Matrix<BaseType<T>, D>& eigenvalues) {
+  DLAF_ASSERT(matrix::equal_process_grid(mat_a, grid), mat_a, grid);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_b, grid), mat_b, grid);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_size(mat_b), mat_b);
+  DLAF_ASSERT(matrix::square_blocksize(mat_b), mat_b);
+  DLAF_ASSERT(mat_a.size() == mat_b.size(), mat_a, mat_b);
+  DLAF_ASSERT(mat_a.blockSize() == mat_b.blockSize(), mat_a, mat_b);
+  DLAF_ASSERT(eigenvalues.size() == GlobalElementSize(mat_a.size().rows(), 1), eigenvalues, mat_a);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat_a.blockSize().rows(), eigenvalues, mat_a);
+
+  internal::GenEigensolver<B, D, T>::call(grid, uplo, mat_a, mat_b, eigenvalues);
+}
+
+/// Cholesky factorization of the B matrix of the generalized eigenvalue problem.
+///
+/// It computes the Cholesky factor of B, which can then be passed to genEigensolverFactorized, so that
+/// it can be computed just once for multiple generalized eigenvalue problems sharing the same B
+/// (e.g. the overlap matrix in self-consistent iterations).
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_b contains the
+/// Cholesky factor of B, the other triangle is not referenced.
+///
+/// Implementation on local memory.
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat_b will be referenced
+/// @param mat_b contains the Hermitian positive definite matrix B
+template <Backend B, Device D, class T>
+void genEigensolverFactorize(blas::Uplo uplo, Matrix<T, D>& mat_b) {
+  DLAF_ASSERT(matrix::local_matrix(mat_b), mat_b);
+  DLAF_ASSERT(matrix::square_size(mat_b), mat_b);
+  DLAF_ASSERT(matrix::square_blocksize(mat_b), mat_b);
+
+  factorization::cholesky<B>(uplo, mat_b);
+}
+
+/// Cholesky factorization of the B matrix of the generalized eigenvalue problem.
+///
+/// It computes the Cholesky factor of B, which can then be passed to genEigensolverFactorized, so that
+/// it can be computed just once for multiple generalized eigenvalue problems sharing the same B
+/// (e.g. the overlap matrix in self-consistent iterations).
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_b contains the
+/// Cholesky factor of B, the other triangle is not referenced.
+///
+/// Implementation on distributed memory.
+///
+/// @param grid is the communicator grid on which the matrix @p mat_b has been distributed,
+/// @param uplo specifies if upper or lower triangular part of @p mat_b will be referenced
+/// @param mat_b contains the Hermitian positive definite matrix B
+template <Backend B, Device D, class T>
+void genEigensolverFactorize(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_b) {
+  DLAF_ASSERT(matrix::equal_process_grid(mat_b, grid), mat_b, grid);
+  DLAF_ASSERT(matrix::square_size(mat_b), mat_b);
+  DLAF_ASSERT(matrix::square_blocksize(mat_b), mat_b);
+
+  factorization::cholesky<B>(grid, uplo, mat_b);
+}
+
+/// Generalized Eigensolver (pre-factorized B).
+///
+/// It solves the generalized eigenvalue problem A * x = lambda * B * x, where the Cholesky
+/// factorization of B has already been computed (e.g. with genEigensolverFactorize).
+///
+/// On exit:
+/// - the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+/// - @p mat_b_factor is not modified
+/// - @p eigenvalues contains all the eigenvalues lambda
+/// - @p eigenvectors contains all the eigenvectors x
+///
+/// Implementation on local memory.
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat_a and @p mat_b_factor will be
+/// referenced
+/// @param mat_a contains the Hermitian matrix A
+/// @param mat_b_factor contains the Cholesky factor of the Hermitian positive definite matrix B
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+/// @param eigenvectors is a N x N matrix which on output contains the eigenvectors
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvectors are ready (see EigensolverReport)
+template <Backend B, Device D, class T>
+void genEigensolverFactorized(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<const T, D>& mat_b_factor,
+                              Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
+                              EigensolverReport* report = nullptr) {
+  DLAF_ASSERT(matrix::local_matrix(mat_a), mat_a);
+  DLAF_ASSERT(matrix::local_matrix(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(matrix::local_matrix(eigenvectors), eigenvectors);
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_size(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(matrix::square_blocksize(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(matrix::square_size(eigenvectors), eigenvectors);
+  DLAF_ASSERT(matrix::square_blocksize(eigenvectors), eigenvectors);
+  DLAF_ASSERT(mat_a.size() == mat_b_factor.size(), mat_a, mat_b_factor);
+  DLAF_ASSERT(mat_a.blockSize() == mat_b_factor.blockSize(), mat_a, mat_b_factor);
+  DLAF_ASSERT(eigenvalues.size().rows() == eigenvectors.size().rows(), eigenvalues, eigenvectors);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == eigenvectors.blockSize().rows(), eigenvalues,
+              eigenvectors);
+  DLAF_ASSERT(eigenvectors.size() == mat_a.size(), eigenvectors, mat_a);
+  DLAF_ASSERT(eigenvectors.blockSize() == mat_a.blockSize(), eigenvectors, mat_a);
+
+  internal::GenEigensolver<B, D, T>::callFactorized(uplo, mat_a, mat_b_factor, eigenvalues,
+                                                    eigenvectors, report);
+}
+
+/// Generalized Eigensolver (pre-factorized B).
+///
+/// It solves the generalized eigenvalue problem A * x = lambda * B * x, where the Cholesky
+/// factorization of B has already been computed (e.g. with genEigensolverFactorize).
+///
+/// On exit:
+/// - the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+/// - @p mat_b_factor is not modified
+/// - @p eigenvalues contains all the eigenvalues lambda
+/// - @p eigenvectors contains all the eigenvectors x
+///
+/// Implementation on distributed memory.
+///
+/// @param grid is the communicator grid on which the matrices @p mat_a and @p mat_b_factor have been
+/// distributed,
+/// @param uplo specifies if upper or lower triangular part of @p mat_a and @p mat_b_factor will be
+/// referenced
+/// @param mat_a contains the Hermitian matrix A
+/// @param mat_b_factor contains the Cholesky factor of the Hermitian positive definite matrix B
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+/// @param eigenvectors is a N x N matrix which on output contains the eigenvectors
+/// @param report if not nullptr, the performance figures of the stages of the eigensolver are appended
+///        to it once @p eigenvectors are ready (see EigensolverReport)
+template <Backend B, Device D, class T>
+void genEigensolverFactorized(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                              Matrix<const T, D>& mat_b_factor, Matrix<BaseType<T>, D>& eigenvalues,
+                              Matrix<T, D>& eigenvectors, EigensolverReport* report = nullptr) {
+  DLAF_ASSERT(matrix::equal_process_grid(mat_a, grid), mat_a, grid);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_b_factor, grid), mat_b_factor, grid);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(matrix::equal_process_grid(eigenvectors, grid), eigenvectors, grid);
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_size(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(matrix::square_blocksize(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(matrix::square_size(eigenvectors), eigenvectors);
+  DLAF_ASSERT(matrix::square_blocksize(eigenvectors), eigenvectors);
+  DLAF_ASSERT(mat_a.size() == mat_b_factor.size(), mat_a, mat_b_factor);
+  DLAF_ASSERT(mat_a.blockSize() == mat_b_factor.blockSize(), mat_a, mat_b_factor);
+  DLAF_ASSERT(eigenvalues.size().rows() == eigenvectors.size().rows(), eigenvalues, eigenvectors);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == eigenvectors.blockSize().rows(), eigenvalues,
+              eigenvectors);
+  DLAF_ASSERT(eigenvectors.size() == mat_a.size(), eigenvectors, mat_a);
+  DLAF_ASSERT(eigenvectors.blockSize() == mat_a.blockSize(), eigenvectors, mat_a);
+
+  internal::GenEigensolver<B, D, T>::callFactorized(grid, uplo, mat_a, mat_b_factor, eigenvalues,
+                                                    eigenvectors, report);
+}
+
+/// Generalized Eigensolver (pre-factorized B, eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the generalized eigenvalue problem A * x = lambda * B * x,
+/// without computing any eigenvector, where the Cholesky factorization of B has already been computed
+/// (e.g. with genEigensolverFactorize).
+///
+/// On exit:
+/// - the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+/// - @p eigenvalues contains all the eigenvalues lambda in ascending order
+///
+/// Implementation on local memory.
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat_a and @p mat_b_factor will be
+/// referenced
+/// @param mat_a contains the Hermitian matrix A
+/// @param mat_b_factor contains the Cholesky factor of the Hermitian positive definite matrix B
+/// @param eigenvalues is a N x 1 matrix which on output contains the eigenvalues
+template <Backend B, Device D, class T>
+void genEigensolverFactorized(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<const T, D>& mat_b_factor,
+                              Matrix<BaseType<T>, D>& eigenvalues) {
+  DLAF_ASSERT(matrix::local_matrix(mat_a), mat_a);
+  DLAF_ASSERT(matrix::local_matrix(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_size(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(matrix::square_blocksize(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(mat_a.size() == mat_b_factor.size(), mat_a, mat_b_factor);
+  DLAF_ASSERT(mat_a.blockSize() == mat_b_factor.blockSize(), mat_a, mat_b_factor);
+  DLAF_ASSERT(eigenvalues.size() == GlobalElementSize(mat_a.size().rows(), 1), eigenvalues, mat_a);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat_a.blockSize().rows(), eigenvalues, mat_a);
+
+  internal::GenEigensolver<B, D, T>::callFactorized(uplo, mat_a, mat_b_factor, eigenvalues);
+}
+
+/// Generalized Eigensolver (pre-factorized B, eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the generalized eigenvalue problem A * x = lambda * B * x,
+/// without computing any eigenvector, where the Cholesky factorization of B has already been computed
+/// (e.g. with genEigensolverFactorize).
+///
+/// On exit:
+/// - the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+/// - @p eigenvalues contains all the eigenvalues lambda in ascending order
+///
+/// Implementation on distributed memory.
+///
+/// @param grid is the communicator grid on which the matrices @p mat_a and @p mat_b_factor have been
+/// distributed,
+/// @param uplo specifies if upper or lower triangular part of @p mat_a and @p mat_b_factor will be
+/// referenced
+/// @param mat_a contains the Hermitian matrix A
+/// @param mat_b_factor contains the Cholesky factor of the Hermitian positive definite matrix B
+/// @param eigenvalues is a N x 1 local matrix which on output contains the eigenvalues
+template <Backend B, Device D, class T>
+void genEigensolverFactorized(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                              Matrix<const T, D>& mat_b_factor, Matrix<BaseType<T>, D>& eigenvalues) {
+  DLAF_ASSERT(matrix::equal_process_grid(mat_a, grid), mat_a, grid);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_b_factor, grid), mat_b_factor, grid);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_size(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(matrix::square_blocksize(mat_b_factor), mat_b_factor);
+  DLAF_ASSERT(mat_a.size() == mat_b_factor.size(), mat_a, mat_b_factor);
+  DLAF_ASSERT(mat_a.blockSize() == mat_b_factor.blockSize(), mat_a, mat_b_factor);
+  DLAF_ASSERT(eigenvalues.size() == GlobalElementSize(mat_a.size().rows(), 1), eigenvalues, mat_a);
+  DLAF_ASSERT(eigenvalues.blockSize().rows() == mat_a.blockSize().rows(), eigenvalues, mat_a);
+
+  internal::GenEigensolver<B, D, T>::callFactorized(grid, uplo, mat_a, mat_b_factor, eigenvalues);
+}
 }
@@ -18,10 +18,33 @@ namespace dlaf::eigensolver::internal {
 template <Backend backend, Device device, class T>
 struct GenEigensolver {
   static void call(blas::Uplo uplo, Matrix<T, device>& mat_a, Matrix<T, device>& mat_b,
-                   Matrix<BaseType<T>, device>& eigenvalues, Matrix<T, device>& eigenvectors);
+                   Matrix<BaseType<T>, device>& eigenvalues, Matrix<T, device>& eigenvectors,
+                   EigensolverReport* report = nullptr);
   static void call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, device>& mat_a,
                    Matrix<T, device>& mat_b, Matrix<BaseType<T>, device>& eigenvalues,
-                   Matrix<T, device>& eigenvectors);
+                   Matrix<T, device>& eigenvectors, EigensolverReport* report = nullptr);
+
+  static void call(blas::Uplo uplo, Matrix<T, device>& mat_a, Matrix<T, device>& mat_b,
+                   Matrix<BaseType<T>, device>& eigenvalues);
+  static void call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, device>& mat_a,
+                   Matrix<T, device>& mat_b, Matrix<BaseType<T>, device>& eigenvalues);
+
+  // Variants in which mat_b_factor already contains the Cholesky factor of B, which is only read.
+  static void callFactorized(blas::Uplo uplo, Matrix<T, device>& mat_a,
+                             Matrix<const T, device>& mat_b_factor,
+                             Matrix<BaseType<T>, device>& eigenvalues, Matrix<T, device>& eigenvectors,
+                             EigensolverReport* report = nullptr);
+  static void callFactorized(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, device>& mat_a,
+                             Matrix<const T, device>& mat_b_factor,
+                             Matrix<BaseType<T>, device>& eigenvalues, Matrix<T, device>& eigenvectors,
+                             EigensolverReport* report = nullptr);
+
+  static void callFactorized(blas::Uplo uplo, Matrix<T, device>& mat_a,
+                             Matrix<const T, device>& mat_b_factor,
+                             Matrix<BaseType<T>, device>& eigenvalues);
+  static void callFactorized(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, device>& mat_a,
+                             Matrix<const T, device>& mat_b_factor,
+                             Matrix<BaseType<T>, device>& eigenvalues);
 };
 
 // ETI
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <dlaf/eigensolver/eigensolver.h>
+#include <dlaf/eigensolver/eigensolver/report.h>
 #include <dlaf/eigensolver/gen_eigensolver/api.h>
 #include <dlaf/eigensolver/gen_to_std.h>
 #include <dlaf/factorization/cholesky.h>
@@ -19,29 +20,118 @@
 
 namespace dlaf::eigensolver::internal {
 
+template <Backend B, Device D, class T>
+void solveWithFactor(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<const T, D>& mat_b_factor,
+                     Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
+                     EigensolverReportRecorder& recorder) {
+  const double n = mat_a.size().rows();
+
+  eigensolver::genToStd<B>(uplo, mat_a, mat_b_factor);
+  recorder.addStage("gen_to_std", genToStdFlops<T>(n), 0, mat_a);
+
+  EigensolverPlan<T, D> plan(eigenvectors.distribution());
+  Eigensolver<B, D, T>::call(plan, uplo, mat_a, eigenvalues, eigenvectors, recorder);
+
+  solver::triangular<B>(blas::Side::Left, uplo, blas::Op::ConjTrans, blas::Diag::NonUnit, T(1),
+                        mat_b_factor, eigenvectors);
+  recorder.addStage("bt_cholesky", triangularSolverFlops<T>(n, n), 0, eigenvectors);
+  recorder.finish(eigenvectors);
+}
+
+template <Backend B, Device D, class T>
+void solveWithFactor(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                     Matrix<const T, D>& mat_b_factor, Matrix<BaseType<T>, D>& eigenvalues,
+                     Matrix<T, D>& eigenvectors, EigensolverReportRecorder& recorder) {
+  const double n = mat_a.size().rows();
+  const CommunicationModel comm_model(grid.size());
+
+  eigensolver::genToStd<B>(grid, uplo, mat_a, mat_b_factor);
+  recorder.addStage("gen_to_std", genToStdFlops<T>(n), comm_model.hermitianPanels<T>(n), mat_a);
+
+  EigensolverPlan<T, D> plan(grid, eigenvectors.distribution());
+  Eigensolver<B, D, T>::call(grid, plan, uplo, mat_a, eigenvalues, eigenvectors, recorder);
+
+  solver::triangular<B>(grid, blas::Side::Left, uplo, blas::Op::ConjTrans, blas::Diag::NonUnit, T(1),
+                        mat_b_factor, eigenvectors);
+  recorder.addStage("bt_cholesky", triangularSolverFlops<T>(n, n),
+                    comm_model.backTransformation<T>(n, n), eigenvectors);
+  recorder.finish(eigenvectors);
+}
+
 template <Backend B, Device D, class T>
 void GenEigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<T, D>& mat_b,
-                                   Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors) {
-  factorization::cholesky<B>(uplo, mat_b);
-  eigensolver::genToStd<B>(uplo, mat_a, mat_b);
+                                   Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
+                                   EigensolverReport* report) {
+  const double n = mat_a.size().rows();
+  EigensolverReportRecorder recorder(report);
 
-  eigensolver::eigensolver<B>(uplo, mat_a, eigenvalues, eigenvectors);
+  factorization::cholesky<B>(uplo, mat_b);
+  recorder.addStage("cholesky", choleskyFlops<T>(n), 0, mat_b);
 
-  solver::triangular<B>(blas::Side::Left, uplo, blas::Op::ConjTrans, blas::Diag::NonUnit, T(1), mat_b,
-                        eigenvectors);
+  solveWithFactor<B>(uplo, mat_a, mat_b, eigenvalues, eigenvectors, recorder);
 }
 
 template <Backend B, Device D, class T>
 void GenEigensolver<B, D, T>::call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
                                    Matrix<T, D>& mat_b, Matrix<BaseType<T>, D>& eigenvalues,
-                                   Matrix<T, D>& eigenvectors) {
+                                   Matrix<T, D>& eigenvectors, EigensolverReport* report) {
+  const double n = mat_a.size().rows();
+  const CommunicationModel comm_model(grid.size());
+  EigensolverReportRecorder recorder(report);
+
   factorization::cholesky<B>(grid, uplo, mat_b);
-  eigensolver::genToStd<B>(grid, uplo, mat_a, mat_b);
+  recorder.addStage("cholesky", choleskyFlops<T>(n), comm_model.triangularPanels<T>(n), mat_b);
 
-  eigensolver::eigensolver<B>(grid, uplo, mat_a, eigenvalues, eigenvectors);
+  solveWithFactor<B>(grid, uplo, mat_a, mat_b, eigenvalues, eigenvectors, recorder);
+}
 
-  solver::triangular<B>(grid, blas::Side::Left, uplo, blas::Op::ConjTrans, blas::Diag::NonUnit, T(1),
-                        mat_b, eigenvectors);
+template <Backend B, Device D, class T>
+void GenEigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<T, D>& mat_b,
+                                   Matrix<BaseType<T>, D>& eigenvalues) {
+  factorization::cholesky<B>(uplo, mat_b);
+  callFactorized(uplo, mat_a, mat_b, eigenvalues);
+}
+
+template <Backend B, Device D, class T>
+void GenEigensolver<B, D, T>::call(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                   Matrix<T, D>& mat_b, Matrix<BaseType<T>, D>& eigenvalues) {
+  factorization::cholesky<B>(grid, uplo, mat_b);
+  callFactorized(grid, uplo, mat_a, mat_b, eigenvalues);
 }
 
+template <Backend B, Device D, class T>
+void GenEigensolver<B, D, T>::callFactorized(blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                             Matrix<const T, D>& mat_b_factor,
+                                             Matrix<BaseType<T>, D>& eigenvalues,
+                                             Matrix<T, D>& eigenvectors, EigensolverReport* report) {
+  EigensolverReportRecorder recorder(report);
+  solveWithFactor<B>(uplo, mat_a, mat_b_factor, eigenvalues, eigenvectors, recorder);
+}
+
+template <Backend B, Device D, class T>
+void GenEigensolver<B, D, T>::callFactorized(comm::CommunicatorGrid grid, blas::Uplo uplo,
+                                             Matrix<T, D>& mat_a, Matrix<const T, D>& mat_b_factor,
+                                             Matrix<BaseType<T>, D>& eigenvalues,
+                                             Matrix<T, D>& eigenvectors, EigensolverReport* report) {
+  EigensolverReportRecorder recorder(report);
+  solveWithFactor<B>(grid, uplo, mat_a, mat_b_factor, eigenvalues, eigenvectors, recorder);
+}
+
+template <Backend B, Device D, class T>
+void GenEigensolver<B, D, T>::callFactorized(blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                             Matrix<const T, D>& mat_b_factor,
+                                             Matrix<BaseType<T>, D>& eigenvalues) {
+  eigensolver::genToStd<B>(uplo, mat_a, mat_b_factor);
+
+  eigensolver::eigensolver<B>(uplo, mat_a, eigenvalues);
+}
+
+template <Backend B, Device D, class T>
+void GenEigensolver<B, D, T>::callFactorized(comm::CommunicatorGrid grid, blas::Uplo uplo,
+                                             Matrix<T, D>& mat_a, Matrix<const T, D>& mat_b_factor,
+                                             Matrix<BaseType<T>, D>& eigenvalues) {
+  eigensolver::genToStd<B>(grid, uplo, mat_a, mat_b_factor);
+
+  eigensolver::eigensolver<B>(grid, uplo, mat_a, eigenvalues);
+}
 }
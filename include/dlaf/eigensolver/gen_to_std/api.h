@@ -18,10 +18,12 @@ namespace internal {
 
 template <Backend backend, Device device, class T>
 struct GenToStd {
-  static void call_L(Matrix<T, device>& mat_a, Matrix<T, device>& mat_l);
-  static void call_L(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a, Matrix<T, device>& mat_l);
-  static void call_U(Matrix<T, device>& mat_a, Matrix<T, device>& mat_u);
-  static void call_U(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a, Matrix<T, device>& mat_u);
+  static void call_L(Matrix<T, device>& mat_a, Matrix<const T, device>& mat_l);
+  static void call_L(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a,
+                     Matrix<const T, device>& mat_l);
+  static void call_U(Matrix<T, device>& mat_a, Matrix<const T, device>& mat_u);
+  static void call_U(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a,
+                     Matrix<const T, device>& mat_u);
 };
 
 // ETI
@@ -195,7 +195,8 @@ void gemmPanelUpdateTile(pika::execution::thread_priority priority, LIJSender&&
 // Implementation based on LAPACK Algorithm for the transformation from generalized to standard
 // eigenproblem (xHEGST)
 template <Backend backend, Device device, class T>
-void GenToStd<backend, device, T>::call_L(Matrix<T, device>& mat_a, Matrix<T, device>& mat_l) {
+void GenToStd<backend, device, T>::call_L(Matrix<T, device>& mat_a,
+                                          Matrix<const T, device>& mat_l) {
   using namespace gentostd_l;
   using pika::execution::thread_priority;
 
@@ -206,7 +207,7 @@ void GenToStd<backend, device, T>::call_L(Matrix<T, device>& mat_a, Matrix<T, de
     const LocalTileIndex kk{k, k};
 
     // Direct transformation to standard eigenvalue problem of the diagonal tile
-    hegstDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk), mat_l.readwrite(kk));
+    hegstDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk), mat_l.read(kk));
 
     // If there is no trailing matrix
     if (k == nrtile - 1)
@@ -260,7 +261,7 @@ void GenToStd<backend, device, T>::call_L(Matrix<T, device>& mat_a, Matrix<T, de
 
 template <Backend backend, Device device, class T>
 void GenToStd<backend, device, T>::call_L(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a,
-                                          Matrix<T, device>& mat_l) {
+                                          Matrix<const T, device>& mat_l) {
   using namespace gentostd_l;
   using pika::execution::thread_priority;
   namespace ex = pika::execution::experimental;
@@ -357,7 +358,7 @@ void GenToStd<backend, device, T>::call_L(comm::CommunicatorGrid grid, Matrix<T,
 
     // Direct transformation to standard eigenvalue problem of the diagonal tile
     if (kk_rank == this_rank)
-      hegstDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk), mat_l.readwrite(kk));
+      hegstDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk), mat_l.read(kk));
 
     // If there is no trailing matrix
     if (k == nrtile - 1)
@@ -459,7 +460,8 @@ void GenToStd<backend, device, T>::call_L(comm::CommunicatorGrid grid, Matrix<T,
 }
 
 template <Backend backend, Device device, class T>
-void GenToStd<backend, device, T>::call_U(Matrix<T, device>& mat_a, Matrix<T, device>& mat_u) {
+void GenToStd<backend, device, T>::call_U(Matrix<T, device>& mat_a,
+                                          Matrix<const T, device>& mat_u) {
   using namespace gentostd_u;
   using pika::execution::thread_priority;
 
@@ -470,7 +472,7 @@ void GenToStd<backend, device, T>::call_U(Matrix<T, device>& mat_a, Matrix<T, de
     const LocalTileIndex kk{k, k};
 
     // Direct transformation to standard eigenvalue problem of the diagonal tile
-    hegstDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk), mat_u.readwrite(kk));
+    hegstDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk), mat_u.read(kk));
 
     // If there is no trailing matrix
     if (k == nrtile - 1)
@@ -524,7 +526,7 @@ void GenToStd<backend, device, T>::call_U(Matrix<T, device>& mat_a, Matrix<T, de
 
 template <Backend backend, Device device, class T>
 void GenToStd<backend, device, T>::call_U(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a,
-                                          Matrix<T, device>& mat_u) {
+                                          Matrix<const T, device>& mat_u) {
   using namespace gentostd_u;
   using pika::execution::thread_priority;
 
@@ -621,7 +623,7 @@ void GenToStd<backend, device, T>::call_U(comm::CommunicatorGrid grid, Matrix<T,
 
     // Direct transformation to standard eigenvalue problem of the diagonal tile
     if (kk_rank == this_rank)
-      hegstDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk), mat_u.readwrite(kk));
+      hegstDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk), mat_u.read(kk));
 
     // If there is no trailing matrix
     if (k == nrtile - 1)
@@ -0,0 +1,113 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+
+#include <dlaf/types.h>
+#include <dlaf/util_math.h>
+
+namespace dlaf::eigensolver::internal {
+
+/// Self-tuning choice of the number of workers and of the barrier busy-wait duration of the
+/// multi-threaded algorithms made of iterations of phases separated by barriers (e.g. the panel of the
+/// reduction to band, or the rank1 problem of the tridiagonal solver).
+///
+/// - The number of workers is chosen such that each worker gets at least min_work_per_worker elements
+///   of work (e.g. rows of the panel), up to the given maximum number of workers.
+/// - The busy-wait duration is chosen from the expected duration of a phase, which is estimated from
+///   the measured durations of the previous calls (exponential moving average of the time per element
+///   of work per worker). If a phase is expected to be shorter than the maximum busy-wait duration, the
+///   workers spin for twice its expected duration (the wakeup latency would dominate), otherwise they do
+///   not spin at all (such that the cores are left to other tasks).
+///   The maximum busy-wait duration is used until the first measurement is available.
+///
+/// The last choices are kept for reporting purposes.
+class AdaptiveWorkersPolicy {
+public:
+  AdaptiveWorkersPolicy(const SizeType min_work_per_worker, const std::size_t phases_per_iteration)
+      : min_work_per_worker_(min_work_per_worker), phases_per_iteration_(phases_per_iteration) {}
+
+  /// Returns the number of workers to use for the given amount of work, which can be split in at most
+  /// max_chunks chunks.
+  std::size_t nworkers(const std::size_t max_workers, const SizeType work,
+                       const std::size_t max_chunks) noexcept {
+    const std::size_t nworkers_work =
+        to_sizet(std::max<SizeType>(1, util::ceilDiv(work, min_work_per_worker_)));
+    const std::size_t nworkers = std::clamp<std::size_t>(std::min(nworkers_work, max_chunks), 1,
+                                                         std::max<std::size_t>(1, max_workers));
+    last_nworkers_.store(nworkers, std::memory_order_relaxed);
+    return nworkers;
+  }
+
+  /// Returns the busy-wait duration for the given amount of work split among nworkers workers.
+  std::chrono::duration<double> busyWait(const std::chrono::duration<double> max_busy_wait,
+                                         const SizeType work, const std::size_t nworkers) noexcept {
+    std::chrono::duration<double> busy_wait = max_busy_wait;
+
+    const double time_per_element = time_per_element_.load(std::memory_order_relaxed);
+    if (time_per_element > 0) {
+      const std::chrono::duration<double> phase(time_per_element * static_cast<double>(work) /
+                                                static_cast<double>(nworkers * phases_per_iteration_));
+      busy_wait = phase <= max_busy_wait ? std::min(2 * phase, max_busy_wait)
+                                         : std::chrono::duration<double>(0);
+    }
+
+    last_busy_wait_.store(busy_wait.count(), std::memory_order_relaxed);
+    return busy_wait;
+  }
+
+  /// Records the duration of a call made of nr_iterations iterations of the given amount of work split
+  /// among nworkers workers.
+  void update(const double elapsed, const SizeType nr_iterations, const SizeType work,
+              const std::size_t nworkers) noexcept {
+    if (nr_iterations <= 0 || work <= 0)
+      return;
+
+    constexpr double alpha = 0.25;
+    const double time_per_element = elapsed / static_cast<double>(nr_iterations) *
+                                    static_cast<double>(nworkers) / static_cast<double>(work);
+
+    // Note:
+    // The policy can be updated concurrently (e.g. by independent rank1 problems solved at the same
+    // time), hence the moving average is updated atomically such that no measurement gets lost.
+    double old = time_per_element_.load(std::memory_order_relaxed);
+    double updated;
+    do {
+      updated = old > 0 ? (1 - alpha) * old + alpha * time_per_element : time_per_element;
+    } while (!time_per_element_.compare_exchange_weak(old, updated, std::memory_order_relaxed));
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const AdaptiveWorkersPolicy& policy) {
+    const double time_per_element = policy.time_per_element_.load(std::memory_order_relaxed);
+    os << "last_nworkers = " << policy.last_nworkers_.load(std::memory_order_relaxed)
+       << ", last_barrier_busy_wait_us = "
+       << policy.last_busy_wait_.load(std::memory_order_relaxed) * 1e6 << ", time_per_element_us = ";
+    if (time_per_element > 0)
+      os << time_per_element * 1e6;
+    else
+      os << "n/a";
+    return os;
+  }
+
+private:
+  SizeType min_work_per_worker_;
+  std::size_t phases_per_iteration_;
+
+  std::atomic<double> time_per_element_{0};
+  std::atomic<std::size_t> last_nworkers_{0};
+  std::atomic<double> last_busy_wait_{0};
+};
+
+}
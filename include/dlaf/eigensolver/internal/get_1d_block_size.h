@@ -9,13 +9,16 @@
 //
 #pragma once
 
+#include <algorithm>
+
 #include <dlaf/common/assert.h>
 #include <dlaf/tune.h>
 #include <dlaf/types.h>
+#include <dlaf/util_math.h>
 
 namespace dlaf::eigensolver::internal {
 
-// Returns max(1, getTuneParameters().eigensolver_min_band / nb * nb).
+// Returns max(1, getTuneParameters().band_to_tridiag_1d_block_size_base / nb * nb).
 inline SizeType get1DBlockSize(const SizeType nb) noexcept {
   const SizeType nb_base = getTuneParameters().band_to_tridiag_1d_block_size_base;
 
@@ -25,4 +28,26 @@ inline SizeType get1DBlockSize(const SizeType nb) noexcept {
   return std::max<SizeType>(1, nb_base / nb * nb);
 }
 
+// Returns the 1D block size for the distribution of a band matrix of size size on nr_ranks ranks.
+//
+// It is get1DBlockSize(nb), limited such that each rank gets at least
+// k = getTuneParameters().band_to_tridiag_1d_min_blocks_per_rank blocks (assigned in round-robin),
+// i.e. min(get1DBlockSize(nb), max(nb, ceilDiv(size, k * nr_ranks) / nb * nb)).
+// If k is 0 the block size is not limited.
+inline SizeType get1DBlockSize(const SizeType nb, const SizeType size,
+                               const SizeType nr_ranks) noexcept {
+  const SizeType min_blocks = getTuneParameters().band_to_tridiag_1d_min_blocks_per_rank;
+
+  DLAF_ASSERT(size >= 0, size);
+  DLAF_ASSERT(nr_ranks >= 1, nr_ranks);
+  DLAF_ASSERT(min_blocks >= 0, min_blocks);
+
+  const SizeType nb_1d = get1DBlockSize(nb);
+  if (min_blocks == 0)
+    return nb_1d;
+
+  const SizeType nb_max = util::ceilDiv(size, min_blocks * nr_ranks) / nb * nb;
+  return std::min(nb_1d, std::max(nb, nb_max));
+}
+
 }
@@ -30,4 +30,22 @@ inline SizeType getBandSize(const SizeType nb) noexcept {
   return nb;
 }
 
+// Returns the band size of the intermediate band matrix used to reduce a band matrix with band size
+// band_size to tridiagonal form, i.e. the largest divisor of band_size not larger than
+// b_max = getTuneParameters().eigensolver_intermediate_band.
+// If no divisor larger than 1 exists (e.g. b_max < 2) or b_max >= band_size returns band_size, which
+// means that the band matrix is directly reduced to tridiagonal form.
+inline SizeType getIntermediateBandSize(const SizeType band_size) noexcept {
+  const SizeType b_max = getTuneParameters().eigensolver_intermediate_band;
+
+  DLAF_ASSERT(band_size >= 2, band_size);
+  DLAF_ASSERT(b_max >= 0, b_max);
+
+  for (SizeType div = b_max; div > 1 && div < band_size; --div) {
+    if (band_size % div == 0)
+      return div;
+  }
+  return band_size;
+}
+
 }
@@ -10,8 +10,11 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 
-#include "dlaf/tune.h"
+#include <dlaf/eigensolver/internal/get_red2band_panel_nworkers.h>
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
 
 namespace dlaf::eigensolver::internal {
 
@@ -19,4 +22,14 @@ inline std::chrono::duration<double> getReductionToBandBarrierBusyWait() noexcep
   return std::chrono::microseconds(getTuneParameters().red2band_barrier_busy_wait_us);
 }
 
+// Returns the busy-wait duration for computing a panel with nrows rows in total with nworkers workers
+// (adaptive if red2band_panel_adaptive is set, otherwise the configured duration).
+inline std::chrono::duration<double> getReductionToBandBarrierBusyWait(const std::size_t nworkers,
+                                                                       const SizeType nrows) noexcept {
+  const auto max_busy_wait = getReductionToBandBarrierBusyWait();
+  if (!getTuneParameters().red2band_panel_adaptive)
+    return max_busy_wait;
+  return getReductionToBandPanelPolicy().busyWait(max_busy_wait, nrows, nworkers);
+}
+
 }
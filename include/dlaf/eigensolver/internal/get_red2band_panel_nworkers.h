@@ -14,7 +14,9 @@
 
 #include <pika/runtime.hpp>
 
+#include <dlaf/eigensolver/internal/adaptive_workers.h>
 #include <dlaf/tune.h>
+#include <dlaf/types.h>
 
 namespace dlaf::eigensolver::internal {
 
@@ -28,4 +30,20 @@ inline size_t getReductionToBandPanelNWorkers() noexcept {
   return std::clamp(nworkers, min_workers, max_workers);
 }
 
+inline AdaptiveWorkersPolicy& getReductionToBandPanelPolicy() noexcept {
+  // Note: each worker updates at least 256 rows of the panel, in 4 phases per reflector.
+  static AdaptiveWorkersPolicy policy(256, 4);
+  return policy;
+}
+
+// Returns the number of workers for computing a panel of nr_tiles (local) tiles, with nrows rows in
+// total (adaptive if red2band_panel_adaptive is set, otherwise the maximum number of workers).
+inline std::size_t getReductionToBandPanelNWorkers(const std::size_t nr_tiles,
+                                                   const SizeType nrows) noexcept {
+  const std::size_t max_workers = getReductionToBandPanelNWorkers();
+  if (!getTuneParameters().red2band_panel_adaptive)
+    return max_workers;
+  return getReductionToBandPanelPolicy().nworkers(max_workers, nrows, nr_tiles);
+}
+
 }
@@ -0,0 +1,22 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <dlaf/eigensolver/tridiag_solver/memory_mode.h>
+#include <dlaf/tune.h>
+
+namespace dlaf::eigensolver::internal {
+
+inline TridiagMemoryMode getTridiagMemoryMode() noexcept {
+  return getTuneParameters().tridiag_memory_lean ? TridiagMemoryMode::Lean
+                                                 : TridiagMemoryMode::Standard;
+}
+
+}
@@ -10,8 +10,11 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 
-#include "dlaf/tune.h"
+#include <dlaf/eigensolver/internal/get_tridiag_rank1_nworkers.h>
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
 
 namespace dlaf::eigensolver::internal {
 
@@ -19,4 +22,14 @@ inline std::chrono::duration<double> getTridiagRank1BarrierBusyWait() noexcept {
   return std::chrono::microseconds(getTuneParameters().tridiag_rank1_barrier_busy_wait_us);
 }
 
+// Returns the busy-wait duration for solving a rank1 problem of size n with nworkers workers (adaptive
+// if tridiag_rank1_adaptive is set, otherwise the configured duration).
+inline std::chrono::duration<double> getTridiagRank1BarrierBusyWait(const std::size_t nworkers,
+                                                                    const SizeType n) noexcept {
+  const auto max_busy_wait = getTridiagRank1BarrierBusyWait();
+  if (!getTuneParameters().tridiag_rank1_adaptive)
+    return max_busy_wait;
+  return getTridiagRank1Policy().busyWait(max_busy_wait, n, nworkers);
+}
+
 }
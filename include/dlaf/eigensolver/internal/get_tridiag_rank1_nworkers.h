@@ -14,7 +14,9 @@
 
 #include <pika/runtime.hpp>
 
-#include "dlaf/tune.h"
+#include <dlaf/eigensolver/internal/adaptive_workers.h>
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
 
 namespace dlaf::eigensolver::internal {
 
@@ -28,4 +30,19 @@ inline std::size_t getTridiagRank1NWorkers() noexcept {
   return std::clamp(nworkers, min_workers, max_workers);
 }
 
+inline AdaptiveWorkersPolicy& getTridiagRank1Policy() noexcept {
+  // Note: each worker computes at least 64 eigenvectors, in 4 phases.
+  static AdaptiveWorkersPolicy policy(64, 4);
+  return policy;
+}
+
+// Returns the number of workers for solving a rank1 problem of size n (adaptive if
+// tridiag_rank1_adaptive is set, otherwise the maximum number of workers).
+inline std::size_t getTridiagRank1NWorkers(const SizeType n) noexcept {
+  const std::size_t max_workers = getTridiagRank1NWorkers();
+  if (!getTuneParameters().tridiag_rank1_adaptive)
+    return max_workers;
+  return getTridiagRank1Policy().nworkers(max_workers, n, to_sizet(n));
+}
+
 }
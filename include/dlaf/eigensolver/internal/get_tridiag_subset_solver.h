@@ -0,0 +1,28 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <dlaf/common/assert.h>
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
+
+namespace dlaf::eigensolver::internal {
+
+// Returns true if the k eigenvectors of a subset of the spectrum of a n x n tridiagonal matrix should be
+// computed with MRRR instead of divide and conquer, i.e. if
+// k <= n * getTuneParameters().tridiag_subset_mrrr_max_fraction.
+inline bool useTridiagSubsetSolver(const SizeType n, const SizeType k) noexcept {
+  DLAF_ASSERT(k >= 0 && k <= n, k, n);
+
+  const double max_fraction = getTuneParameters().tridiag_subset_mrrr_max_fraction;
+  return static_cast<double>(k) <= max_fraction * static_cast<double>(n);
+}
+
+}
@@ -12,7 +12,10 @@
 
 #include <pika/future.hpp>
 
+#include <dlaf/common/pipeline.h>
 #include <dlaf/common/vector.h>
+#include <dlaf/communication/communicator.h>
+#include <dlaf/communication/communicator_grid.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/types.h>
 
@@ -24,6 +27,11 @@ struct ReductionToBand {
       Matrix<T, D>& mat_a, const SizeType band_size);
   static common::internal::vector<pika::shared_future<common::internal::vector<T>>> call(
       comm::CommunicatorGrid grid, Matrix<T, D>& mat_a, const SizeType band_size);
+  static common::internal::vector<pika::shared_future<common::internal::vector<T>>> call(
+      common::Pipeline<comm::Communicator>& mpi_col_chain_panel,
+      common::Pipeline<comm::Communicator>& mpi_row_chain,
+      common::Pipeline<comm::Communicator>& mpi_col_chain, Matrix<T, D>& mat_a,
+      const SizeType band_size);
 };
 
 // ETI
@@ -9,8 +9,12 @@
 //
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
+#include <limits>
+#include <memory>
 #include <vector>
 
 #include <pika/barrier.hpp>
@@ -24,6 +28,7 @@
 #include <dlaf/common/range2d.h>
 #include <dlaf/common/round_robin.h>
 #include <dlaf/common/single_threaded_blas.h>
+#include <dlaf/common/timer.h>
 #include <dlaf/common/vector.h>
 #include <dlaf/communication/broadcast_panel.h>
 #include <dlaf/communication/communicator.h>
@@ -46,6 +51,7 @@
 #include <dlaf/matrix/views.h>
 #include <dlaf/schedulers.h>
 #include <dlaf/sender/traits.h>
+#include <dlaf/tune.h>
 #include <dlaf/types.h>
 #include <dlaf/util_math.h>
 #include <dlaf/util_matrix.h>
@@ -217,6 +223,151 @@ void updateTrailingPanel(const bool has_head, const std::vector<matrix::Tile<T,
   }
 }
 
+// Communication-avoiding factorization of the panel (distributed algorithm).
+//
+// The panel A (m x k, m > k) is orthonormalized with the shifted CholeskyQR3 algorithm, i.e. with
+// three iterations of A = A R_i^{-1}, where R_i is the Cholesky factor of the Gram matrix A^H A (shifted
+// in the first iteration to ensure its positive definiteness), such that A = Q R with R = R_3 R_2 R_1.
+// Then the Householder representation is reconstructed (as LAPACK xUNHR_COL) from the LU factorization
+// without pivoting Q - S = V U, where S = diag(s_j) with s_j = -sign(Re q_jj), which gives the
+// reflectors V (unit lower trapezoidal), taus_j = -s_j u_jj and the R factor S R of the Householder QR.
+// Each step requires a single collective, instead of the two collectives per column of the column-wise
+// algorithm.
+template <class T>
+struct PanelCholQRWorkspace {
+  std::vector<common::internal::vector<T>> backup;  // copy of the panel tiles (for the fallback)
+  common::internal::vector<T> r;                     // R factor of the panel (k x k)
+  bool ok = true;
+};
+
+// Computes the upper triangle of the Gram matrix of the tiles in [begin, end) and stores it in g
+// (k x k), followed by the number of rows of the tiles.
+template <Device D, class T>
+void computeGramPanel(const std::vector<matrix::Tile<T, D>>& panel, const SizeType k,
+                      common::internal::vector<T>& g, const std::size_t begin, const std::size_t end) {
+  g = common::internal::vector<T>(k * k + 1, 0);
+
+  common::internal::SingleThreadedBlasScope single;
+
+  for (auto index = begin; index < end; ++index) {
+    const matrix::Tile<const T, D>& tile = panel[index];
+    blas::herk(blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::ConjTrans, k, tile.size().rows(),
+               BaseType<T>(1), tile.ptr(), tile.ld(), BaseType<T>(1), g.data(), k);
+    g[k * k] += T(tile.size().rows());
+  }
+}
+
+// Computes in place the Cholesky factor R_it of the (all-reduced) Gram matrix g of the iteration it and
+// accumulates it in r (r = R_it r).
+// The first iteration shifts the diagonal of g (Fukaya et al.), while the last one checks that the panel
+// has already been orthonormalized by the previous ones.
+// Returns false if the panel is numerically rank deficient.
+template <class T>
+bool computeCholQRFactor(const int it, const int nr_iterations, const SizeType k,
+                         common::internal::vector<T>& g, common::internal::vector<T>& r) {
+  using BT = BaseType<T>;
+
+  if (it == 0) {
+    const BT m = std::real(g[k * k]);
+    BT norm2 = 0;
+    for (SizeType i = 0; i < k; ++i)
+      norm2 += std::real(g[i + i * k]);
+    const BT shift = 11 * (m * k + k * (k + 1)) * std::numeric_limits<BT>::epsilon() * norm2;
+    for (SizeType i = 0; i < k; ++i)
+      g[i + i * k] += shift;
+  }
+  else if (it == nr_iterations - 1) {
+    constexpr BT tol = BT(0.1);
+    for (SizeType j = 0; j < k; ++j)
+      for (SizeType i = 0; i <= j; ++i)
+        if (!(std::abs(g[i + j * k] - (i == j ? T(1) : T(0))) <= tol))
+          return false;
+  }
+
+  common::internal::SingleThreadedBlasScope single;
+
+  if (lapack::potrf(blas::Uplo::Upper, k, g.data(), k) != 0)
+    return false;
+  blas::trmm(blas::Layout::ColMajor, blas::Side::Left, blas::Uplo::Upper, blas::Op::NoTrans,
+             blas::Diag::NonUnit, k, k, T(1), g.data(), k, r.data(), k);
+  return true;
+}
+
+// A = A U^{-1} for the tiles in [begin, end), where U (k x k) is upper triangular.
+// If has_head, the first skip_rows rows of the first tile are left untouched.
+template <Device D, class T>
+void trsmPanel(const bool has_head, const std::vector<matrix::Tile<T, D>>& panel, const SizeType k,
+               const T* u, const SizeType skip_rows, const std::size_t begin, const std::size_t end) {
+  bool has_first_component = has_head;
+
+  common::internal::SingleThreadedBlasScope single;
+
+  for (auto index = begin; index < end; ++index) {
+    const matrix::Tile<T, D>& tile = panel[index];
+    const SizeType first_row = has_first_component ? skip_rows : 0;
+    has_first_component = false;
+
+    const SizeType nrows = tile.size().rows() - first_row;
+    if (nrows > 0)
+      blas::trsm(blas::Layout::ColMajor, blas::Side::Right, blas::Uplo::Upper, blas::Op::NoTrans,
+                 blas::Diag::NonUnit, nrows, k, T(1), u, k, tile.ptr({first_row, 0}), tile.ld());
+  }
+}
+
+// Computes in place the LU factorization without pivoting of Q_1 - S, where Q_1 is the top k x k block
+// of the head tile, and stores s_j = -sign(Re q_jj) in s.
+template <Device D, class T>
+void computeHouseholderReconstructionHead(const matrix::Tile<T, D>& tile_v0, const SizeType k, T* s) {
+  common::internal::SingleThreadedBlasScope single;
+
+  for (SizeType j = 0; j < k; ++j) {
+    T& q_jj = tile_v0({j, j});
+    s[j] = std::signbit(std::real(q_jj)) ? T(1) : T(-1);
+    q_jj -= s[j];
+
+    if (j + 1 < k) {
+      blas::scal(k - (j + 1), T(1) / q_jj, tile_v0.ptr({j + 1, j}), 1);
+      blas::geru(blas::Layout::ColMajor, k - (j + 1), k - (j + 1), T(-1), tile_v0.ptr({j + 1, j}), 1,
+                 tile_v0.ptr({j, j + 1}), tile_v0.ld(), tile_v0.ptr({j + 1, j + 1}), tile_v0.ld());
+    }
+  }
+}
+
+// Copies the tiles in [begin, end) to backup (to_backup == true) or restores them from it.
+template <Device D, class T>
+void copyPanelBackup(const bool to_backup, const std::vector<matrix::Tile<T, D>>& panel,
+                     std::vector<common::internal::vector<T>>& backup, const std::size_t begin,
+                     const std::size_t end) {
+  for (auto index = begin; index < end; ++index) {
+    const matrix::Tile<T, D>& tile = panel[index];
+    const SizeType m = tile.size().rows();
+    const SizeType n = tile.size().cols();
+    auto& tile_backup = backup[index];
+
+    if (to_backup) {
+      tile_backup.resize(m * n);
+      lapack::lacpy(blas::Uplo::General, m, n, tile.ptr(), tile.ld(), tile_backup.data(),
+                    std::max<SizeType>(1, m));
+    }
+    else {
+      lapack::lacpy(blas::Uplo::General, m, n, tile_backup.data(), std::max<SizeType>(1, m),
+                    tile.ptr(), tile.ld());
+    }
+  }
+}
+
+// Returns the index of the global tile column which follows the columns of the trailing matrix (starting
+// at at_offset) containing the next depth panels (of width band_size), i.e. the lookahead columns.
+inline SizeType lookaheadTileColsEnd(const matrix::Distribution& dist,
+                                     const GlobalElementIndex& at_offset, const SizeType band_size,
+                                     const SizeType depth) {
+  const SizeType j_el_end =
+      std::min(dist.size().cols(), at_offset.col() + std::max<SizeType>(0, depth) * band_size);
+  if (j_el_end <= at_offset.col())
+    return dist.globalTileFromGlobalElement<Coord::Col>(at_offset.col());
+  return dist.globalTileFromGlobalElement<Coord::Col>(j_el_end - 1) + 1;
+}
+
 template <Backend B, typename ASender, typename WSender, typename XSender>
 void hemmDiag(pika::execution::thread_priority priority, ASender&& tile_a, WSender&& tile_w,
               XSender&& tile_x) {
@@ -286,21 +437,24 @@ auto computePanelReflectors(MatrixLike& mat_a, const matrix::SubPanelView& panel
   std::vector<matrix::ReadWriteTileSender<T, D>> panel_tiles;
   panel_tiles.reserve(to_sizet(std::distance(panel_view.iteratorLocal().begin(),
                                              panel_view.iteratorLocal().end())));
+  SizeType nrows = 0;
   for (const auto& i : panel_view.iteratorLocal()) {
     const matrix::SubTileSpec& spec = panel_view(i);
+    nrows += spec.size.rows();
     panel_tiles.emplace_back(matrix::splitTile(mat_a.readwrite(i), spec));
   }
 
-  const std::size_t nthreads = getReductionToBandPanelNWorkers();
+  const std::size_t nthreads = getReductionToBandPanelNWorkers(panel_tiles.size(), nrows);
+  const auto barrier_busy_wait = getReductionToBandBarrierBusyWait(nthreads, nrows);
   return ex::when_all(ex::just(std::make_shared<pika::barrier<>>(nthreads)),
                       ex::just(std::vector<common::internal::vector<T>>{}),  // w (internally required)
                       ex::just(common::internal::vector<T>{}),               // taus
                       ex::when_all_vector(std::move(panel_tiles))) |
          ex::transfer(di::getBackendScheduler<Backend::MC>(pika::execution::thread_priority::high)) |
          ex::bulk(nthreads,
-                  [nthreads, nrefls, cols = panel_view.cols()](
+                  [nthreads, nrefls, nrows, barrier_busy_wait, cols = panel_view.cols()](
                       const std::size_t index, auto& barrier_ptr, auto& w, auto& taus, auto& tiles) {
-                    const auto barrier_busy_wait = getReductionToBandBarrierBusyWait();
+                    const common::Timer<> timeit;
                     const std::size_t batch_size = util::ceilDiv(tiles.size(), nthreads);
                     const std::size_t begin = index * batch_size;
                     const std::size_t end = std::min(index * batch_size + batch_size, tiles.size());
@@ -335,6 +489,10 @@ auto computePanelReflectors(MatrixLike& mat_a, const matrix::SubPanelView& panel
                       updateTrailingPanel(has_head, tiles, j, w[0], taus.back(), begin, end);
                       barrier_ptr->arrive_and_wait(barrier_busy_wait);
                     }
+
+                    if (index == 0 && getTuneParameters().red2band_panel_adaptive)
+                      getReductionToBandPanelPolicy().update(timeit.elapsed(), nrefls, nrows,
+                                                             nthreads);
                   }) |
          ex::then([](auto barrier_ptr, auto w, auto taus, auto tiles) {
            di::silenceUnusedWarningFor(barrier_ptr, w, tiles);
@@ -520,7 +678,7 @@ void gemmComputeW2(matrix::Matrix<T, D>& w2, matrix::Panel<Coord::Col, const T,
 template <Backend B, Device D, class T>
 void her2kUpdateTrailingMatrix(const matrix::SubMatrixView& view, matrix::Matrix<T, D>& a,
                                matrix::Panel<Coord::Col, const T, D>& x,
-                               matrix::Panel<Coord::Col, const T, D>& v) {
+                               matrix::Panel<Coord::Col, const T, D>& v, const SizeType lookahead_end) {
   static_assert(std::is_signed_v<BaseType<T>>, "alpha in computations requires to be -1");
 
   using pika::execution::thread_priority;
@@ -529,35 +687,47 @@ void her2kUpdateTrailingMatrix(const matrix::SubMatrixView& view, matrix::Matrix
 
   const LocalTileIndex at_start = view.begin();
 
-  for (SizeType i = at_start.row(); i < dist.localNrTiles().rows(); ++i) {
-    const auto limit = dist.template nextLocalTileFromGlobalTile<Coord::Col>(
+  auto limit = [&dist](const SizeType i) {
+    return dist.template nextLocalTileFromGlobalTile<Coord::Col>(
         dist.template globalTileFromLocalTile<Coord::Row>(i) + 1);
-    for (SizeType j = at_start.col(); j < limit; ++j) {
-      const LocalTileIndex ij_local{i, j};
-      const GlobalTileIndex ij = dist.globalTileIndex(ij_local);
+  };
 
-      const bool is_diagonal_tile = (ij.row() == ij.col());
+  auto update = [&](const LocalTileIndex ij_local, const thread_priority priority) {
+    const GlobalTileIndex ij = dist.globalTileIndex(ij_local);
 
-      auto getSubA = [&a, &view, ij_local]() {
-        return splitTile(a.readwrite(ij_local), view(ij_local));
-      };
+    const bool is_diagonal_tile = (ij.row() == ij.col());
 
-      // The first column of the trailing matrix (except for the very first global tile) has to be
-      // updated first, in order to unlock the next iteration as soon as possible.
-      const auto priority = (j == at_start.col()) ? thread_priority::high : thread_priority::normal;
+    auto getSubA = [&a, &view, ij_local]() {
+      return splitTile(a.readwrite(ij_local), view(ij_local));
+    };
 
-      if (is_diagonal_tile) {
-        her2kDiag<B>(priority, v.read(ij_local), x.read(ij_local), getSubA());
-      }
-      else {
-        // A -= X . V*
-        her2kOffDiag<B>(priority, x.read(ij_local), v.read(transposed(ij_local)), getSubA());
+    if (is_diagonal_tile) {
+      her2kDiag<B>(priority, v.read(ij_local), x.read(ij_local), getSubA());
+    }
+    else {
+      // A -= X . V*
+      her2kOffDiag<B>(priority, x.read(ij_local), v.read(transposed(ij_local)), getSubA());
 
-        // A -= V . X*
-        her2kOffDiag<B>(priority, v.read(ij_local), x.read(transposed(ij_local)), getSubA());
-      }
+      // A -= V . X*
+      her2kOffDiag<B>(priority, v.read(ij_local), x.read(transposed(ij_local)), getSubA());
     }
-  }
+  };
+
+  // Note:
+  // The columns of the trailing matrix containing the next panels (lookahead) are updated first and with
+  // high priority, in order to unlock the next iterations as soon as possible, while the rest of the
+  // trailing matrix is updated with normal priority.
+  const SizeType j_lookahead_end =
+      std::max(at_start.col(), dist.template nextLocalTileFromGlobalTile<Coord::Col>(lookahead_end));
+
+  for (SizeType j = at_start.col(); j < j_lookahead_end; ++j)
+    for (SizeType i = at_start.row(); i < dist.localNrTiles().rows(); ++i)
+      if (j < limit(i))
+        update({i, j}, thread_priority::high);
+
+  for (SizeType i = at_start.row(); i < dist.localNrTiles().rows(); ++i)
+    for (SizeType j = j_lookahead_end; j < limit(i); ++j)
+      update({i, j}, thread_priority::normal);
 }
 
 }
@@ -589,10 +759,111 @@ T computeReflector(const bool has_head, comm::Communicator& communicator,
   return tau;
 }
 
+// Communication-avoiding factorization of the panel (see red2band::PanelCholQRWorkspace), executed by
+// each worker of the panel. k is the number of reflectors, which has to be equal to the panel width.
+// Returns false, after having restored the panel, if the panel is numerically rank deficient, in which
+// case the column-wise algorithm has to be used instead.
+template <Device D, class T>
+bool computePanelReflectorsCholQR(const std::size_t index, const bool rank_has_head, const SizeType k,
+                                  comm::Communicator& communicator, pika::barrier<>& barrier,
+                                  const std::chrono::duration<double> barrier_busy_wait,
+                                  std::vector<common::internal::vector<T>>& w,
+                                  common::internal::vector<T>& taus,
+                                  red2band::PanelCholQRWorkspace<T>& ws,
+                                  const std::vector<matrix::Tile<T, D>>& tiles, const std::size_t begin,
+                                  const std::size_t end) {
+  const bool has_head = rank_has_head && (index == 0);
+
+  if (index == 0) {
+    // Note: the backup buffers keep their storage from the previous panels.
+    ws.backup.resize(tiles.size());
+    ws.r = common::internal::vector<T>(k * k, 0);
+    for (SizeType i = 0; i < k; ++i)
+      ws.r[i + i * k] = T(1);
+    ws.ok = true;
+  }
+  barrier.arrive_and_wait(barrier_busy_wait);
+
+  // STEP1: shifted CholeskyQR3
+  constexpr int nr_iterations = 3;
+  int it = 0;
+  for (; it < nr_iterations; ++it) {
+    red2band::computeGramPanel(tiles, k, w[index], begin, end);
+    barrier.arrive_and_wait(barrier_busy_wait);
+
+    if (index == 0) {
+      dlaf::eigensolver::internal::reduceColumnVectors(w);
+      comm::sync::allReduceInPlace(communicator, MPI_SUM, common::make_data(w[0].data(), w[0].size()));
+      ws.ok = red2band::computeCholQRFactor(it, nr_iterations, k, w[0], ws.r);
+    }
+    barrier.arrive_and_wait(barrier_busy_wait);
+
+    if (!ws.ok)
+      break;
+
+    // Note:
+    // The panel is modified only from here on, hence the backup is not needed if the factorization
+    // of the first Gram matrix fails (i.e. the most common failure for rank deficient panels).
+    if (it == 0)
+      red2band::copyPanelBackup(true, tiles, ws.backup, begin, end);
+
+    red2band::trsmPanel(false, tiles, k, w[0].data(), 0, begin, end);
+    barrier.arrive_and_wait(barrier_busy_wait);
+  }
+
+  // Note:
+  // All the ranks take the same decision, as all of them get the same all-reduced Gram matrix.
+  if (!ws.ok) {
+    if (it > 0) {
+      red2band::copyPanelBackup(false, tiles, ws.backup, begin, end);
+      barrier.arrive_and_wait(barrier_busy_wait);
+    }
+    return false;
+  }
+
+  // STEP2: Householder reconstruction (U and S are available just on the head rank, all the other
+  // ranks contribute to the all-reduce with zeros)
+  if (index == 0) {
+    auto& u_and_s = w[0];
+    u_and_s = common::internal::vector<T>(k * k + k, 0);
+    T* s = u_and_s.data() + k * k;
+
+    if (rank_has_head) {
+      const auto& tile_v0 = tiles[0];
+      red2band::computeHouseholderReconstructionHead(tile_v0, k, s);
+      lapack::lacpy(blas::Uplo::Upper, k, k, tile_v0.ptr(), tile_v0.ld(), u_and_s.data(), k);
+    }
+    comm::sync::allReduceInPlace(communicator, MPI_SUM,
+                                 common::make_data(u_and_s.data(), u_and_s.size()));
+
+    taus.reserve(k);
+    for (SizeType j = 0; j < k; ++j)
+      taus.emplace_back(-s[j] * u_and_s[j + j * k]);
+  }
+  barrier.arrive_and_wait(barrier_busy_wait);
+
+  // STEP3: V_2 = Q_2 U^{-1} (multi-threaded)
+  red2band::trsmPanel(has_head, tiles, k, w[0].data(), k, begin, end);
+
+  // R factor of the Householder QR
+  if (has_head) {
+    const auto& tile_v0 = tiles[0];
+    const T* s = w[0].data() + k * k;
+    for (SizeType j = 0; j < k; ++j)
+      for (SizeType i = 0; i <= j; ++i)
+        tile_v0({i, j}) = s[i] * ws.r[i + j * k];
+  }
+
+  return true;
+}
+
+// Note:
+// ws_cholqr is reused by all the panels, which are serialized by mpi_col_chain_panel.
 template <class MatrixLike, class TriggerSender, class CommSender>
-auto computePanelReflectors(TriggerSender&& trigger, comm::IndexT_MPI rank_v0,
-                            CommSender&& mpi_col_chain_panel, MatrixLike& mat_a,
-                            const matrix::SubPanelView& panel_view, const SizeType nrefls) {
+auto computePanelReflectors(
+    TriggerSender&& trigger, comm::IndexT_MPI rank_v0, CommSender&& mpi_col_chain_panel,
+    MatrixLike& mat_a, const matrix::SubPanelView& panel_view, const SizeType nrefls,
+    std::shared_ptr<red2band::PanelCholQRWorkspace<typename MatrixLike::ElementType>> ws_cholqr) {
   static Device constexpr D = MatrixLike::device;
   using T = typename MatrixLike::ElementType;
   namespace ex = pika::execution::experimental;
@@ -601,26 +872,31 @@ auto computePanelReflectors(TriggerSender&& trigger, comm::IndexT_MPI rank_v0,
   std::vector<matrix::ReadWriteTileSender<T, D>> panel_tiles;
   panel_tiles.reserve(to_sizet(std::distance(panel_view.iteratorLocal().begin(),
                                              panel_view.iteratorLocal().end())));
+  SizeType nrows = 0;
   for (const auto& i : panel_view.iteratorLocal()) {
     const matrix::SubTileSpec& spec = panel_view(i);
+    nrows += spec.size.rows();
     panel_tiles.emplace_back(matrix::splitTile(mat_a.readwrite(i), spec));
   }
 
-  const std::size_t nthreads = getReductionToBandPanelNWorkers();
+  const std::size_t nthreads = getReductionToBandPanelNWorkers(panel_tiles.size(), nrows);
+  const auto barrier_busy_wait = getReductionToBandBarrierBusyWait(nthreads, nrows);
+  const bool use_cholqr = getTuneParameters().red2band_panel_cholqr && nrefls == panel_view.cols();
   return ex::when_all(ex::just(std::make_shared<pika::barrier<>>(nthreads)),
                       ex::just(std::vector<common::internal::vector<T>>{}),  // w (interally required)
                       ex::just(common::internal::vector<T>{}),               // taus
+                      ex::just(std::move(ws_cholqr)),
                       ex::when_all_vector(std::move(panel_tiles)),
                       std::forward<CommSender>(mpi_col_chain_panel),
                       std::forward<TriggerSender>(trigger)) |
          ex::transfer(di::getBackendScheduler<Backend::MC>(pika::execution::thread_priority::high)) |
          ex::bulk(nthreads,
-                  [nthreads, nrefls, rank_v0,
+                  [nthreads, nrefls, nrows, barrier_busy_wait, rank_v0, use_cholqr,
                    cols = panel_view.cols()](const std::size_t index, auto& barrier_ptr, auto& w,
-                                             auto& taus, auto& tiles, auto&& pcomm) {
+                                             auto& taus, auto& ws_cholqr, auto& tiles, auto&& pcomm) {
                     const bool rankHasHead = rank_v0 == pcomm.get().rank();
 
-                    const auto barrier_busy_wait = getReductionToBandBarrierBusyWait();
+                    const common::Timer<> timeit;
                     const std::size_t batch_size = util::ceilDiv(tiles.size(), nthreads);
                     const std::size_t begin = index * batch_size;
                     const std::size_t end = std::min(index * batch_size + batch_size, tiles.size());
@@ -630,6 +906,12 @@ auto computePanelReflectors(TriggerSender&& trigger, comm::IndexT_MPI rank_v0,
                       w.resize(nthreads);
                     }
 
+                    if (use_cholqr &&
+                        computePanelReflectorsCholQR(index, rankHasHead, cols, pcomm.get(),
+                                                     *barrier_ptr, barrier_busy_wait, w, taus,
+                                                     *ws_cholqr, tiles, begin, end))
+                      return;
+
                     for (SizeType j = 0; j < nrefls; ++j) {
                       // STEP1: compute tau and reflector (single-thread)
                       if (index == 0) {
@@ -661,9 +943,13 @@ auto computePanelReflectors(TriggerSender&& trigger, comm::IndexT_MPI rank_v0,
                       updateTrailingPanel(has_head, tiles, j, w[0], taus.back(), begin, end);
                       barrier_ptr->arrive_and_wait(barrier_busy_wait);
                     }
+
+                    if (index == 0 && getTuneParameters().red2band_panel_adaptive)
+                      getReductionToBandPanelPolicy().update(timeit.elapsed(), nrefls, nrows,
+                                                             nthreads);
                   }) |
-         ex::then([](auto barrier_ptr, auto w, auto taus, auto tiles, auto pcomm) {
-           di::silenceUnusedWarningFor(barrier_ptr, w, tiles, pcomm);
+         ex::then([](auto barrier_ptr, auto w, auto taus, auto ws_cholqr, auto tiles, auto pcomm) {
+           di::silenceUnusedWarningFor(barrier_ptr, w, ws_cholqr, tiles, pcomm);
            return taus;
          }) |
          ex::make_future();
@@ -787,7 +1073,8 @@ void her2kUpdateTrailingMatrix(const matrix::SubMatrixView& view, Matrix<T, D>&
                                matrix::Panel<Coord::Col, const T, D>& x,
                                matrix::Panel<Coord::Row, const T, D, matrix::StoreTransposed::Yes>& vt,
                                matrix::Panel<Coord::Col, const T, D>& v,
-                               matrix::Panel<Coord::Row, const T, D, matrix::StoreTransposed::Yes>& xt) {
+                               matrix::Panel<Coord::Row, const T, D, matrix::StoreTransposed::Yes>& xt,
+                               const SizeType lookahead_end) {
   static_assert(std::is_signed_v<BaseType<T>>, "alpha in computations requires to be -1");
 
   using pika::execution::thread_priority;
@@ -796,35 +1083,47 @@ void her2kUpdateTrailingMatrix(const matrix::SubMatrixView& view, Matrix<T, D>&
 
   const LocalTileIndex at_start = view.begin();
 
-  for (SizeType i = at_start.row(); i < dist.localNrTiles().rows(); ++i) {
-    const auto limit = dist.template nextLocalTileFromGlobalTile<Coord::Col>(
+  auto limit = [&dist](const SizeType i) {
+    return dist.template nextLocalTileFromGlobalTile<Coord::Col>(
         dist.template globalTileFromLocalTile<Coord::Row>(i) + 1);
-    for (SizeType j = at_start.col(); j < limit; ++j) {
-      const LocalTileIndex ij_local{i, j};
-      const GlobalTileIndex ij = dist.globalTileIndex(ij_local);
+  };
 
-      const bool is_diagonal_tile = (ij.row() == ij.col());
+  auto update = [&](const LocalTileIndex ij_local, const thread_priority priority) {
+    const GlobalTileIndex ij = dist.globalTileIndex(ij_local);
 
-      auto getSubA = [&a, &view, ij_local]() {
-        return splitTile(a.readwrite(ij_local), view(ij_local));
-      };
+    const bool is_diagonal_tile = (ij.row() == ij.col());
 
-      // The first column of the trailing matrix (except for the very first global tile) has to be
-      // updated first, in order to unlock the next iteration as soon as possible.
-      const auto priority = (j == at_start.col()) ? thread_priority::high : thread_priority::normal;
+    auto getSubA = [&a, &view, ij_local]() {
+      return splitTile(a.readwrite(ij_local), view(ij_local));
+    };
 
-      if (is_diagonal_tile) {
-        her2kDiag<B>(priority, v.read(ij_local), x.read(ij_local), getSubA());
-      }
-      else {
-        // A -= X . V*
-        her2kOffDiag<B>(priority, x.read(ij_local), vt.read(ij_local), getSubA());
+    if (is_diagonal_tile) {
+      her2kDiag<B>(priority, v.read(ij_local), x.read(ij_local), getSubA());
+    }
+    else {
+      // A -= X . V*
+      her2kOffDiag<B>(priority, x.read(ij_local), vt.read(ij_local), getSubA());
 
-        // A -= V . X*
-        her2kOffDiag<B>(priority, v.read(ij_local), xt.read(ij_local), getSubA());
-      }
+      // A -= V . X*
+      her2kOffDiag<B>(priority, v.read(ij_local), xt.read(ij_local), getSubA());
     }
-  }
+  };
+
+  // Note:
+  // The local columns of the trailing matrix containing the next panels (lookahead) are updated first
+  // and with high priority, in order to unlock the next iterations as soon as possible, while the rest
+  // of the trailing matrix is updated with normal priority.
+  const SizeType j_lookahead_end =
+      std::max(at_start.col(), dist.template nextLocalTileFromGlobalTile<Coord::Col>(lookahead_end));
+
+  for (SizeType j = at_start.col(); j < j_lookahead_end; ++j)
+    for (SizeType i = at_start.row(); i < dist.localNrTiles().rows(); ++i)
+      if (j < limit(i))
+        update({i, j}, thread_priority::high);
+
+  for (SizeType i = at_start.row(); i < dist.localNrTiles().rows(); ++i)
+    for (SizeType j = j_lookahead_end; j < limit(i); ++j)
+      update({i, j}, thread_priority::normal);
 }
 }
 
@@ -847,8 +1146,12 @@ struct ComputePanelHelper<Backend::MC, Device::CPU, T> {
     using red2band::distributed::computePanelReflectors;
     return computePanelReflectors(std::forward<TriggerSender>(trigger), rank_v0,
                                   std::forward<CommSender>(mpi_col_chain_panel), mat_a, panel_view,
-                                  nrefls);
+                                  nrefls, ws_cholqr);
   }
+
+protected:
+  std::shared_ptr<red2band::PanelCholQRWorkspace<T>> ws_cholqr =
+      std::make_shared<red2band::PanelCholQRWorkspace<T>>();
 };
 
 #ifdef DLAF_WITH_GPU
@@ -887,9 +1190,9 @@ struct ComputePanelHelper<Backend::GPU, Device::GPU, T> {
 
     // compute on CPU
     using dlaf::eigensolver::internal::red2band::distributed::computePanelReflectors;
-    auto taus =
-        computePanelReflectors(std::forward<TriggerSender>(trigger), rank_v0,
-                               std::forward<CommSender>(mpi_col_chain_panel), v, panel_view, nrefls);
+    auto taus = computePanelReflectors(std::forward<TriggerSender>(trigger), rank_v0,
+                                       std::forward<CommSender>(mpi_col_chain_panel), v, panel_view,
+                                       nrefls, ws_cholqr);
 
     // copy back to GPU
     copyFromCPU(panel_view, v, mat_a);
@@ -899,6 +1202,8 @@ struct ComputePanelHelper<Backend::GPU, Device::GPU, T> {
 
 protected:
   common::RoundRobin<matrix::Panel<Coord::Col, T, Device::CPU>> panels_v;
+  std::shared_ptr<red2band::PanelCholQRWorkspace<T>> ws_cholqr =
+      std::make_shared<red2band::PanelCholQRWorkspace<T>>();
 
   void copyToCPU(const matrix::SubPanelView panel_view, matrix::Matrix<T, Device::GPU>& mat_a,
                  matrix::Panel<Coord::Col, T, Device::CPU>& v) {
@@ -969,6 +1274,8 @@ common::internal::vector<pika::shared_future<common::internal::vector<T>>> Reduc
 
   const bool is_full_band = (band_size == dist_a.blockSize().cols());
 
+  const SizeType lookahead_depth = getTuneParameters().red2band_lookahead_depth;
+
   constexpr std::size_t n_workspaces = 2;
   common::RoundRobin<Panel<Coord::Col, T, D>> panels_v(n_workspaces, dist);
   common::RoundRobin<Panel<Coord::Col, T, D>> panels_w(n_workspaces, dist);
@@ -1071,7 +1378,9 @@ common::internal::vector<pika::shared_future<common::internal::vector<T>>> Reduc
     // TRAILING MATRIX UPDATE
 
     // At -= X . V* + V . X*
-    her2kUpdateTrailingMatrix<B>(trailing_matrix_view, mat_a, x, v);
+    const SizeType lookahead_end =
+        red2band::lookaheadTileColsEnd(dist_a, at_offset, band_size, lookahead_depth);
+    her2kUpdateTrailingMatrix<B>(trailing_matrix_view, mat_a, x, v, lookahead_end);
 
     x.reset();
     w.reset();
@@ -1086,6 +1395,24 @@ common::internal::vector<pika::shared_future<common::internal::vector<T>>> Reduc
 template <Backend B, Device D, class T>
 common::internal::vector<pika::shared_future<common::internal::vector<T>>> ReductionToBand<B, D, T>::call(
     comm::CommunicatorGrid grid, Matrix<T, D>& mat_a, const SizeType band_size) {
+  common::Pipeline<comm::Communicator> mpi_col_chain_panel(grid.colCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_row_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_col_chain(grid.colCommunicator().clone());
+
+  return call(mpi_col_chain_panel, mpi_row_chain, mpi_col_chain, mat_a, band_size);
+}
+
+/// Distributed implementation of reduction to band using the given communicator pipelines
+///
+/// @p mpi_col_chain_panel is used only for the communications of the panel computation, so it must
+/// be a different pipeline than @p mpi_col_chain (both on the column communicator of the grid).
+/// @return a vector of shared futures of vectors, where each inner vector contains a block of taus
+template <Backend B, Device D, class T>
+common::internal::vector<pika::shared_future<common::internal::vector<T>>> ReductionToBand<B, D, T>::call(
+    common::Pipeline<comm::Communicator>& mpi_col_chain_panel,
+    common::Pipeline<comm::Communicator>& mpi_row_chain,
+    common::Pipeline<comm::Communicator>& mpi_col_chain, Matrix<T, D>& mat_a,
+    const SizeType band_size) {
   using namespace red2band::distributed;
 
   using common::iterate_range2d;
@@ -1098,10 +1425,6 @@ common::internal::vector<pika::shared_future<common::internal::vector<T>>> Reduc
   // See issue https://github.com/eth-cscs/DLA-Future/issues/729
   pika::threads::get_thread_manager().wait();
 
-  common::Pipeline<comm::Communicator> mpi_col_chain_panel(grid.colCommunicator().clone());
-  common::Pipeline<comm::Communicator> mpi_row_chain(grid.rowCommunicator().clone());
-  common::Pipeline<comm::Communicator> mpi_col_chain(grid.colCommunicator().clone());
-
   const auto& dist = mat_a.distribution();
   const comm::Index2D rank = dist.rankIndex();
 
@@ -1119,6 +1442,8 @@ common::internal::vector<pika::shared_future<common::internal::vector<T>>> Reduc
 
   const bool is_full_band = (band_size == dist.blockSize().cols());
 
+  const SizeType lookahead_depth = getTuneParameters().red2band_lookahead_depth;
+
   constexpr std::size_t n_workspaces = 2;
   common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panels_v(n_workspaces, dist);
   common::RoundRobin<matrix::Panel<Coord::Row, T, D, matrix::StoreTransposed::Yes>> panels_vt(
@@ -1380,7 +1705,9 @@ common::internal::vector<pika::shared_future<common::internal::vector<T>>> Reduc
     }
 
     // At -= X . V* + V . X*
-    her2kUpdateTrailingMatrix<B>(trailing_matrix_view, mat_a, x, vt, v, xt);
+    const SizeType lookahead_end =
+        red2band::lookaheadTileColsEnd(dist, at_offset, band_size, lookahead_depth);
+    her2kUpdateTrailingMatrix<B>(trailing_matrix_view, mat_a, x, vt, v, xt, lookahead_end);
 
     xt.reset();
     x.reset();
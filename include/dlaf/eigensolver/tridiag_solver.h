@@ -11,9 +11,15 @@
 
 /// @file
 
+#include <cstddef>
+#include <type_traits>
+
 #include <dlaf/common/assert.h>
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/eigensolver/internal/get_tridiag_memory_mode.h>
 #include <dlaf/eigensolver/tridiag_solver/api.h>
+#include <dlaf/eigensolver/tridiag_solver/memory_mode.h>
+#include <dlaf/eigensolver/tridiag_solver/workspace.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/types.h>
 #include <dlaf/util_matrix.h>
@@ -61,6 +67,53 @@ void tridiagSolver(Matrix<BaseType<T>, Device::CPU>& tridiag, Matrix<BaseType<T>
   internal::TridiagSolver<backend, device, BaseType<T>>::call(tridiag, evals, evecs);
 }
 
+/// Returns the peak memory (in bytes) allocated on this rank by tridiagSolver for the eigenvalues,
+/// for the eigenvectors (with element type T) distributed as @p dist_evecs and for its workspaces.
+///
+/// @param distributed true for the distributed tridiagSolver, which always uses
+///        TridiagMemoryMode::Standard,
+/// @param mode the memory mode of the local tridiagSolver (the one selected with the tune parameters
+///        by default).
+template <Device device, class T>
+std::size_t tridiagSolverPeakMemoryBytes(
+    const matrix::Distribution& dist_evecs, const bool distributed,
+    const TridiagMemoryMode mode = internal::getTridiagMemoryMode()) noexcept {
+  return internal::TridiagSolverWorkSpaces<BaseType<T>, device>::peakMemoryBytes(dist_evecs, distributed,
+                                                                               isComplex_v<T>, mode);
+}
+
+/// Finds the eigenvalues of the local symmetric tridiagonal matrix @p tridiag.
+///
+/// No eigenvector is computed, hence it requires just O(n) additional memory.
+///
+/// @param tridiag [in] (n x 2) local matrix with the diagonal and off-diagonal of the symmetric
+///                tridiagonal matrix in the first column and second columns respectively. The last entry
+///                of the second column is not used.
+/// @param evals [out] (n x 1) local matrix holding the eigenvalues of the the symmetric tridiagonal
+///              matrix in ascending order
+///
+/// @pre tridiag and @p evals are local matrices
+/// @pre tridiag has 2 columns and column block size of 2
+/// @pre evals has the same number of rows and the same row block size of @p tridiag
+template <Backend backend, Device device, class T>
+void tridiagSolver(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals) {
+  static_assert(std::is_same_v<T, BaseType<T>>, "tridiagonal matrix and eigenvalues must be real");
+
+  DLAF_ASSERT(matrix::local_matrix(tridiag), tridiag);
+  DLAF_ASSERT(tridiag.distribution().size().cols() == 2, tridiag);
+  DLAF_ASSERT(tridiag.distribution().blockSize().cols() == 2, tridiag);
+
+  DLAF_ASSERT(matrix::local_matrix(evals), evals);
+  DLAF_ASSERT(evals.distribution().size().cols() == 1, evals);
+
+  DLAF_ASSERT(tridiag.distribution().blockSize().rows() == evals.distribution().blockSize().rows(),
+              tridiag.distribution().blockSize().rows(), evals.distribution().blockSize().rows());
+  DLAF_ASSERT(tridiag.distribution().size().rows() == evals.distribution().size().rows(),
+              tridiag.distribution().size().rows(), evals.distribution().size().rows());
+
+  internal::TridiagSolver<backend, device, T>::call(tridiag, evals);
+}
+
 /// Finds the eigenvalues and eigenvectors of the symmetric tridiagonal matrix @p tridiag stored locally
 /// on each rank. The resulting eigenvalues @p evals are stored locally on each rank while the resulting
 /// eigenvectors @p evecs are distributed across ranks in 2D block-cyclic manner.
@@ -103,5 +156,106 @@ void tridiagSolver(comm::CommunicatorGrid grid, Matrix<BaseType<T>, Device::CPU>
   internal::TridiagSolver<B, D, BaseType<T>>::call(grid, tridiag, evals, evecs);
 }
 
+/// Finds all the eigenvalues of the local symmetric tridiagonal matrix @p tridiag and the eigenvectors
+/// corresponding to the eigenvalues with index in [@p eval_idx_begin, @p eval_idx_end).
+///
+/// The eigenvectors are computed with the MRRR algorithm, which requires O(n k) operations and no n x n
+/// workspace, where k = @p eval_idx_end - @p eval_idx_begin.
+///
+/// @param tridiag [in] (n x 2) local matrix with the diagonal and off-diagonal of the symmetric
+///                tridiagonal matrix in the first column and second columns respectively. The last entry
+///                of the second column is not used.
+/// @param evals [out] (n x 1) local matrix holding all the eigenvalues of the the symmetric tridiagonal
+///              matrix in ascending order
+/// @param evecs [out] (n x k) local matrix holding the eigenvectors corresponding to the eigenvalues
+///              with index in [@p eval_idx_begin, @p eval_idx_end)
+///
+/// @pre tridiag and @p evals and @p evecs are local matrices
+/// @pre tridiag has 2 columns and column block size of 2
+/// @pre 0 <= eval_idx_begin <= eval_idx_end <= n
+/// @pre evecs has n rows, eval_idx_end - eval_idx_begin columns and a square block size with the same
+///      row block size of @p tridiag and @p evals
+template <Backend backend, Device device, class T>
+void tridiagSolver(Matrix<BaseType<T>, Device::CPU>& tridiag, Matrix<BaseType<T>, device>& evals,
+                   Matrix<T, device>& evecs, const SizeType eval_idx_begin,
+                   const SizeType eval_idx_end) {
+  DLAF_ASSERT(matrix::local_matrix(tridiag), tridiag);
+  DLAF_ASSERT(tridiag.distribution().size().cols() == 2, tridiag);
+  DLAF_ASSERT(tridiag.distribution().blockSize().cols() == 2, tridiag);
+
+  DLAF_ASSERT(matrix::local_matrix(evals), evals);
+  DLAF_ASSERT(evals.distribution().size().cols() == 1, evals);
+
+  DLAF_ASSERT(matrix::local_matrix(evecs), evecs);
+  DLAF_ASSERT(matrix::square_blocksize(evecs), evecs);
+
+  DLAF_ASSERT(0 <= eval_idx_begin && eval_idx_begin <= eval_idx_end &&
+                  eval_idx_end <= tridiag.size().rows(),
+              eval_idx_begin, eval_idx_end, tridiag);
+  DLAF_ASSERT(evecs.size() == GlobalElementSize(tridiag.size().rows(), eval_idx_end - eval_idx_begin),
+              evecs, tridiag, eval_idx_begin, eval_idx_end);
+
+  DLAF_ASSERT(tridiag.distribution().blockSize().rows() == evecs.distribution().blockSize().rows(),
+              evecs, tridiag);
+  DLAF_ASSERT(tridiag.distribution().blockSize().rows() == evals.distribution().blockSize().rows(),
+              tridiag, evals);
+  DLAF_ASSERT(tridiag.distribution().size().rows() == evals.distribution().size().rows(), tridiag,
+              evals);
+
+  internal::TridiagSolver<backend, device, BaseType<T>>::call(tridiag, evals, evecs, eval_idx_begin,
+                                                              eval_idx_end);
+}
+
+/// Finds all the eigenvalues of the symmetric tridiagonal matrix @p tridiag stored locally on each rank
+/// and the eigenvectors corresponding to the eigenvalues with index in [@p eval_idx_begin,
+/// @p eval_idx_end), which are distributed across ranks in 2D block-cyclic manner.
+///
+/// The eigenvectors are computed with the MRRR algorithm, which requires O(n k) operations and no n x n
+/// workspace, where k = @p eval_idx_end - @p eval_idx_begin. No communication is involved.
+///
+/// @param tridiag [in] (n x 2) local matrix with the diagonal and off-diagonal of the symmetric
+///                tridiagonal matrix in the first column and second columns respectively. The last entry
+///                of the second column is not used.
+/// @param evals [out] (n x 1) local matrix holding all the eigenvalues of the the symmetric tridiagonal
+///              matrix in ascending order
+/// @param evecs [out] (n x k) distributed matrix holding the eigenvectors corresponding to the
+///              eigenvalues with index in [@p eval_idx_begin, @p eval_idx_end)
+///
+/// @pre tridiag and @p evals are local matrices and are the same on all ranks
+/// @pre tridiag has 2 columns and column block size of 2
+/// @pre 0 <= eval_idx_begin <= eval_idx_end <= n
+/// @pre evecs has n rows, eval_idx_end - eval_idx_begin columns and a square block size with the same
+///      row block size of @p tridiag and @p evals
+template <Backend B, Device D, class T>
+void tridiagSolver(comm::CommunicatorGrid grid, Matrix<BaseType<T>, Device::CPU>& tridiag,
+                   Matrix<BaseType<T>, D>& evals, Matrix<T, D>& evecs, const SizeType eval_idx_begin,
+                   const SizeType eval_idx_end) {
+  DLAF_ASSERT(matrix::local_matrix(tridiag), tridiag);
+  DLAF_ASSERT(tridiag.distribution().size().cols() == 2, tridiag);
+  DLAF_ASSERT(tridiag.distribution().blockSize().cols() == 2, tridiag);
+
+  DLAF_ASSERT(matrix::local_matrix(evals), evals);
+  DLAF_ASSERT(evals.distribution().size().cols() == 1, evals);
+
+  DLAF_ASSERT(matrix::square_blocksize(evecs), evecs);
+  DLAF_ASSERT(matrix::equal_process_grid(evecs, grid), evecs, grid);
+
+  DLAF_ASSERT(0 <= eval_idx_begin && eval_idx_begin <= eval_idx_end &&
+                  eval_idx_end <= tridiag.size().rows(),
+              eval_idx_begin, eval_idx_end, tridiag);
+  DLAF_ASSERT(evecs.size() == GlobalElementSize(tridiag.size().rows(), eval_idx_end - eval_idx_begin),
+              evecs, tridiag, eval_idx_begin, eval_idx_end);
+
+  DLAF_ASSERT(tridiag.distribution().blockSize().rows() == evecs.distribution().blockSize().rows(),
+              evecs, tridiag);
+  DLAF_ASSERT(tridiag.distribution().blockSize().rows() == evals.distribution().blockSize().rows(),
+              tridiag, evals);
+  DLAF_ASSERT(tridiag.distribution().size().rows() == evals.distribution().size().rows(), tridiag,
+              evals);
+
+  internal::TridiagSolver<B, D, BaseType<T>>::call(grid, tridiag, evals, evecs, eval_idx_begin,
+                                                   eval_idx_end);
+}
+
 }
 }
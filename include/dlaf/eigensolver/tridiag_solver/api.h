@@ -9,6 +9,10 @@
 //
 #pragma once
 
+#include <dlaf/common/pipeline.h>
+#include <dlaf/communication/communicator.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/eigensolver/tridiag_solver/workspace.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/types.h>
 
@@ -19,10 +23,38 @@ struct TridiagSolver {
   static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals, Matrix<T, device>& evecs);
   static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals,
                    Matrix<std::complex<T>, device>& evecs);
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals, Matrix<T, device>& evecs,
+                   TridiagSolverWorkSpaces<T, device>& workspaces);
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals,
+                   Matrix<std::complex<T>, device>& evecs,
+                   TridiagSolverWorkSpaces<T, device>& workspaces);
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals);
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals, Matrix<T, device>& evecs,
+                   SizeType eval_idx_begin, SizeType eval_idx_end);
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals,
+                   Matrix<std::complex<T>, device>& evecs, SizeType eval_idx_begin,
+                   SizeType eval_idx_end);
   static void call(comm::CommunicatorGrid grid, Matrix<T, Device::CPU>& tridiag,
                    Matrix<T, device>& evals, Matrix<T, device>& evecs);
   static void call(comm::CommunicatorGrid grid, Matrix<T, Device::CPU>& tridiag,
                    Matrix<T, device>& evals, Matrix<std::complex<T>, device>& evecs);
+  static void call(comm::CommunicatorGrid grid, Matrix<T, Device::CPU>& tridiag,
+                   Matrix<T, device>& evals, Matrix<T, device>& evecs, SizeType eval_idx_begin,
+                   SizeType eval_idx_end);
+  static void call(comm::CommunicatorGrid grid, Matrix<T, Device::CPU>& tridiag,
+                   Matrix<T, device>& evals, Matrix<std::complex<T>, device>& evecs,
+                   SizeType eval_idx_begin, SizeType eval_idx_end);
+  static void call(comm::CommunicatorGrid grid, common::Pipeline<comm::Communicator>& full_task_chain,
+                   common::Pipeline<comm::Communicator>& row_task_chain,
+                   common::Pipeline<comm::Communicator>& col_task_chain,
+                   Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals, Matrix<T, device>& evecs,
+                   TridiagSolverWorkSpaces<T, device>& workspaces);
+  static void call(comm::CommunicatorGrid grid, common::Pipeline<comm::Communicator>& full_task_chain,
+                   common::Pipeline<comm::Communicator>& row_task_chain,
+                   common::Pipeline<comm::Communicator>& col_task_chain,
+                   Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals,
+                   Matrix<std::complex<T>, device>& evecs,
+                   TridiagSolverWorkSpaces<T, device>& workspaces);
 };
 
 // ETI
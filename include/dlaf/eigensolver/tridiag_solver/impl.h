@@ -10,6 +10,7 @@
 #pragma once
 
 #include <algorithm>
+#include <vector>
 
 #include <pika/execution.hpp>
 #include <pika/thread.hpp>
@@ -19,10 +20,14 @@
 #endif
 
 #include <dlaf/common/callable_object.h>
+#include <dlaf/common/pipeline.h>
+#include <dlaf/common/single_threaded_blas.h>
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/eigensolver/tridiag_solver/api.h>
 #include <dlaf/eigensolver/tridiag_solver/kernels.h>
 #include <dlaf/eigensolver/tridiag_solver/merge.h>
+#include <dlaf/eigensolver/tridiag_solver/tile_collector.h>
+#include <dlaf/eigensolver/tridiag_solver/workspace.h>
 #include <dlaf/lapack/tile.h>
 #include <dlaf/matrix/copy_tile.h>
 #include <dlaf/permutations/general.h>
@@ -128,6 +133,137 @@ void offloadDiagonal(Matrix<const T, Device::CPU>& tridiag, Matrix<T, D>& evals)
   }
 }
 
+// Computes with `sterf` the eigenvalues of the symmetric tridiagonal matrix stored in @p tridiag (n x 2)
+// and stores them in ascending order in the column matrix @p evals (n x 1).
+//
+// Note: `sterf` uses the root-free variant of the QL/QR algorithm, i.e. just O(n^2) operations and
+// O(n) memory are needed, since no eigenvector is computed.
+template <class T>
+void solveValuesOnly(Matrix<const T, Device::CPU>& tridiag, Matrix<T, Device::CPU>& evals) {
+  namespace ex = pika::execution::experimental;
+  namespace di = dlaf::internal;
+
+  const SizeType n = evals.size().rows();
+  auto sterf_fn = [n](const auto& tridiag_tiles, const auto& evals_tiles) {
+    const TileElementIndex zero_idx(0, 0);
+    T* d_ptr = evals_tiles[0].ptr(zero_idx);
+    std::vector<T> offdiag(to_sizet(n));
+
+    SizeType i_el = 0;
+    for (const auto& tile_wrapper : tridiag_tiles) {
+      const auto& tile = tile_wrapper.get();
+      for (SizeType i = 0; i < tile.size().rows(); ++i, ++i_el) {
+        d_ptr[i_el] = tile({i, 0});
+        offdiag[to_sizet(i_el)] = tile({i, 1});
+      }
+    }
+
+    common::internal::SingleThreadedBlasScope single;
+    [[maybe_unused]] auto info = lapack::sterf(n, d_ptr, offdiag.data());
+    DLAF_ASSERT(info == 0, info);
+  };
+
+  TileCollector tc{0, evals.nrTiles().rows()};
+
+  auto sender = ex::when_all(ex::when_all_vector(tc.read<T, Device::CPU>(tridiag)),
+                             ex::when_all_vector(tc.readwrite<T, Device::CPU>(evals)));
+
+  ex::start_detached(di::transform(di::Policy<Backend::MC>(), std::move(sterf_fn), std::move(sender)));
+}
+
+// Computes all the eigenvalues of the tridiagonal matrix and the eigenvectors corresponding to the
+// eigenvalues with index in [eval_idx_begin, eval_idx_end).
+//
+// The eigenvalues are computed with `sterf`, while the selected eigenvectors are computed with the
+// MRRR algorithm (`stemr`), which requires O(n k) operations and memory (k = eval_idx_end -
+// eval_idx_begin), i.e. no n x n workspace is needed.
+//
+// Note: just the local tiles of @p evecs are set. Since @p tridiag is replicated on all ranks, it can be
+// used for distributed eigenvector matrices too, without any communication.
+// For distributed matrices this is a replicated fallback: each rank runs the same solve and keeps all
+// the k eigenvectors in a (n x k) buffer, as computing separately disjoint ranges of them does not
+// guarantee their orthogonality. This is acceptable as it is used just for small subsets (see
+// useTridiagSubsetSolver), while larger ones use the distributed divide and conquer solver.
+template <class T>
+void solveSubset(Matrix<const T, Device::CPU>& tridiag, Matrix<T, Device::CPU>& evals,
+                 Matrix<T, Device::CPU>& evecs, const SizeType eval_idx_begin,
+                 const SizeType eval_idx_end) {
+  namespace ex = pika::execution::experimental;
+  namespace di = dlaf::internal;
+
+  const SizeType n = evals.size().rows();
+  const matrix::Distribution& dist_evecs = evecs.distribution();
+
+  auto stemr_fn = [n, eval_idx_begin, eval_idx_end, dist_evecs](const auto& tridiag_tiles,
+                                                                const auto& evals_tiles,
+                                                                const auto& evecs_tiles) {
+    const SizeType k = eval_idx_end - eval_idx_begin;
+    const TileElementIndex zero_idx(0, 0);
+    T* w_ptr = evals_tiles[0].ptr(zero_idx);
+
+    std::vector<T> diag(to_sizet(n));
+    std::vector<T> offdiag(to_sizet(n));
+
+    SizeType i_el = 0;
+    for (const auto& tile_wrapper : tridiag_tiles) {
+      const auto& tile = tile_wrapper.get();
+      for (SizeType i = 0; i < tile.size().rows(); ++i, ++i_el) {
+        diag[to_sizet(i_el)] = tile({i, 0});
+        offdiag[to_sizet(i_el)] = tile({i, 1});
+      }
+    }
+
+    common::internal::SingleThreadedBlasScope single;
+
+    // Note: sterf overwrites the off-diagonal, which is still needed by stemr.
+    {
+      std::copy(diag.begin(), diag.end(), w_ptr);
+      std::vector<T> offdiag_sterf(offdiag);
+      [[maybe_unused]] auto info = lapack::sterf(n, w_ptr, offdiag_sterf.data());
+      DLAF_ASSERT(info == 0, info);
+    }
+
+    if (k == 0)
+      return;
+
+    std::vector<T> w(to_sizet(n));
+    std::vector<T> z(to_sizet(n * k));
+    std::vector<int64_t> isuppz(to_sizet(2 * k));
+    int64_t nfound = 0;
+    bool tryrac = true;
+
+    // Note: LAPACK uses 1-based inclusive index ranges.
+    [[maybe_unused]] auto info =
+        lapack::stemr(lapack::Job::Vec, lapack::Range::Index, n, diag.data(), offdiag.data(), T(0), T(0),
+                      eval_idx_begin + 1, eval_idx_end, &nfound, w.data(), z.data(), n, k,
+                      isuppz.data(), &tryrac);
+    DLAF_ASSERT(info == 0, info);
+    DLAF_ASSERT(nfound == k, nfound, k);
+
+    // The selected eigenvalues are the ones computed by stemr, to be consistent with the eigenvectors.
+    std::copy_n(w.begin(), k, w_ptr + eval_idx_begin);
+
+    std::size_t index = 0;
+    for (const auto& ij_lc : iterate_range2d(dist_evecs.localNrTiles())) {
+      const GlobalTileIndex ij = dist_evecs.globalTileIndex(ij_lc);
+      const GlobalElementIndex ij_el = dist_evecs.globalElementIndex(ij, zero_idx);
+      const auto& tile = evecs_tiles[index++];
+
+      lapack::lacpy(blas::Uplo::General, tile.size().rows(), tile.size().cols(),
+                    z.data() + ij_el.row() + ij_el.col() * n, n, tile.ptr(), tile.ld());
+    }
+  };
+
+  TileCollector tc{0, evals.nrTiles().rows()};
+
+  auto sender = ex::when_all(ex::when_all_vector(tc.read<T, Device::CPU>(tridiag)),
+                             ex::when_all_vector(tc.readwrite<T, Device::CPU>(evals)),
+                             ex::when_all_vector(matrix::select(
+                                 evecs, common::iterate_range2d(dist_evecs.localNrTiles()))));
+
+  ex::start_detached(di::transform(di::Policy<Backend::MC>(), std::move(stemr_fn), std::move(sender)));
+}
+
 // Notation:
 //
 // nb - the block/tile size of all matrices and vectors
@@ -192,40 +328,40 @@ void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>&
   if (evecs.size().isEmpty())
     return;
 
+  TridiagSolverWorkSpaces<T, D> workspaces(evecs.distribution(), false, false);
+  TridiagSolver<B, D, T>::call(tridiag, evals, evecs, workspaces);
+}
+
+// Overload which uses pre-allocated workspaces.
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<T, D>& evecs, TridiagSolverWorkSpaces<T, D>& workspaces) {
+  DLAF_ASSERT(workspaces.isCompatible(evecs.distribution()), evecs);
+
+  // Quick return for empty matrix
+  if (evecs.size().isEmpty())
+    return;
+
+  // Auxiliary matrix used for the D&C algorithm
+  WorkSpace<T, D> ws = makeWorkSpace(workspaces, evals, evecs);
+  WorkSpaceHost<T> ws_h = makeWorkSpaceHost(workspaces);
+
+  // Mirror workspace on host memory for CPU-only kernels
+  WorkSpaceHostMirror<T, D> ws_hm = makeWorkSpaceHostMirror(workspaces, ws);
+
   // If the matrix is composed by a single tile simply call stedc.
   if (evecs.nrTiles().linear_size() == 1) {
     if constexpr (D == Device::CPU) {
       solveLeaf(tridiag, evecs);
     }
     else {
-      Matrix<T, Device::CPU> h_evecs{evecs.distribution()};
-      solveLeaf(tridiag, evecs, h_evecs);
+      solveLeaf(tridiag, evecs, ws_hm.e2);
     }
     offloadDiagonal(tridiag, evals);
     return;
   }
 
-  // Auxiliary matrix used for the D&C algorithm
   const matrix::Distribution& distr = evecs.distribution();
-  const LocalElementSize vec_size(distr.size().rows(), 1);
-  const TileElementSize vec_tile_size(distr.blockSize().rows(), 1);
-  WorkSpace<T, D> ws{Matrix<T, D>(distr),                            // e0
-                     Matrix<T, D>(distr),                            // e1
-                     evecs,                                          // e2
-                     evals,                                          // d1
-                     Matrix<T, D>(vec_size, vec_tile_size),          // z0
-                     Matrix<T, D>(vec_size, vec_tile_size),          // z1
-                     Matrix<SizeType, D>(vec_size, vec_tile_size)};  // i2
-
-  WorkSpaceHost<T> ws_h{Matrix<T, Device::CPU>(vec_size, vec_tile_size),          // d0
-                        Matrix<ColType, Device::CPU>(vec_size, vec_tile_size),    // c
-                        Matrix<SizeType, Device::CPU>(vec_size, vec_tile_size),   // i1
-                        Matrix<SizeType, Device::CPU>(vec_size, vec_tile_size)};  // i3
-
-  // Mirror workspace on host memory for CPU-only kernels
-  WorkSpaceHostMirror<T, D> ws_hm{initMirrorMatrix(ws.e2), initMirrorMatrix(ws.d1),
-                                  initMirrorMatrix(ws.z0), initMirrorMatrix(ws.z1),
-                                  initMirrorMatrix(ws.i2)};
 
   // Set `ws.e0` to `zero` (needed for Given's rotation to make sure no random values are picked up)
   matrix::util::set0<B, T, D>(pika::execution::thread_priority::normal, ws.e0);
@@ -260,12 +396,76 @@ void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>&
   dlaf::permutations::permute<B, D, T, Coord::Col>(0, n, ws.i2, ws.e0, evecs);
 }
 
+// Overload which computes just the eigenvalues, without any eigenvector and without the D&C workspaces.
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals) {
+  // Quick return for empty matrix
+  if (evals.size().isEmpty())
+    return;
+
+  auto&& evals_h = initMirrorMatrix(evals);
+  solveValuesOnly(tridiag, evals_h);
+
+  if constexpr (D != Device::CPU)
+    copy(evals_h, evals);
+}
+
+// Overload which computes all the eigenvalues and just the eigenvectors corresponding to the eigenvalues
+// with index in [eval_idx_begin, eval_idx_end), using MRRR instead of D&C.
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<T, D>& evecs, const SizeType eval_idx_begin,
+                                  const SizeType eval_idx_end) {
+  // Quick return for empty matrix
+  if (evals.size().isEmpty())
+    return;
+
+  auto&& evals_h = initMirrorMatrix(evals);
+  auto&& evecs_h = initMirrorMatrix(evecs);
+  solveSubset(tridiag, evals_h, evecs_h, eval_idx_begin, eval_idx_end);
+
+  if constexpr (D != Device::CPU) {
+    copy(evals_h, evals);
+    copy(evecs_h, evecs);
+  }
+}
+
+// Overload which computes a subset of the eigenvectors and provides them as complex values.
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<std::complex<T>, D>& evecs, const SizeType eval_idx_begin,
+                                  const SizeType eval_idx_end) {
+  Matrix<T, D> real_evecs(evecs.distribution());
+  TridiagSolver<B, D, T>::call(tridiag, evals, real_evecs, eval_idx_begin, eval_idx_end);
+
+  // Convert real to complex numbers
+  const matrix::Distribution& dist = evecs.distribution();
+  for (auto tile_wrt_local : iterate_range2d(dist.localNrTiles())) {
+    castToComplexAsync<D>(real_evecs.read(tile_wrt_local), evecs.readwrite(tile_wrt_local));
+  }
+}
+
 // Overload which provides the eigenvector matrix as complex values where the imaginery part is set to zero.
 template <Backend B, Device D, class T>
 void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
                                   Matrix<std::complex<T>, D>& evecs) {
-  Matrix<T, D> real_evecs(evecs.distribution());
-  TridiagSolver<B, D, T>::call(tridiag, evals, real_evecs);
+  // Quick return for empty matrix
+  if (evecs.size().isEmpty())
+    return;
+
+  TridiagSolverWorkSpaces<T, D> workspaces(evecs.distribution(), false, true);
+  TridiagSolver<B, D, T>::call(tridiag, evals, evecs, workspaces);
+}
+
+// Overload which provides the eigenvector matrix as complex values and uses pre-allocated workspaces.
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<std::complex<T>, D>& evecs,
+                                  TridiagSolverWorkSpaces<T, D>& workspaces) {
+  Matrix<T, D>& real_evecs = workspaces.real_evecs;
+  DLAF_ASSERT(real_evecs.distribution() == evecs.distribution(), real_evecs, evecs);
+
+  TridiagSolver<B, D, T>::call(tridiag, evals, real_evecs, workspaces);
 
   // Convert real to complex numbers
   const matrix::Distribution& dist = evecs.distribution();
@@ -341,46 +541,56 @@ void solveDistLeaf(comm::CommunicatorGrid grid, common::Pipeline<comm::Communica
 template <Backend B, Device D, class T>
 void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid grid, Matrix<T, Device::CPU>& tridiag,
                                   Matrix<T, D>& evals, Matrix<T, D>& evecs) {
+  // Quick return for empty matrix
+  if (evecs.size().isEmpty())
+    return;
+
   common::Pipeline<comm::Communicator> full_task_chain(grid.fullCommunicator().clone());
+  common::Pipeline<comm::Communicator> row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> col_task_chain(grid.colCommunicator().clone());
+
+  TridiagSolverWorkSpaces<T, D> workspaces(evecs.distribution(), true, false);
+  TridiagSolver<B, D, T>::call(grid, full_task_chain, row_task_chain, col_task_chain, tridiag, evals,
+                               evecs, workspaces);
+}
+
+// \overload TridiagSolver<B, D, T>::call()
+//
+// This overload uses pre-allocated workspaces and communicator pipelines.
+//
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid grid,
+                                  common::Pipeline<comm::Communicator>& full_task_chain,
+                                  common::Pipeline<comm::Communicator>& row_task_chain,
+                                  common::Pipeline<comm::Communicator>& col_task_chain,
+                                  Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<T, D>& evecs, TridiagSolverWorkSpaces<T, D>& workspaces) {
+  DLAF_ASSERT(workspaces.isCompatible(evecs.distribution()), evecs);
 
   // Quick return for empty matrix
   if (evecs.size().isEmpty())
     return;
 
+  // Auxiliary matrix used for the D&C algorithm
+  WorkSpace<T, D> ws = makeWorkSpace(workspaces, evals, evecs);
+  WorkSpaceHost<T> ws_h = makeWorkSpaceHost(workspaces);
+
+  // Mirror workspace on host memory for CPU-only kernels
+  DistWorkSpaceHostMirror<T, D> ws_hm = makeDistWorkSpaceHostMirror(workspaces, ws);
+
   // If the matrix is composed by a single tile simply call stedc.
   if (evecs.nrTiles().linear_size() == 1) {
     if constexpr (D == Device::CPU) {
       solveDistLeaf(grid, full_task_chain, tridiag, evecs);
     }
     else {
-      Matrix<T, Device::CPU> h_evecs{evecs.distribution()};
-      solveDistLeaf(grid, full_task_chain, tridiag, evecs, h_evecs);
+      solveDistLeaf(grid, full_task_chain, tridiag, evecs, ws_hm.e2);
     }
     offloadDiagonal(tridiag, evals);
     return;
   }
 
-  // Auxiliary matrix used for the D&C algorithm
   const matrix::Distribution& dist_evecs = evecs.distribution();
-  const matrix::Distribution& dist_evals = evals.distribution();
-
-  WorkSpace<T, D> ws{Matrix<T, D>(dist_evecs),          // e0
-                     Matrix<T, D>(dist_evecs),          // e1
-                     evecs,                             // e2
-                     evals,                             // d1
-                     Matrix<T, D>(dist_evals),          // z0
-                     Matrix<T, D>(dist_evals),          // z1
-                     Matrix<SizeType, D>(dist_evals)};  // i2
-
-  WorkSpaceHost<T> ws_h{Matrix<T, Device::CPU>(dist_evals),          // d0
-                        Matrix<ColType, Device::CPU>(dist_evals),    // c
-                        Matrix<SizeType, Device::CPU>(dist_evals),   // i1
-                        Matrix<SizeType, Device::CPU>(dist_evals)};  // i3
-
-  // Mirror workspace on host memory for CPU-only kernels
-  DistWorkSpaceHostMirror<T, D> ws_hm{initMirrorMatrix(ws.e0), initMirrorMatrix(ws.e2),
-                                      initMirrorMatrix(ws.d1), initMirrorMatrix(ws.z0),
-                                      initMirrorMatrix(ws.z1), initMirrorMatrix(ws.i2)};
 
   // Set `ws.e0` to `zero` (needed for Given's rotation to make sure no random values are picked up)
   matrix::util::set0<B, T, D>(pika::execution::thread_priority::normal, ws.e0);
@@ -388,9 +598,6 @@ void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid grid, Matrix<T, Device:
   // Cuppen's decomposition
   auto offdiag_vals = cuppensDecomposition(tridiag);
 
-  common::Pipeline<comm::Communicator> row_task_chain(grid.rowCommunicator().clone());
-  common::Pipeline<comm::Communicator> col_task_chain(grid.colCommunicator().clone());
-
   // Solve with stedc for each tile of `tridiag` (nb x 2) and save eigenvectors in diagonal tiles of
   // `evecs` (nb x nb)
   if constexpr (D == Device::CPU) {
@@ -431,8 +638,37 @@ void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid grid, Matrix<T, Device:
 template <Backend B, Device D, class T>
 void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid grid, Matrix<T, Device::CPU>& tridiag,
                                   Matrix<T, D>& evals, Matrix<std::complex<T>, D>& evecs) {
-  Matrix<T, D> real_evecs(evecs.distribution());
-  TridiagSolver<B, D, T>::call(grid, tridiag, evals, real_evecs);
+  // Quick return for empty matrix
+  if (evecs.size().isEmpty())
+    return;
+
+  common::Pipeline<comm::Communicator> full_task_chain(grid.fullCommunicator().clone());
+  common::Pipeline<comm::Communicator> row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> col_task_chain(grid.colCommunicator().clone());
+
+  TridiagSolverWorkSpaces<T, D> workspaces(evecs.distribution(), true, true);
+  TridiagSolver<B, D, T>::call(grid, full_task_chain, row_task_chain, col_task_chain, tridiag, evals,
+                               evecs, workspaces);
+}
+
+// \overload TridiagSolver<B, D, T>::call()
+//
+// This overload provides the eigenvector matrix as complex values and uses pre-allocated workspaces
+// and communicator pipelines.
+//
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid grid,
+                                  common::Pipeline<comm::Communicator>& full_task_chain,
+                                  common::Pipeline<comm::Communicator>& row_task_chain,
+                                  common::Pipeline<comm::Communicator>& col_task_chain,
+                                  Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<std::complex<T>, D>& evecs,
+                                  TridiagSolverWorkSpaces<T, D>& workspaces) {
+  Matrix<T, D>& real_evecs = workspaces.real_evecs;
+  DLAF_ASSERT(real_evecs.distribution() == evecs.distribution(), real_evecs, evecs);
+
+  TridiagSolver<B, D, T>::call(grid, full_task_chain, row_task_chain, col_task_chain, tridiag, evals,
+                               real_evecs, workspaces);
 
   // Convert real to complex numbers
   const matrix::Distribution& dist = evecs.distribution();
@@ -441,4 +677,26 @@ void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid grid, Matrix<T, Device:
   }
 }
 
+// Overload which computes all the eigenvalues and just the eigenvectors corresponding to the eigenvalues
+// with index in [eval_idx_begin, eval_idx_end), using MRRR instead of D&C.
+//
+// Note: no communication is needed, since each rank computes its local tiles of @p evecs from the
+// replicated @p tridiag.
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid grid, Matrix<T, Device::CPU>& tridiag,
+                                  Matrix<T, D>& evals, Matrix<T, D>& evecs,
+                                  const SizeType eval_idx_begin, const SizeType eval_idx_end) {
+  DLAF_ASSERT(matrix::equal_process_grid(evecs, grid), evecs, grid);
+  TridiagSolver<B, D, T>::call(tridiag, evals, evecs, eval_idx_begin, eval_idx_end);
+}
+
+// Overload which computes a subset of the eigenvectors and provides them as complex values.
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid grid, Matrix<T, Device::CPU>& tridiag,
+                                  Matrix<T, D>& evals, Matrix<std::complex<T>, D>& evecs,
+                                  const SizeType eval_idx_begin, const SizeType eval_idx_end) {
+  DLAF_ASSERT(matrix::equal_process_grid(evecs, grid), evecs, grid);
+  TridiagSolver<B, D, T>::call(tridiag, evals, evecs, eval_idx_begin, eval_idx_end);
+}
+
 }
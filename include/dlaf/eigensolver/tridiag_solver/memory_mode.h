@@ -0,0 +1,35 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <iostream>
+
+namespace dlaf::eigensolver {
+
+/// Memory usage of the divide and conquer tridiagonal eigensolver.
+enum class TridiagMemoryMode {
+  /// Two n x n workspaces besides the eigenvectors: the eigenvectors of the subproblems are copied
+  /// before being multiplied with the eigenvectors of the rank-1 problem.
+  Standard,
+  /// One n x n workspace besides the eigenvectors: the eigenvectors of the subproblems are updated in
+  /// place one tile row at a time, which reduces the parallelism of the multiplication.
+  /// Supported by the local solver only.
+  Lean,
+};
+
+inline std::ostream& operator<<(std::ostream& str, const TridiagMemoryMode& mode) {
+  if (mode == TridiagMemoryMode::Lean)
+    str << "Lean";
+  else
+    str << "Standard";
+  return str;
+}
+
+}
@@ -10,12 +10,15 @@
 #pragma once
 
 #include <algorithm>
+#include <vector>
 
 #include <pika/barrier.hpp>
 #include <pika/execution.hpp>
 
+#include <dlaf/blas/tile.h>
 #include <dlaf/common/range2d.h>
 #include <dlaf/common/single_threaded_blas.h>
+#include <dlaf/common/timer.h>
 #include <dlaf/communication/kernels.h>
 #include <dlaf/eigensolver/internal/get_tridiag_rank1_barrier_busy_wait.h>
 #include <dlaf/eigensolver/internal/get_tridiag_rank1_nworkers.h>
@@ -23,7 +26,9 @@
 #include <dlaf/eigensolver/tridiag_solver/index_manipulation.h>
 #include <dlaf/eigensolver/tridiag_solver/kernels.h>
 #include <dlaf/eigensolver/tridiag_solver/rot.h>
+#include <dlaf/eigensolver/tridiag_solver/secular.h>
 #include <dlaf/eigensolver/tridiag_solver/tile_collector.h>
+#include <dlaf/eigensolver/tridiag_solver/workspace.h>
 #include <dlaf/lapack/tile.h>
 #include <dlaf/matrix/copy.h>
 #include <dlaf/matrix/copy_tile.h>
@@ -96,45 +101,42 @@ namespace dlaf::eigensolver::internal {
 //        post_sorted <--- matmul
 //
 
+// Note:
+// The following structures are views of the workspaces, i.e. they just reference the matrices, which
+// are either the output matrices of the solver or are stored in TridiagSolverWorkSpaces.
 template <class T, Device D>
 struct WorkSpace {
-  Matrix<T, D> e0;
-  Matrix<T, D> e1;
+  TridiagMemoryMode mode;
+
+  Matrix<T, D>& e0;
+  Matrix<T, D>& e1;  // Empty in TridiagMemoryMode::Lean
   Matrix<T, D>& e2;  // Reference to reuse evecs
 
+  Matrix<T, D>& e0_panel;  // Single tile row, used just in TridiagMemoryMode::Lean
+
   Matrix<T, D>& d1;  // Reference to reuse evals
 
-  Matrix<T, D> z0;
-  Matrix<T, D> z1;
+  Matrix<T, D>& z0;
+  Matrix<T, D>& z1;
 
-  Matrix<SizeType, D> i2;
+  Matrix<SizeType, D>& i2;
 };
 
 template <class T>
 struct WorkSpaceHost {
-  Matrix<T, Device::CPU> d0;
+  Matrix<T, Device::CPU>& d0;
+
+  Matrix<ColType, Device::CPU>& c;
 
-  Matrix<ColType, Device::CPU> c;
+  Matrix<SizeType, Device::CPU>& i1;
+  Matrix<SizeType, Device::CPU>& i3;
 
-  Matrix<SizeType, Device::CPU> i1;
-  Matrix<SizeType, Device::CPU> i3;
+  Matrix<T, Device::CPU>& delta;  // Empty for the local solver
 };
 
-// forward declaration : Device::GPU - unused
+// Note: for Device::CPU the mirrors reference the corresponding matrices of WorkSpace.
 template <class T, Device D>
 struct WorkSpaceHostMirror {
-  Matrix<T, Device::CPU> e2;
-
-  Matrix<T, Device::CPU> d1;
-
-  Matrix<T, Device::CPU> z0;
-  Matrix<T, Device::CPU> z1;
-
-  Matrix<SizeType, Device::CPU> i2;
-};
-
-template <class T>
-struct WorkSpaceHostMirror<T, Device::CPU> {
   Matrix<T, Device::CPU>& e2;
 
   Matrix<T, Device::CPU>& d1;
@@ -145,22 +147,9 @@ struct WorkSpaceHostMirror<T, Device::CPU> {
   Matrix<SizeType, Device::CPU>& i2;
 };
 
-// forward declaration : Device::GPU - unused
+// Note: for Device::CPU the mirrors reference the corresponding matrices of WorkSpace.
 template <class T, Device D>
 struct DistWorkSpaceHostMirror {
-  Matrix<T, Device::CPU> e0;
-  Matrix<T, Device::CPU> e2;
-
-  Matrix<T, Device::CPU> d1;
-
-  Matrix<T, Device::CPU> z0;
-  Matrix<T, Device::CPU> z1;
-
-  Matrix<SizeType, Device::CPU> i2;
-};
-
-template <class T>
-struct DistWorkSpaceHostMirror<T, Device::CPU> {
   Matrix<T, Device::CPU>& e0;
   Matrix<T, Device::CPU>& e2;
 
@@ -172,6 +161,36 @@ struct DistWorkSpaceHostMirror<T, Device::CPU> {
   Matrix<SizeType, Device::CPU>& i2;
 };
 
+template <class T, Device D>
+WorkSpace<T, D> makeWorkSpace(TridiagSolverWorkSpaces<T, D>& storage, Matrix<T, D>& evals,
+                              Matrix<T, D>& evecs) {
+  return {storage.mode, storage.e0, storage.e1, evecs,     storage.e0_panel,
+          evals,        storage.z0, storage.z1, storage.i2};
+}
+
+template <class T, Device D>
+WorkSpaceHost<T> makeWorkSpaceHost(TridiagSolverWorkSpaces<T, D>& storage) {
+  return {storage.d0, storage.c, storage.i1, storage.i3, storage.delta};
+}
+
+template <class T, Device D>
+WorkSpaceHostMirror<T, D> makeWorkSpaceHostMirror(TridiagSolverWorkSpaces<T, D>& storage,
+                                                  WorkSpace<T, D>& ws) {
+  if constexpr (D == Device::CPU)
+    return {ws.e2, ws.d1, ws.z0, ws.z1, ws.i2};
+  else
+    return {storage.e2_h, storage.d1_h, storage.z0_h, storage.z1_h, storage.i2_h};
+}
+
+template <class T, Device D>
+DistWorkSpaceHostMirror<T, D> makeDistWorkSpaceHostMirror(TridiagSolverWorkSpaces<T, D>& storage,
+                                                          WorkSpace<T, D>& ws) {
+  if constexpr (D == Device::CPU)
+    return {ws.e0, ws.e2, ws.d1, ws.z0, ws.z1, ws.i2};
+  else
+    return {storage.e0_h, storage.e2_h, storage.d1_h, storage.z0_h, storage.z1_h, storage.i2_h};
+}
+
 template <class T>
 Matrix<T, Device::CPU> initMirrorMatrix(Matrix<T, Device::GPU>& mat) {
   return Matrix<T, Device::CPU>(mat.distribution());
@@ -463,7 +482,8 @@ void solveRank1Problem(const SizeType i_begin, const SizeType i_end, KSender&& k
 
   TileCollector tc{i_begin, i_end};
 
-  const std::size_t nthreads = getTridiagRank1NWorkers();
+  const std::size_t nthreads = getTridiagRank1NWorkers(n);
+  const auto barrier_busy_wait = getTridiagRank1BarrierBusyWait(nthreads, n);
   ex::start_detached(
       ex::when_all(ex::just(std::make_unique<pika::barrier<>>(nthreads)), std::forward<KSender>(k),
                    std::forward<RhoSender>(rho), ex::when_all_vector(tc.read(d)),
@@ -471,12 +491,13 @@ void solveRank1Problem(const SizeType i_begin, const SizeType i_end, KSender&& k
                    ex::when_all_vector(tc.readwrite(evecs)),
                    ex::just(std::vector<memory::MemoryView<T, Device::CPU>>())) |
       ex::transfer(di::getBackendScheduler<Backend::MC>(pika::execution::thread_priority::high)) |
-      ex::bulk(nthreads, [nthreads, n, nb](std::size_t thread_idx, auto& barrier_ptr, auto& k, auto& rho,
-                                           auto& d_tiles_futs, auto& z_tiles, auto& eval_tiles,
-                                           auto& evec_tiles, auto& ws_vecs) {
+      ex::bulk(nthreads, [nthreads, n, nb, barrier_busy_wait](
+                             std::size_t thread_idx, auto& barrier_ptr, auto& k, auto& rho,
+                             auto& d_tiles_futs, auto& z_tiles, auto& eval_tiles, auto& evec_tiles,
+                             auto& ws_vecs) {
+        const common::Timer<> timeit;
         const matrix::Distribution distr(LocalElementSize(n, n), TileElementSize(nb, nb));
 
-        const auto barrier_busy_wait = getTridiagRank1BarrierBusyWait();
         const std::size_t batch_size = util::ceilDiv(to_sizet(k), nthreads);
         const std::size_t begin = thread_idx * batch_size;
         const std::size_t end = std::min(thread_idx * batch_size + batch_size, to_sizet(k));
@@ -490,7 +511,7 @@ void solveRank1Problem(const SizeType i_begin, const SizeType i_end, KSender&& k
 
         barrier_ptr->arrive_and_wait(barrier_busy_wait);
 
-        // STEP 1: LAED4 (multi-thread)
+        // STEP 1: Secular equations (multi-thread)
         const T* d_ptr = d_tiles_futs[0].get().ptr();
         const T* z_ptr = z_tiles[0].ptr();
 
@@ -499,15 +520,14 @@ void solveRank1Problem(const SizeType i_begin, const SizeType i_end, KSender&& k
 
           T* eval_ptr = eval_tiles[0].ptr();
 
-          for (std::size_t i = begin; i < end; ++i) {
-            T& eigenval = eval_ptr[i];
+          auto delta_col = [&distr, &evec_tiles](const SizeType i) {
+            const SizeType i_tile = distr.globalTileLinearIndex(GlobalElementIndex(0, i));
+            const SizeType i_col = distr.tileElementFromGlobalElement<Coord::Col>(i);
+            return evec_tiles[to_sizet(i_tile)].ptr(TileElementIndex(0, i_col));
+          };
 
-            const SizeType i_tile = distr.globalTileLinearIndex(GlobalElementIndex(0, to_SizeType(i)));
-            const SizeType i_col = distr.tileElementFromGlobalElement<Coord::Col>(to_SizeType(i));
-            T* delta = evec_tiles[to_sizet(i_tile)].ptr(TileElementIndex(0, i_col));
-
-            lapack::laed4(to_int(k), to_int(i), d_ptr, z_ptr, delta, rho, &eigenval);
-          }
+          solveSecularEquations(k, to_SizeType(begin), to_SizeType(end), d_ptr, z_ptr, rho, eval_ptr,
+                                delta_col);
           // Note for in-place row permutation implementation: The rows should be permuted for the k=2 case as well.
           if (k <= 2)
             return;
@@ -519,6 +539,19 @@ void solveRank1Problem(const SizeType i_begin, const SizeType i_end, KSender&& k
         auto& q = evec_tiles;
         T* w = ws_vecs[thread_idx]();
 
+        // Calls fn(i_begin, i_end, col_ptr) for each tile-contiguous chunk [i_begin, i_end) of the first
+        // k rows of column j of q, where col_ptr points to the element (i_begin, j).
+        // In this way the element indices are computed once per tile, and the inner loops access
+        // contiguous memory and can be vectorized.
+        auto for_each_col_chunk = [&](const SizeType j, auto&& fn) {
+          for (SizeType i_begin = 0; i_begin < k; i_begin += nb) {
+            const GlobalElementIndex ij(i_begin, j);
+            const auto q_tile = distr.globalTileLinearIndex(ij);
+            T* q_col = q[to_sizet(q_tile)].ptr(distr.tileElementIndex(ij));
+            fn(i_begin, std::min<SizeType>(i_begin + nb, k), q_col);
+          }
+        };
+
         // - copy diagonal from q -> w (or just initialize with 1)
         if (thread_idx == 0) {
           for (auto i = 0; i < k; ++i) {
@@ -534,35 +567,42 @@ void solveRank1Problem(const SizeType i_begin, const SizeType i_end, KSender&& k
         }
 
         // - compute productorial
-        auto compute_w = [&](const GlobalElementIndex ij) {
-          const auto q_tile = distr.globalTileLinearIndex(ij);
-          const auto q_ij = distr.tileElementIndex(ij);
-
-          const SizeType i = ij.row();
-          const SizeType j = ij.col();
-
-          w[i] *= q[to_sizet(q_tile)](q_ij) / (d_ptr[to_sizet(i)] - d_ptr[to_sizet(j)]);
-        };
-
         for (auto j = to_SizeType(begin); j < to_SizeType(end); ++j) {
-          for (auto i = 0; i < j; ++i)
-            compute_w({i, j});
-
-          for (auto i = j + 1; i < k; ++i)
-            compute_w({i, j});
+          const T d_j = d_ptr[to_sizet(j)];
+
+          auto compute_w = [w, d_ptr, d_j](const SizeType i_begin, const SizeType i_end,
+                                           const T* q_col) {
+            for (SizeType i = i_begin; i < i_end; ++i)
+              w[i] *= q_col[i - i_begin] / (d_ptr[i] - d_j);
+          };
+
+          for_each_col_chunk(j, [&](const SizeType i_begin, const SizeType i_end, const T* q_col) {
+            // Note: the diagonal element is skipped splitting the loop, so that it stays branch-free.
+            if (i_begin <= j && j < i_end) {
+              compute_w(i_begin, j, q_col);
+              compute_w(j + 1, i_end, q_col + (j + 1 - i_begin));
+            }
+            else {
+              compute_w(i_begin, i_end, q_col);
+            }
+          });
         }
 
         barrier_ptr->arrive_and_wait(barrier_busy_wait);
 
-        // STEP 2B: reduce, then finalize computation with sign and square root (single-thread)
-        if (thread_idx == 0) {
-          for (int i = 0; i < k; ++i) {
-            for (std::size_t tidx = 1; tidx < nthreads; ++tidx) {
-              const T* w_partial = ws_vecs[tidx]();
-              w[i] *= w_partial[i];
-            }
-            z_tiles[0].ptr()[i] = std::copysign(std::sqrt(-w[i]), z_ptr[to_sizet(i)]);
+        // STEP 2B: reduce, then finalize computation with sign and square root (multi-thread)
+        // Each thread reduces the partial products of all threads for its own range of rows.
+        {
+          T* w_0 = ws_vecs[0]();
+          for (std::size_t tidx = 1; tidx < nthreads; ++tidx) {
+            const T* w_partial = ws_vecs[tidx]();
+            for (std::size_t i = begin; i < end; ++i)
+              w_0[i] *= w_partial[i];
           }
+
+          T* z_out = z_tiles[0].ptr();
+          for (std::size_t i = begin; i < end; ++i)
+            z_out[i] = std::copysign(std::sqrt(-w_0[i]), z_ptr[i]);
         }
 
         barrier_ptr->arrive_and_wait(barrier_busy_wait);
@@ -575,23 +615,22 @@ void solveRank1Problem(const SizeType i_begin, const SizeType i_end, KSender&& k
           T* s = ws_vecs[thread_idx]();
 
           for (auto j = to_SizeType(begin); j < to_SizeType(end); ++j) {
-            for (int i = 0; i < k; ++i) {
-              const auto q_tile = distr.globalTileLinearIndex({i, j});
-              const auto q_ij = distr.tileElementIndex({i, j});
-
-              s[i] = w[i] / q[to_sizet(q_tile)](q_ij);
-            }
+            for_each_col_chunk(j, [&](const SizeType i_begin, const SizeType i_end, const T* q_col) {
+              for (SizeType i = i_begin; i < i_end; ++i)
+                s[i] = w[i] / q_col[i - i_begin];
+            });
 
             const T vec_norm = blas::nrm2(k, s, 1);
 
-            for (auto i = 0; i < k; ++i) {
-              const auto q_tile = distr.globalTileLinearIndex({i, j});
-              const auto q_ij = distr.tileElementIndex({i, j});
-
-              q[to_sizet(q_tile)](q_ij) = s[i] / vec_norm;
-            }
+            for_each_col_chunk(j, [&](const SizeType i_begin, const SizeType i_end, T* q_col) {
+              for (SizeType i = i_begin; i < i_end; ++i)
+                q_col[i - i_begin] = s[i] / vec_norm;
+            });
           }
         }
+
+        if (thread_idx == 0 && getTuneParameters().tridiag_rank1_adaptive)
+          getTridiagRank1Policy().update(timeit.elapsed(), 1, n, nthreads);
       }));
 }
 
@@ -708,6 +747,58 @@ void setUnitDiag(const SizeType i_begin, const SizeType i_end, KSender&& k, Matr
   }
 }
 
+// Computes in place the eigenvectors of the merged problem Q * U one tile row at a time, where @p e0
+// contains Q and @p e2 contains U with rows in deflated order.
+//
+// For each tile row, the tile row of Q is copied into @p panel with the columns permuted with @p i3
+// (initial <--- deflated), which is equivalent to apply the row permutation initial ---> deflated to U,
+// then it is multiplied with U and the result is stored back in the same tile row of @p e0.
+template <Backend B, Device D, class T>
+void multiplyEvecsInPlace(const SizeType i_begin, const SizeType i_end, Matrix<const SizeType, D>& i3,
+                          Matrix<const T, D>& e2, Matrix<T, D>& e0, Matrix<T, D>& panel) {
+  namespace ex = pika::execution::experimental;
+  namespace di = dlaf::internal;
+
+  const matrix::Distribution& dist = e0.distribution();
+  const SizeType n = problemSize(i_begin, i_end, dist);
+  const SizeType ntiles = i_end - i_begin;
+
+  auto perms_range = common::iterate_range2d(LocalTileIndex(i_begin, 0), LocalTileSize(ntiles, 1));
+  auto panel_range = common::iterate_range2d(LocalTileIndex(0, i_begin), LocalTileSize(1, ntiles));
+
+  for (SizeType i = i_begin; i < i_end; ++i) {
+    const SizeType nrows = dist.tileSize<Coord::Row>(i);
+    const matrix::Distribution subm_dist(LocalElementSize(nrows, n), dist.blockSize());
+    auto row_range = common::iterate_range2d(LocalTileIndex(i, i_begin), LocalTileSize(1, ntiles));
+
+    auto permute_fn = [subm_dist](const auto& index_tiles, const auto& row_tiles,
+                                  const auto& panel_tiles, auto&&... ts) {
+      const SizeType* i_ptr = index_tiles[0].get().ptr();
+      permutations::internal::applyPermutations<T, D, Coord::Col>(
+          GlobalElementIndex(0, 0), subm_dist.size(), 0, subm_dist, i_ptr, row_tiles, panel_tiles,
+          std::forward<decltype(ts)>(ts)...);
+    };
+    ex::start_detached(di::transform(
+        di::Policy<B>(), std::move(permute_fn),
+        ex::when_all(ex::when_all_vector(matrix::selectRead(i3, perms_range)),
+                     ex::when_all_vector(matrix::selectRead(e0, row_range)),
+                     ex::when_all_vector(matrix::select(panel, panel_range)))));
+
+    for (SizeType j = i_begin; j < i_end; ++j) {
+      for (SizeType k = i_begin; k < i_end; ++k) {
+        // Note: the panel tiles have a full tile row, which is larger than the last tile row of Q.
+        const TileElementSize sz_panel(nrows, dist.tileSize<Coord::Col>(k));
+        auto panel_tile = splitTile(panel.read(LocalTileIndex(0, k)), {{0, 0}, sz_panel});
+        ex::start_detached(di::whenAllLift(blas::Op::NoTrans, blas::Op::NoTrans, T(1),
+                                           std::move(panel_tile), e2.read(GlobalTileIndex(k, j)),
+                                           k == i_begin ? T(0) : T(1),
+                                           e0.readwrite(GlobalTileIndex(i, j))) |
+                           tile::gemm(di::Policy<B>()));
+      }
+    }
+  }
+}
+
 template <Backend B, Device D, class T, class RhoSender>
 void mergeSubproblems(const SizeType i_begin, const SizeType i_split, const SizeType i_end,
                       RhoSender&& rho, WorkSpace<T, D>& ws, WorkSpaceHost<T>& ws_h,
@@ -762,7 +853,8 @@ void mergeSubproblems(const SizeType i_begin, const SizeType i_split, const Size
 
   applyGivensRotationsToMatrixColumns(i_begin, i_end, std::move(rots), ws.e0);
   // Placeholder for rearranging the eigenvectors: (local permutation)
-  copy(idx_loc_begin, sz_loc_tiles, ws.e0, ws.e1);
+  if (ws.mode == TridiagMemoryMode::Standard)
+    copy(idx_loc_begin, sz_loc_tiles, ws.e0, ws.e1);
 
   // Step #2
   //
@@ -801,13 +893,20 @@ void mergeSubproblems(const SizeType i_begin, const SizeType i_split, const Size
   // The eigenvectors resulting from the multiplication are already in the order of the eigenvalues as
   // prepared for the deflated system.
   //
-  copy(idx_begin_tiles_vec, sz_tiles_vec, ws_hm.i2, ws.i2);
-  // The following permutation will be removed in the future.
-  // (The copy is needed to simplify the removal)
-  dlaf::permutations::permute<B, D, T, Coord::Row>(i_begin, i_end, ws.i2, ws.e2, ws.e0);
-  copy(idx_loc_begin, sz_loc_tiles, ws.e0, ws.e2);
-  dlaf::multiplication::generalSubMatrix<B, D, T>(i_begin, i_end, blas::Op::NoTrans, blas::Op::NoTrans,
-                                                  T(1), ws.e1, ws.e2, T(0), ws.e0);
+  if (ws.mode == TridiagMemoryMode::Standard) {
+    copy(idx_begin_tiles_vec, sz_tiles_vec, ws_hm.i2, ws.i2);
+    // The following permutation will be removed in the future.
+    // (The copy is needed to simplify the removal)
+    dlaf::permutations::permute<B, D, T, Coord::Row>(i_begin, i_end, ws.i2, ws.e2, ws.e0);
+    copy(idx_loc_begin, sz_loc_tiles, ws.e0, ws.e2);
+    dlaf::multiplication::generalSubMatrix<B, D, T>(i_begin, i_end, blas::Op::NoTrans,
+                                                    blas::Op::NoTrans, T(1), ws.e1, ws.e2, T(0), ws.e0);
+  }
+  else {
+    // Note: i2 (initial ---> deflated) is not needed anymore, hence ws.i2 is used to store i3.
+    copy(idx_begin_tiles_vec, sz_tiles_vec, ws_h.i3, ws.i2);
+    multiplyEvecsInPlace<B, D, T>(i_begin, i_end, ws.i2, ws.e2, ws.e0, ws.e0_panel);
+  }
 
   // Step #4: Final permutation to sort eigenvalues and eigenvectors
   //
@@ -966,25 +1065,27 @@ void solveRank1ProblemDist(const SizeType i_begin, const SizeType i_end,
                            const LocalTileIndex idx_loc_begin, const LocalTileSize sz_loc_tiles,
                            KSender&& k, RhoSender&& rho, Matrix<const T, Device::CPU>& d,
                            Matrix<const T, Device::CPU>& z, Matrix<T, Device::CPU>& evals,
-                           Matrix<T, Device::CPU>& delta, Matrix<SizeType, Device::CPU>& i2,
-                           Matrix<T, Device::CPU>& evecs) {
+                           Matrix<SizeType, Device::CPU>& i2, Matrix<T, Device::CPU>& evecs,
+                           Matrix<T, Device::CPU>& delta) {
   namespace ex = pika::execution::experimental;
   namespace di = dlaf::internal;
 
   const matrix::Distribution& dist = evecs.distribution();
   auto rank1_fn = [i_begin, i_end, idx_loc_begin, sz_loc_tiles,
                    dist](const auto& k, const auto& rho, const auto& d_sfut_tile_arr,
-                         const auto& z_sfut_tile_arr, const auto& eval_tiles, const auto& delta_tile_arr,
-                         const auto& i2_tile_arr, const auto& evec_tile_arr) {
+                         const auto& z_sfut_tile_arr, const auto& eval_tiles, const auto& i2_tile_arr,
+                         const auto& evec_tile_arr, const auto& delta_tile_arr) {
     common::internal::SingleThreadedBlasScope single;
 
     const SizeType n = problemSize(i_begin, i_end, dist);
     const T* d_ptr = d_sfut_tile_arr[0].get().ptr();
     const T* z_ptr = z_sfut_tile_arr[0].get().ptr();
     T* eval_ptr = eval_tiles[0].ptr();
-    T* delta_ptr = delta_tile_arr[0].ptr();
     SizeType* i2_ptr = i2_tile_arr[0].ptr();
 
+    // Contiguous buffer for the delta columns of a tile column (column j stored at j * k)
+    T* delta_ptr_begin = delta_tile_arr[0].ptr();
+
     // Iterate over the columns of the local submatrix tile grid
     for (SizeType j_loc_subm_tile = 0; j_loc_subm_tile < sz_loc_tiles.cols(); ++j_loc_subm_tile) {
       // The tile column in the local matrix tile grid
@@ -1001,14 +1102,15 @@ void solveRank1ProblemDist(const SizeType i_begin, const SizeType i_end,
 
       // Iterate over the elements of the column tile
       const SizeType ncols = std::min(dist.tileSize<Coord::Col>(j_gl_tile), k - j_gl_subm_el);
-      for (SizeType j_tile_el = 0; j_tile_el < ncols; ++j_tile_el) {
-        // The global submatrix column
-        const SizeType j_gl_el = j_gl_subm_el + j_tile_el;
 
-        // Solve the deflated rank-1 problem
-        T& eigenval = eval_ptr[to_sizet(j_gl_el)];
-        lapack::laed4(static_cast<int>(k), static_cast<int>(j_gl_el), d_ptr, z_ptr, delta_ptr, rho,
-                      &eigenval);
+      // Solve the deflated rank-1 problem for all the columns of the tile column
+      solveSecularEquations(k, j_gl_subm_el, j_gl_subm_el + ncols, d_ptr, z_ptr, rho, eval_ptr,
+                            [&](const SizeType j_gl_el) {
+                              return delta_ptr_begin + (j_gl_el - j_gl_subm_el) * k;
+                            });
+
+      for (SizeType j_tile_el = 0; j_tile_el < ncols; ++j_tile_el) {
+        const T* delta_ptr = delta_ptr_begin + j_tile_el * k;
 
         // Iterate over the rows of the local submatrix tile grid and copy the parts from delta stored on this rank.
         for (SizeType i_loc_subm_tile = 0; i_loc_subm_tile < sz_loc_tiles.rows(); ++i_loc_subm_tile) {
@@ -1064,8 +1166,8 @@ void solveRank1ProblemDist(const SizeType i_begin, const SizeType i_end,
   auto sender =
       ex::when_all(std::forward<KSender>(k), std::forward<RhoSender>(rho),
                    ex::when_all_vector(tc.read(d)), ex::when_all_vector(tc.read(z)),
-                   ex::when_all_vector(tc.readwrite(evals)), ex::when_all_vector(tc.readwrite(delta)),
-                   ex::when_all_vector(tc.readwrite(i2)), ex::when_all_vector(tc.readwrite(evecs)));
+                   ex::when_all_vector(tc.readwrite(evals)), ex::when_all_vector(tc.readwrite(i2)),
+                   ex::when_all_vector(tc.readwrite(evecs)), ex::when_all_vector(tc.readwrite(delta)));
 
   ex::start_detached(di::transform(di::Policy<Backend::MC>(), std::move(rank1_fn), std::move(sender)));
 }
@@ -1182,11 +1284,10 @@ void mergeDistSubproblems(comm::CommunicatorGrid grid,
   //
   invertIndex(i_begin, i_end, ws_h.i3, ws_hm.i2);
 
-  // Note: here ws_hm.z0 is used as a contiguous buffer for the laed4 call
   matrix::util::set0<Backend::MC>(pika::execution::thread_priority::normal, idx_loc_begin, sz_loc_tiles,
                                   ws_hm.e2);
   solveRank1ProblemDist(i_begin, i_end, idx_loc_begin, sz_loc_tiles, k, std::move(scaled_rho), ws_hm.d1,
-                        ws_hm.z1, ws_h.d0, ws_hm.z0, ws_hm.i2, ws_hm.e2);
+                        ws_hm.z1, ws_h.d0, ws_hm.i2, ws_hm.e2, ws_h.delta);
 
   assembleDistEvalsVec(row_task_chain, i_begin, i_end, dist_evecs, ws_h.d0);
 
@@ -0,0 +1,300 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include <lapack.hh>
+// LAPACKPP includes complex.h which defines the macro I.
+// This breaks pika.
+#ifdef I
+#undef I
+#endif
+
+#include <dlaf/common/assert.h>
+#include <dlaf/types.h>
+
+namespace dlaf::eigensolver::internal {
+
+// Number of roots of the secular equation which are computed together by solveSecularEquations.
+inline constexpr std::size_t secular_batch_size = 8;
+
+// Maximum number of iterations of the batched solver of the secular equation for each batch.
+inline constexpr int secular_max_iterations = 30;
+
+// Computes the roots with index in [i_begin, i_end) of the secular equation
+//
+//   f(lambda) = 1 / rho + sum_j z_j^2 / (d_j - lambda) = 0
+//
+// of the rank-1 update problem diag(d) + rho * z * z^T of size k, calling laed4 for each of them.
+//
+// On exit, evals[i] contains the i-th eigenvalue and delta_col(i) points to the k-vector which contains
+// d_j - evals[i]. (See laed4 documentation for the k <= 2 case.)
+//
+// @pre d is sorted in ascending order, ||z|| == 1 and rho > 0.
+template <class T, class DeltaColFn>
+void solveSecularEquationsLaed4(const SizeType k, const SizeType i_begin, const SizeType i_end,
+                                const T* d, const T* z, const T rho, T* evals,
+                                DeltaColFn&& delta_col) {
+  for (SizeType i = i_begin; i < i_end; ++i)
+    lapack::laed4(to_int(k), to_int(i), d, z, delta_col(i), rho, &evals[i]);
+}
+
+// Batched version of solveSecularEquationsLaed4 which produces the same output.
+//
+// The roots are computed in batches of secular_batch_size with the same fixed weight iteration used by
+// laed4 and a shared iteration schedule: at each iteration the sums over the k poles are evaluated for
+// all the roots of the batch at once, with the roots as innermost (vectorizable) loop. Converged roots
+// are masked, and the iteration of the batch stops when all its roots have converged.
+// The roots which have not converged after @p max_iterations iterations are computed with laed4.
+//
+// Note: for k <= 2 laed4 returns the components of the eigenvectors instead of the differences, hence
+// laed4 is used directly.
+// @return the number of roots computed with laed4.
+template <class T, class DeltaColFn>
+SizeType solveSecularEquations(const SizeType k, const SizeType i_begin, const SizeType i_end,
+                               const T* d, const T* z, const T rho, T* evals, DeltaColFn&& delta_col,
+                               const int max_iterations = secular_max_iterations) {
+  static_assert(std::is_floating_point_v<T>, "The secular equation is defined for real types only");
+  DLAF_ASSERT_HEAVY(rho > 0, rho);
+  DLAF_ASSERT_HEAVY(max_iterations >= 0, max_iterations);
+
+  if (k <= 2) {
+    solveSecularEquationsLaed4(k, i_begin, i_end, d, z, rho, evals, delta_col);
+    return i_end - i_begin;
+  }
+
+  SizeType nr_laed4 = 0;
+
+  constexpr std::size_t nb = secular_batch_size;
+  const T eps = std::numeric_limits<T>::epsilon();
+  const T rho_inv = T(1) / rho;
+
+  for (SizeType i_batch = i_begin; i_batch < i_end; i_batch += to_SizeType(nb)) {
+    const std::size_t nr = to_sizet(std::min<SizeType>(to_SizeType(nb), i_end - i_batch));
+
+    // For each root of the batch:
+    // - p0: the root is modelled with the two poles p0 and p0 + 1 (for the last root p0 = k - 2),
+    //       the terms with j <= p0 contribute to psi, the others to phi.
+    // - origin, tau: the root is origin + tau, where origin is a pole (i.e. the differences are computed
+    //       as (d_j - origin) - tau, which is accurate for roots close to the origin).
+    // - lo, hi: bracket of tau which contains the root.
+    std::array<SizeType, nb> p0{};
+    std::array<bool, nb> last{};
+    std::array<bool, nb> orgati{};
+    std::array<bool, nb> done{};
+    std::array<T, nb> origin{};
+    std::array<T, nb> tau{};
+    std::array<T, nb> lo{};
+    std::array<T, nb> hi{};
+
+    std::array<T, nb> psi{};
+    std::array<T, nb> phi{};
+    std::array<T, nb> dpsi{};
+    std::array<T, nb> dphi{};
+
+    // Evaluates psi, phi and their derivatives for all the roots of the batch at the current tau.
+    // If exclude_poles is true the terms of the poles p0 and p0 + 1 are not included.
+    auto evaluate = [&](const bool exclude_poles) {
+      psi.fill(T(0));
+      phi.fill(T(0));
+      dpsi.fill(T(0));
+      dphi.fill(T(0));
+
+      for (SizeType j = 0; j < k; ++j) {
+        const T d_j = d[j];
+        const T z_j = z[j];
+        for (std::size_t r = 0; r < nr; ++r) {
+          const T t = z_j / ((d_j - origin[r]) - tau[r]);
+          const bool is_pole = exclude_poles && (j == p0[r] || j == p0[r] + 1);
+          const T w = is_pole ? T(0) : z_j * t;
+          const T dw = is_pole ? T(0) : t * t;
+          const bool left = j <= p0[r];
+          psi[r] += left ? w : T(0);
+          dpsi[r] += left ? dw : T(0);
+          phi[r] += left ? T(0) : w;
+          dphi[r] += left ? T(0) : dw;
+        }
+      }
+    };
+
+    // Initial guess (see laed4): the equation is evaluated at the midpoint of the interval containing
+    // the root, to select the origin and the bracket, then the initial tau is computed with the model
+    // using the two closest poles exactly and the other terms as constant.
+    for (std::size_t r = 0; r < nr; ++r) {
+      const SizeType i = i_batch + to_SizeType(r);
+      last[r] = (i == k - 1);
+      p0[r] = last[r] ? k - 2 : i;
+      origin[r] = d[i];
+      tau[r] = last[r] ? rho / 2 : (d[i + 1] - d[i]) / 2;
+    }
+
+    evaluate(true);
+
+    for (std::size_t r = 0; r < nr; ++r) {
+      const SizeType i0 = p0[r];
+      const SizeType i1 = i0 + 1;
+      const T z0_2 = z[i0] * z[i0];
+      const T z1_2 = z[i1] * z[i1];
+      const T del = d[i1] - d[i0];
+      const T midpt = tau[r];
+      const T c = rho_inv + psi[r] + phi[r];
+      const T w = c + z0_2 / ((d[i0] - origin[r]) - midpt) + z1_2 / ((d[i1] - origin[r]) - midpt);
+
+      if (last[r]) {
+        auto model_tau = [&]() {
+          const T a = -c * del + z0_2 + z1_2;
+          const T b = z1_2 * del;
+          if (a < 0)
+            return 2 * b / (std::sqrt(a * a + 4 * b * c) - a);
+          return (a + std::sqrt(a * a + 4 * b * c)) / (2 * c);
+        };
+
+        if (w <= 0) {
+          const T temp = z0_2 / (del + rho) + z1_2 / rho;
+          tau[r] = (c <= temp) ? rho : model_tau();
+          lo[r] = midpt;
+          hi[r] = rho;
+        }
+        else {
+          tau[r] = model_tau();
+          lo[r] = 0;
+          hi[r] = midpt;
+        }
+      }
+      else if (w > 0) {
+        // d(i) < lambda_i < (d(i) + d(i+1)) / 2: d(i) is the origin
+        orgati[r] = true;
+        const T a = c * del + z0_2 + z1_2;
+        const T b = z0_2 * del;
+        tau[r] = (a > 0) ? 2 * b / (a + std::sqrt(std::abs(a * a - 4 * b * c)))
+                         : (a - std::sqrt(std::abs(a * a - 4 * b * c))) / (2 * c);
+        lo[r] = 0;
+        hi[r] = midpt;
+      }
+      else {
+        // (d(i) + d(i+1)) / 2 <= lambda_i < d(i+1): d(i+1) is the origin
+        orgati[r] = false;
+        origin[r] = d[i1];
+        const T a = c * del - z0_2 - z1_2;
+        const T b = z1_2 * del;
+        tau[r] = (a < 0) ? 2 * b / (a - std::sqrt(std::abs(a * a + 4 * b * c)))
+                         : -(a + std::sqrt(std::abs(a * a + 4 * b * c))) / (2 * c);
+        lo[r] = -midpt;
+        hi[r] = 0;
+      }
+
+      // Make sure the initial guess is inside the bracket.
+      if (!(tau[r] > lo[r] && tau[r] <= hi[r]))
+        tau[r] = (lo[r] + hi[r]) / 2;
+    }
+
+    // Fixed weight iterations (see laed4) with a shared schedule for the whole batch.
+    for (int iter = 0; iter < max_iterations; ++iter) {
+      evaluate(false);
+
+      bool all_done = true;
+      for (std::size_t r = 0; r < nr; ++r) {
+        if (done[r])
+          continue;
+
+        const T dw = dpsi[r] + dphi[r];
+        const T w = rho_inv + psi[r] + phi[r];
+        const T erretm = 8 * (phi[r] - psi[r]) + 2 * rho_inv + 3 * std::abs(tau[r]) * dw;
+
+        const T bracket_tol = eps * std::max(std::abs(lo[r]), std::abs(hi[r]));
+        if (std::abs(w) <= eps * erretm || hi[r] - lo[r] <= bracket_tol) {
+          done[r] = true;
+          continue;
+        }
+        all_done = false;
+
+        // Update the bracket (f is increasing)
+        if (w <= 0)
+          lo[r] = std::max(lo[r], tau[r]);
+        else
+          hi[r] = std::min(hi[r], tau[r]);
+
+        const SizeType i0 = p0[r];
+        const SizeType i1 = i0 + 1;
+        const T delta0 = (d[i0] - origin[r]) - tau[r];
+        const T delta1 = (d[i1] - origin[r]) - tau[r];
+
+        T a = (delta0 + delta1) * w - delta0 * delta1 * dw;
+        const T b = delta0 * delta1 * w;
+        T eta;
+        if (last[r]) {
+          const T c = w - delta0 * dpsi[r] - delta1 * dphi[r];
+          if (c == 0)
+            eta = -w / dw;
+          else if (a >= 0)
+            eta = (a + std::sqrt(std::abs(a * a - 4 * b * c))) / (2 * c);
+          else
+            eta = 2 * b / (a - std::sqrt(std::abs(a * a - 4 * b * c)));
+        }
+        else {
+          const T t0 = z[i0] / delta0;
+          const T t1 = z[i1] / delta1;
+          const T c = orgati[r] ? w - delta1 * dw - (delta0 - delta1) * t0 * t0
+                                : w - delta0 * dw - (delta1 - delta0) * t1 * t1;
+          if (c == 0) {
+            if (a == 0)
+              a = orgati[r] ? z[i0] * z[i0] + delta1 * delta1 * dw
+                            : z[i1] * z[i1] + delta0 * delta0 * dw;
+            eta = b / a;
+          }
+          else if (a <= 0) {
+            eta = (a - std::sqrt(std::abs(a * a - 4 * b * c))) / (2 * c);
+          }
+          else {
+            eta = 2 * b / (a + std::sqrt(std::abs(a * a - 4 * b * c)));
+          }
+        }
+
+        // If the step goes in the wrong direction use a Newton step instead.
+        if (!std::isfinite(eta) || w * eta >= 0)
+          eta = -w / dw;
+
+        // Keep the iterate inside the bracket.
+        if (!(tau[r] + eta > lo[r] && tau[r] + eta < hi[r]))
+          eta = ((w < 0 ? hi[r] : lo[r]) - tau[r]) / 2;
+
+        tau[r] += eta;
+      }
+
+      if (all_done)
+        break;
+    }
+
+    for (std::size_t r = 0; r < nr; ++r) {
+      const SizeType i = i_batch + to_SizeType(r);
+      T* delta = delta_col(i);
+
+      if (!done[r]) {
+        lapack::laed4(to_int(k), to_int(i), d, z, delta, rho, &evals[i]);
+        ++nr_laed4;
+        continue;
+      }
+
+      for (SizeType j = 0; j < k; ++j)
+        delta[j] = (d[j] - origin[r]) - tau[r];
+      evals[i] = origin[r] + tau[r];
+    }
+  }
+
+  return nr_laed4;
+}
+
+}
@@ -0,0 +1,173 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <cstddef>
+
+#include <dlaf/eigensolver/internal/get_tridiag_memory_mode.h>
+#include <dlaf/eigensolver/tridiag_solver/coltype.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/index.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/types.h>
+
+namespace dlaf::eigensolver::internal {
+
+/// Storage of the auxiliary matrices and vectors used by the D&C tridiagonal eigensolver.
+///
+/// Contrary to the workspace views used by the algorithm (see WorkSpace in merge.h), it does not alias
+/// the output eigenvalues and eigenvectors, hence it can be allocated once for a given distribution of
+/// the eigenvectors and re-used for multiple calls of the solver.
+///
+/// Host mirrors are allocated just for Device::GPU, since for Device::CPU the device matrices are
+/// used directly. Matrices that are not needed for the requested setup are empty.
+///
+/// With TridiagMemoryMode::Lean (supported by the local solver only) e1 is not allocated and the
+/// eigenvectors are updated in place using the single tile row e0_panel as workspace.
+template <class T, Device D>
+struct TridiagSolverWorkSpaces {
+  /// @param dist_evecs distribution of the (n x n) eigenvector matrix the workspace is used with,
+  /// @param distributed true if the workspace is used by the distributed solver,
+  /// @param complex_evecs true if the solver outputs complex eigenvectors, which requires an additional
+  ///        real (n x n) matrix,
+  /// @param mode the requested memory mode, which is ignored (i.e. TridiagMemoryMode::Standard is used)
+  ///        by the distributed solver.
+  TridiagSolverWorkSpaces(const matrix::Distribution& dist_evecs, const bool distributed,
+                          const bool complex_evecs,
+                          const TridiagMemoryMode mode = getTridiagMemoryMode())
+      : mode(distributed ? TridiagMemoryMode::Standard : mode), distributed(distributed),
+        complex_evecs(complex_evecs), dist_evecs(dist_evecs),
+        dist_vec(LocalElementSize(dist_evecs.size().rows(), 1),
+                 TileElementSize(dist_evecs.blockSize().rows(), 1)),
+        e0(dist_evecs), e1(maybe<T, D>(isStandard(), dist_evecs)),
+        e0_panel(maybe<T, D>(!isStandard(), rowPanelDistribution(dist_evecs))),
+        real_evecs(maybe<T, D>(complex_evecs, dist_evecs)), z0(dist_vec), z1(dist_vec),
+        i2(dist_vec), d0(dist_vec), c(dist_vec), i1(dist_vec), i3(dist_vec),
+        delta(maybe<T, Device::CPU>(distributed, deltaDistribution(dist_evecs))),
+        e0_h(maybe<T, Device::CPU>(is_gpu && distributed, dist_evecs)),
+        e2_h(maybe<T, Device::CPU>(is_gpu, dist_evecs)),
+        d1_h(maybe<T, Device::CPU>(is_gpu, dist_vec)), z0_h(maybe<T, Device::CPU>(is_gpu, dist_vec)),
+        z1_h(maybe<T, Device::CPU>(is_gpu, dist_vec)),
+        i2_h(maybe<SizeType, Device::CPU>(is_gpu, dist_vec)) {}
+
+  /// Return true if the workspace can be used with eigenvectors distributed as @p dist.
+  bool isCompatible(const matrix::Distribution& dist) const noexcept {
+    return dist == dist_evecs;
+  }
+
+  bool isStandard() const noexcept {
+    return mode == TridiagMemoryMode::Standard;
+  }
+
+  /// Return the peak memory (in bytes) allocated on this rank by the solver using this workspace.
+  ///
+  /// See the static overload.
+  std::size_t peakMemoryBytes() const noexcept {
+    return peakMemoryBytes(dist_evecs, distributed, complex_evecs, mode);
+  }
+
+  /// Return the peak memory (in bytes) allocated on this rank by the solver using a workspace created
+  /// with the given parameters, i.e. the size of the workspaces (host and device) and of the output
+  /// eigenvalues and eigenvectors (with element type std::complex<T> if complex_evecs is true).
+  ///
+  /// The returned value does not include the memory needed for the tridiagonal matrix and the transient
+  /// allocations of the tile kernels.
+  static std::size_t peakMemoryBytes(const matrix::Distribution& dist_evecs, const bool distributed,
+                                     const bool complex_evecs, TridiagMemoryMode mode) noexcept {
+    if (distributed)
+      mode = TridiagMemoryMode::Standard;
+
+    const std::size_t n = to_sizet(dist_evecs.size().rows());
+    const std::size_t nb = to_sizet(dist_evecs.blockSize().rows());
+    const std::size_t n2_local = to_sizet(dist_evecs.localSize().linear_size());
+
+    // Output
+    std::size_t bytes = (complex_evecs ? 2 : 1) * sizeof(T) * n2_local + sizeof(T) * n;
+
+    // Matrices: e0, e1, e0_panel, real_evecs
+    bytes += sizeof(T) * n2_local;
+    if (mode == TridiagMemoryMode::Standard)
+      bytes += sizeof(T) * n2_local;
+    else
+      bytes += sizeof(T) * nb * n;
+    if (complex_evecs)
+      bytes += sizeof(T) * n2_local;
+
+    // Vectors: z0, z1, d0, i1, i2, i3, c, delta
+    bytes += (3 * sizeof(T) + 3 * sizeof(SizeType) + sizeof(ColType)) * n;
+    if (distributed)
+      bytes += sizeof(T) * nb * n;
+
+    // Host mirrors: e0_h, e2_h, d1_h, z0_h, z1_h, i2_h
+    if (is_gpu) {
+      bytes += (distributed ? 2 : 1) * sizeof(T) * n2_local;
+      bytes += (3 * sizeof(T) + sizeof(SizeType)) * n;
+    }
+
+    return bytes;
+  }
+
+  static constexpr bool is_gpu = (D == Device::GPU);
+
+  TridiagMemoryMode mode;
+  bool distributed;
+  bool complex_evecs;
+
+  matrix::Distribution dist_evecs;
+  matrix::Distribution dist_vec;
+
+  Matrix<T, D> e0;
+  Matrix<T, D> e1;
+  Matrix<T, D> e0_panel;
+  Matrix<T, D> real_evecs;
+
+  Matrix<T, D> z0;
+  Matrix<T, D> z1;
+  Matrix<SizeType, D> i2;
+
+  Matrix<T, Device::CPU> d0;
+  Matrix<ColType, Device::CPU> c;
+  Matrix<SizeType, Device::CPU> i1;
+  Matrix<SizeType, Device::CPU> i3;
+  // Contiguous buffer for the differences d_j - lambda_i computed by the distributed rank-1 problem
+  // solver. The tiles [i_begin, i_end) store nb columns of the sub-problem [i_begin, i_end).
+  Matrix<T, Device::CPU> delta;
+
+  Matrix<T, Device::CPU> e0_h;
+  Matrix<T, Device::CPU> e2_h;
+  Matrix<T, Device::CPU> d1_h;
+  Matrix<T, Device::CPU> z0_h;
+  Matrix<T, Device::CPU> z1_h;
+  Matrix<SizeType, Device::CPU> i2_h;
+
+private:
+  template <class U, Device DU>
+  static Matrix<U, DU> maybe(const bool needed, const matrix::Distribution& dist) {
+    if (needed)
+      return Matrix<U, DU>(dist);
+    return Matrix<U, DU>(LocalElementSize(0, 0), TileElementSize(1, 1));
+  }
+
+  // Distribution of a (n * nb) vector with one (nb * nb) tile for each tile row of the eigenvector
+  // matrix, where nb is its block size.
+  static matrix::Distribution deltaDistribution(const matrix::Distribution& dist) {
+    const SizeType nb = dist.blockSize().rows();
+    return matrix::Distribution(LocalElementSize(dist.size().rows() * nb, 1),
+                                TileElementSize(nb * nb, 1));
+  }
+
+  // Distribution of a single tile row with the same columns as the eigenvector matrix.
+  static matrix::Distribution rowPanelDistribution(const matrix::Distribution& dist) {
+    return matrix::Distribution(LocalElementSize(dist.blockSize().rows(), dist.size().cols()),
+                                dist.blockSize());
+  }
+};
+
+}
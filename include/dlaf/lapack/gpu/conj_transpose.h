@@ -0,0 +1,39 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#ifdef DLAF_WITH_GPU
+
+#include <blas.hh>
+#include <whip.hpp>
+
+#include <dlaf/gpu/blas/api.h>
+#include <dlaf/types.h>
+
+namespace dlaf::gpulapack {
+
+/// Copies the conjugate transpose of the m x n matrix a into the n x m matrix b.
+template <class T>
+void conjTranspose(const SizeType m, const SizeType n, const T* a, const SizeType lda, T* b,
+                   const SizeType ldb, const whip::stream_t stream);
+
+#define DLAF_CUBLAS_CONJ_TRANSPOSE_ETI(kword, Type)                                    \
+  kword template void conjTranspose(const SizeType m, const SizeType n, const Type* a, \
+                                    const SizeType lda, Type* b, const SizeType ldb,   \
+                                    const whip::stream_t stream)
+
+DLAF_CUBLAS_CONJ_TRANSPOSE_ETI(extern, float);
+DLAF_CUBLAS_CONJ_TRANSPOSE_ETI(extern, double);
+DLAF_CUBLAS_CONJ_TRANSPOSE_ETI(extern, std::complex<float>);
+DLAF_CUBLAS_CONJ_TRANSPOSE_ETI(extern, std::complex<double>);
+}
+
+#endif
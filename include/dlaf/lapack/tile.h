@@ -23,6 +23,7 @@
 
 #include <dlaf/common/assert.h>
 #include <dlaf/common/callable_object.h>
+#include <dlaf/common/index2d.h>
 #include <dlaf/common/single_threaded_blas.h>
 #include <dlaf/lapack/enum_output.h>
 #include <dlaf/matrix/index.h>
@@ -42,6 +43,7 @@
 #include <dlaf/gpu/lapack/api.h>
 #include <dlaf/gpu/lapack/assert_info.h>
 #include <dlaf/gpu/lapack/error.h>
+#include <dlaf/lapack/gpu/conj_transpose.h>
 #include <dlaf/lapack/gpu/laset.h>
 #include <dlaf/util_cublas.h>
 #endif
@@ -169,6 +171,29 @@ void laset(const dlaf::internal::Policy<B>& p, Sender&& s);
 template <Backend B>
 void laset(const dlaf::internal::Policy<B>& p);
 
+/// Copies the conjugate transpose of Tile @param a into Tile @param b, i.e. b = a^H.
+///
+/// @pre a.size() == transposed(b.size()).
+///
+/// This overload blocks until completion of the algorithm.
+template <Backend B, class T, Device D>
+void conjTranspose(const dlaf::internal::Policy<B>& p, const Tile<const T, D>& a, const Tile<T, D>& b);
+
+/// \overload conjTranspose
+///
+/// This overload takes a policy argument and a sender which must send all required arguments for the
+/// algorithm. Returns a sender which signals a connected receiver when the algorithm is done.
+template <Backend B, typename Sender,
+          typename = std::enable_if_t<pika::execution::experimental::is_sender_v<Sender>>>
+void conjTranspose(const dlaf::internal::Policy<B>& p, Sender&& s);
+
+/// \overload conjTranspose
+///
+/// This overload partially applies the algorithm with a policy for later use with operator| with a
+/// sender on the left-hand side.
+template <Backend B>
+void conjTranspose(const dlaf::internal::Policy<B>& p);
+
 /// Set zero all the elements of Tile @param tile.
 ///
 /// This overload blocks until completion of the algorithm.
@@ -206,7 +231,7 @@ void set0(const dlaf::internal::Policy<B>& p);
 /// This overload blocks until completion of the algorithm.
 template <Backend B, class T, Device D>
 void hegst(const dlaf::internal::Policy<B>&, const int itype, const blas::Uplo uplo, const Tile<T, D>& a,
-           const Tile<T, D>& b);
+           const Tile<const T, D>& b);
 
 /// \overload hegst
 ///
@@ -343,9 +368,18 @@ void set0(const Tile<T, Device::CPU>& tile) {
   tile::internal::laset(blas::Uplo::General, static_cast<T>(0.0), static_cast<T>(0.0), tile);
 }
 
+template <class T>
+void conjTranspose(const Tile<const T, Device::CPU>& a, const Tile<T, Device::CPU>& b) {
+  DLAF_ASSERT(a.size() == common::transposed(b.size()), a, b);
+
+  for (SizeType j = 0; j < b.size().cols(); ++j)
+    for (SizeType i = 0; i < b.size().rows(); ++i)
+      b({i, j}) = dlaf::conj(a({j, i}));
+}
+
 template <class T>
 void hegst(const int itype, const blas::Uplo uplo, const Tile<T, Device::CPU>& a,
-           const Tile<T, Device::CPU>& b) {
+           const Tile<const T, Device::CPU>& b) {
   DLAF_ASSERT(square_size(a), a);
   DLAF_ASSERT(square_size(b), b);
   DLAF_ASSERT(a.size() == b.size(), a, b);
@@ -545,31 +579,41 @@ void set0(const Tile<T, Device::GPU>& tile, whip::stream_t stream) {
                         sizeof(T) * to_sizet(tile.size().rows()), to_sizet(tile.size().cols()), stream);
 }
 
+template <class T>
+void conjTranspose(const Tile<const T, Device::GPU>& a, const Tile<T, Device::GPU>& b,
+                   whip::stream_t stream) {
+  DLAF_ASSERT(a.size() == common::transposed(b.size()), a, b);
+
+  gpulapack::conjTranspose(a.size().rows(), a.size().cols(), a.ptr(), a.ld(), b.ptr(), b.ld(), stream);
+}
+
 template <class T>
 void hegst(cusolverDnHandle_t handle, const int itype, const blas::Uplo uplo,
-           const matrix::Tile<T, Device::GPU>& a, const matrix::Tile<T, Device::GPU>& b) {
+           const matrix::Tile<T, Device::GPU>& a, const matrix::Tile<const T, Device::GPU>& b) {
   DLAF_ASSERT(square_size(a), a);
   DLAF_ASSERT(square_size(b), b);
   DLAF_ASSERT(a.size() == b.size(), a, b);
   const auto n = a.size().rows();
+  // B is only read by hegst, but the GPU libraries do not declare it const.
+  T* b_ptr = const_cast<T*>(b.ptr());
 
 #ifdef DLAF_WITH_CUDA
   int workspace_size;
   internal::CusolverHegst<T>::callBufferSize(handle, itype, util::blasToCublas(uplo), to_int(n),
                                              util::blasToCublasCast(a.ptr()), to_int(a.ld()),
-                                             util::blasToCublasCast(b.ptr()), to_int(b.ld()),
+                                             util::blasToCublasCast(b_ptr), to_int(b.ld()),
                                              &workspace_size);
   internal::CusolverInfo<T> info{std::max(1, workspace_size)};
   internal::CusolverHegst<T>::call(handle, itype, util::blasToCublas(uplo), to_int(n),
                                    util::blasToCublasCast(a.ptr()), to_int(a.ld()),
-                                   util::blasToCublasCast(b.ptr()), to_int(b.ld()),
+                                   util::blasToCublasCast(b_ptr), to_int(b.ld()),
                                    util::blasToCublasCast(info.workspace()), info.info());
 
   assertExtendInfo(dlaf::gpulapack::internal::assertInfoHegst, handle, std::move(info));
 #elif defined(DLAF_WITH_HIP)
   internal::CusolverHegst<T>::call(handle, util::blasToRocblas(itype), util::blasToRocblas(uplo),
                                    to_int(n), util::blasToRocblasCast(a.ptr()), to_int(a.ld()),
-                                   util::blasToRocblasCast(b.ptr()), to_int(b.ld()));
+                                   util::blasToRocblasCast(b_ptr), to_int(b.ld()));
 #endif
 }
 
@@ -621,6 +665,7 @@ DLAF_MAKE_CALLABLE_OBJECT(lange);
 DLAF_MAKE_CALLABLE_OBJECT(lantr);
 DLAF_MAKE_CALLABLE_OBJECT(laset);
 DLAF_MAKE_CALLABLE_OBJECT(set0);
+DLAF_MAKE_CALLABLE_OBJECT(conjTranspose);
 DLAF_MAKE_CALLABLE_OBJECT(hegst);
 DLAF_MAKE_CALLABLE_OBJECT(potrf);
 DLAF_MAKE_CALLABLE_OBJECT(potrfInfo);
@@ -636,6 +681,8 @@ DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::Pl
                                      internal::laset_o)
 DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::Plain, set0,
                                      internal::set0_o)
+DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::Plain, conjTranspose,
+                                     internal::conjTranspose_o)
 DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::Lapack, hegst,
                                      internal::hegst_o)
 DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::Lapack, potrf,
@@ -14,6 +14,7 @@
 
 #include <blas.hh>
 
+#include <dlaf/blas/enum_output.h>
 #include <dlaf/common/assert.h>
 #include <dlaf/common/pipeline.h>
 #include <dlaf/communication/communicator_grid.h>
@@ -138,4 +139,135 @@ void generalSubMatrix(comm::CommunicatorGrid grid, const SizeType a, const SizeT
                             mat_c);
 }
 
+/// General matrix multiplication implementation on local memory, computing
+/// C = alpha * opA(A) * opB(B) + beta * C
+///
+/// @param  opA specifies the form of opA(A) to be used in the matrix multiplication:
+///         \a NoTrans, \a Trans, \a ConjTrans,
+/// @param  opB specifies the form of opB(B) to be used in the matrix multiplication:
+///         \a NoTrans, \a Trans, \a ConjTrans,
+/// @param  mat_a contains the input matrix A, accessed in read-only mode (elements are not modified)
+/// @param  mat_b contains the input matrix B, accessed in read-only mode (elements are not modified)
+/// @param  mat_c On entry it contains the input matrix C. On exit it is overwritten with the result.
+/// @pre mat_a, mat_b and mat_c have the same square block size,
+/// @pre mat_a, mat_b and mat_c are multipliable, i.e. opA(A) is (m x k), opB(B) is (k x n) and
+///      C is (m x n) (if k == 0, C = beta * C),
+/// @pre mat_a, mat_b and mat_c are not distributed.
+template <Backend B, Device D, class T>
+void generalMatrix(const blas::Op opA, const blas::Op opB, const T alpha, Matrix<const T, D>& mat_a,
+                   Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
+  DLAF_ASSERT(dlaf::matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(dlaf::matrix::square_blocksize(mat_b), mat_b);
+  DLAF_ASSERT(dlaf::matrix::square_blocksize(mat_c), mat_c);
+
+  DLAF_ASSERT(matrix::local_matrix(mat_a), mat_a);
+  DLAF_ASSERT(matrix::local_matrix(mat_b), mat_b);
+  DLAF_ASSERT(matrix::local_matrix(mat_c), mat_c);
+
+  DLAF_ASSERT(matrix::multipliable(mat_a, mat_b, mat_c, opA, opB), mat_a, mat_b, mat_c, opA, opB);
+
+  internal::General<B, D, T>::call(opA, opB, alpha, mat_a, mat_b, beta, mat_c);
+}
+
+/// General matrix distributed multiplication, computing
+/// C = alpha * opA(A) * opB(B) + beta * C
+///
+/// @param  opA specifies the form of opA(A) to be used in the matrix multiplication:
+///         \a NoTrans, \a Trans, \a ConjTrans,
+/// @param  opB specifies the form of opB(B) to be used in the matrix multiplication:
+///         \a NoTrans, \a Trans, \a ConjTrans,
+/// @param  mat_a contains the input matrix A, accessed in read-only mode (elements are not modified)
+/// @param  mat_b contains the input matrix B, accessed in read-only mode (elements are not modified)
+/// @param  mat_c On entry it contains the input matrix C. On exit it is overwritten with the result.
+/// @pre mat_a, mat_b and mat_c are distributed according to the grid, with the same source rank,
+/// @pre mat_a, mat_b and mat_c have the same square block size,
+/// @pre mat_a, mat_b and mat_c are multipliable, i.e. opA(A) is (m x k), opB(B) is (k x n) and
+///      C is (m x n) (if k == 0, C = beta * C).
+template <Backend B, Device D, class T>
+void generalMatrix([[maybe_unused]] comm::CommunicatorGrid grid,
+                   common::Pipeline<comm::Communicator>& row_task_chain,
+                   common::Pipeline<comm::Communicator>& col_task_chain, const blas::Op opA,
+                   const blas::Op opB, const T alpha, Matrix<const T, D>& mat_a,
+                   Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
+  DLAF_ASSERT(equal_process_grid(mat_a, grid), mat_a, grid);
+  DLAF_ASSERT(equal_process_grid(mat_b, grid), mat_b, grid);
+  DLAF_ASSERT(equal_process_grid(mat_c, grid), mat_c, grid);
+
+  DLAF_ASSERT(mat_a.distribution().sourceRankIndex() == mat_c.distribution().sourceRankIndex(),
+              mat_a, mat_c);
+  DLAF_ASSERT(mat_b.distribution().sourceRankIndex() == mat_c.distribution().sourceRankIndex(),
+              mat_b, mat_c);
+
+  DLAF_ASSERT(dlaf::matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(dlaf::matrix::square_blocksize(mat_b), mat_b);
+  DLAF_ASSERT(dlaf::matrix::square_blocksize(mat_c), mat_c);
+
+  DLAF_ASSERT(matrix::multipliable(mat_a, mat_b, mat_c, opA, opB), mat_a, mat_b, mat_c, opA, opB);
+
+  internal::General<B, D, T>::call(row_task_chain, col_task_chain, opA, opB, alpha, mat_a, mat_b, beta,
+                                   mat_c);
+}
+
+template <Backend B, Device D, class T>
+void generalMatrix(comm::CommunicatorGrid grid, const blas::Op opA, const blas::Op opB, const T alpha,
+                   Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
+                   Matrix<T, D>& mat_c) {
+  common::Pipeline<comm::Communicator> row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> col_task_chain(grid.colCommunicator().clone());
+  generalMatrix<B, D, T>(grid, row_task_chain, col_task_chain, opA, opB, alpha, mat_a, mat_b, beta,
+                         mat_c);
+}
+
+/// General matrix distributed multiplication with the communication-avoiding 2.5D algorithm, computing
+/// C = alpha * opA(A) * opB(B) + beta * C
+///
+/// The ranks are organized in c replicated layers (see comm::CommunicatorGridLayers), each one storing a
+/// replica of A, B and C distributed over its grid. Each layer computes with SUMMA the contribution of
+/// 1/c of the inner dimension, then the partial results are summed up across the layers, such that on
+/// exit each layer stores the result.
+/// Compared to SUMMA over a single grid with the same total number of ranks, it reduces the volume of
+/// data communicated by each rank by about sqrt(c), at the cost of c replicas of the matrices.
+///
+/// @param  layers contains the grid of the layer of this rank and the communicator between layers,
+/// @param  opA specifies the form of opA(A) to be used in the matrix multiplication:
+///         \a NoTrans, \a Trans, \a ConjTrans,
+/// @param  opB specifies the form of opB(B) to be used in the matrix multiplication:
+///         \a NoTrans, \a Trans, \a ConjTrans,
+/// @param  mat_a contains the input matrix A, accessed in read-only mode (elements are not modified)
+/// @param  mat_b contains the input matrix B, accessed in read-only mode (elements are not modified)
+/// @param  mat_c On entry it contains the input matrix C. On exit it is overwritten with the result.
+/// @pre mat_a, mat_b and mat_c are distributed according to layers.grid(), with the same source rank,
+/// @pre mat_a, mat_b and mat_c contain the same values on all the layers,
+/// @pre mat_a, mat_b and mat_c have the same square block size,
+/// @pre mat_a, mat_b and mat_c are multipliable, i.e. opA(A) is (m x k), opB(B) is (k x n) and
+///      C is (m x n) (if k == 0, C = beta * C).
+template <Backend B, Device D, class T>
+void generalMatrix(comm::CommunicatorGridLayers& layers, const blas::Op opA, const blas::Op opB,
+                   const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
+                   Matrix<T, D>& mat_c) {
+  auto& grid = layers.grid();
+
+  DLAF_ASSERT(equal_process_grid(mat_a, grid), mat_a, grid);
+  DLAF_ASSERT(equal_process_grid(mat_b, grid), mat_b, grid);
+  DLAF_ASSERT(equal_process_grid(mat_c, grid), mat_c, grid);
+
+  DLAF_ASSERT(mat_a.distribution().sourceRankIndex() == mat_c.distribution().sourceRankIndex(),
+              mat_a, mat_c);
+  DLAF_ASSERT(mat_b.distribution().sourceRankIndex() == mat_c.distribution().sourceRankIndex(),
+              mat_b, mat_c);
+
+  DLAF_ASSERT(dlaf::matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(dlaf::matrix::square_blocksize(mat_b), mat_b);
+  DLAF_ASSERT(dlaf::matrix::square_blocksize(mat_c), mat_c);
+
+  DLAF_ASSERT(matrix::multipliable(mat_a, mat_b, mat_c, opA, opB), mat_a, mat_b, mat_c, opA, opB);
+
+  common::Pipeline<comm::Communicator> row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> col_task_chain(grid.colCommunicator().clone());
+  common::Pipeline<comm::Communicator> layers_task_chain(layers.layersCommunicator().clone());
+
+  internal::General<B, D, T>::call(row_task_chain, col_task_chain, layers_task_chain, layers.layer(),
+                                   layers.nrLayers(), opA, opB, alpha, mat_a, mat_b, beta, mat_c);
+}
+
 }
@@ -30,9 +30,26 @@ struct GeneralSub {
                      Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c);
 };
 
+template <Backend B, Device D, class T>
+struct General {
+  static void call(const blas::Op opA, const blas::Op opB, const T alpha, Matrix<const T, D>& mat_a,
+                   Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c);
+  static void call(common::Pipeline<comm::Communicator>& row_task_chain,
+                   common::Pipeline<comm::Communicator>& col_task_chain, const blas::Op opA,
+                   const blas::Op opB, const T alpha, Matrix<const T, D>& mat_a,
+                   Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c);
+  static void call(common::Pipeline<comm::Communicator>& row_task_chain,
+                   common::Pipeline<comm::Communicator>& col_task_chain,
+                   common::Pipeline<comm::Communicator>& layers_task_chain,
+                   const comm::IndexT_MPI layer, const comm::IndexT_MPI nr_layers, const blas::Op opA,
+                   const blas::Op opB, const T alpha, Matrix<const T, D>& mat_a,
+                   Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c);
+};
+
 // ETI
 #define DLAF_MULTIPLICATION_GENERAL_ETI(KWORD, BACKEND, DEVICE, DATATYPE) \
-  KWORD template struct GeneralSub<BACKEND, DEVICE, DATATYPE>;
+  KWORD template struct GeneralSub<BACKEND, DEVICE, DATATYPE>;            \
+  KWORD template struct General<BACKEND, DEVICE, DATATYPE>;
 
 DLAF_MULTIPLICATION_GENERAL_ETI(extern, Backend::MC, Device::CPU, float)
 DLAF_MULTIPLICATION_GENERAL_ETI(extern, Backend::MC, Device::CPU, double)
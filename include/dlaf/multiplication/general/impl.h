@@ -10,18 +10,29 @@
 
 #pragma once
 
+#include <algorithm>
+
+#include <mpi.h>
+
+#include <pika/execution.hpp>
+
 #include <dlaf/blas/tile.h>
+#include <dlaf/blas/tile_extensions.h>
 #include <dlaf/common/assert.h>
 #include <dlaf/common/index2d.h>
 #include <dlaf/common/pipeline.h>
+#include <dlaf/common/range2d.h>
 #include <dlaf/common/round_robin.h>
 #include <dlaf/communication/broadcast_panel.h>
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/kernels/all_reduce.h>
 #include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/index.h>
 #include <dlaf/matrix/panel.h>
 #include <dlaf/multiplication/general/api.h>
 #include <dlaf/sender/when_all_lift.h>
+#include <dlaf/util_math.h>
+#include <dlaf/util_matrix.h>
 
 namespace dlaf::multiplication {
 namespace internal {
@@ -167,5 +178,265 @@ void GeneralSub<B, D, T>::callNN(common::Pipeline<comm::Communicator>& row_task_
     panelB.reset();
   }
 }
+
+// C = beta C, i.e. the result of the multiplication if the inner dimension k is 0.
+template <Backend B, Device D, class T>
+void scaleC(const T beta, Matrix<T, D>& mat_c) {
+  namespace ex = pika::execution::experimental;
+
+  for (const auto& ij : common::iterate_range2d(mat_c.distribution().localNrTiles()))
+    ex::start_detached(dlaf::internal::whenAllLift(beta, mat_c.readwrite(ij)) |
+                       tile::scal(dlaf::internal::Policy<B>()));
+}
+
+template <Backend B, Device D, class T>
+void General<B, D, T>::call(const blas::Op opA, const blas::Op opB, const T alpha,
+                            Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
+                            Matrix<T, D>& mat_c) {
+  namespace ex = pika::execution::experimental;
+
+  const SizeType k_tiles =
+      opA == blas::Op::NoTrans ? mat_a.nrTiles().cols() : mat_a.nrTiles().rows();
+
+  if (k_tiles == 0) {
+    scaleC<B>(beta, mat_c);
+    return;
+  }
+
+  for (SizeType j = 0; j < mat_c.nrTiles().cols(); ++j) {
+    for (SizeType i = 0; i < mat_c.nrTiles().rows(); ++i) {
+      for (SizeType k = 0; k < k_tiles; ++k) {
+        const GlobalTileIndex ik = opA == blas::Op::NoTrans ? GlobalTileIndex(i, k)
+                                                            : GlobalTileIndex(k, i);
+        const GlobalTileIndex kj = opB == blas::Op::NoTrans ? GlobalTileIndex(k, j)
+                                                            : GlobalTileIndex(j, k);
+        ex::start_detached(dlaf::internal::whenAllLift(opA, opB, alpha, mat_a.read(ik), mat_b.read(kj),
+                                                       k == 0 ? beta : T(1),
+                                                       mat_c.readwrite(GlobalTileIndex(i, j))) |
+                           tile::gemm(dlaf::internal::Policy<B>()));
+      }
+    }
+  }
+}
+
+// SUMMA (see GeneralSub::callNN) extended to rectangular matrices and transposed operands.
+//
+// At step k, the k-th tile column of op(A) and the k-th tile row of op(B) are made available to the
+// ranks storing the corresponding tile rows and cols of C:
+// - if the operand is not transposed, the panel is broadcasted from the grid col (row) owning it;
+// - otherwise, the k-th tile row of A (col of B) is broadcasted along the grid cols (rows) and then
+//   its tiles are "transposed" to the ranks that need them (see comm::broadcastTransposed). The
+//   tiles are not transposed, op is applied by the gemm.
+// Panels are double-buffered, such that the communication of the next step can overlap with the
+// update of the current one.
+// Just the steps in the range [k_tile_begin, k_tile_end) are performed, the first one applies beta.
+template <Backend B, Device D, class T>
+void summa(common::Pipeline<comm::Communicator>& row_task_chain,
+           common::Pipeline<comm::Communicator>& col_task_chain, const SizeType k_tile_begin,
+           const SizeType k_tile_end, const blas::Op opA, const blas::Op opB, const T alpha,
+           Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
+  namespace ex = pika::execution::experimental;
+  using blas::Op;
+  using matrix::Panel;
+  using matrix::StoreTransposed;
+
+  const auto& dist_a = mat_a.distribution();
+  const auto& dist_b = mat_b.distribution();
+  const auto& dist_c = mat_c.distribution();
+  const auto rank = dist_c.rankIndex();
+
+  const SizeType nb = dist_c.blockSize().rows();
+  const SizeType k = opA == Op::NoTrans ? dist_a.size().cols() : dist_a.size().rows();
+
+  // Note: workspaces are allocated just for the variants required by opA and opB.
+  constexpr std::size_t n_workspaces = 2;
+  const std::size_t n_workspaces_a = opA == Op::NoTrans ? n_workspaces : 0;
+  const std::size_t n_workspaces_at = opA == Op::NoTrans ? 0 : n_workspaces;
+  const std::size_t n_workspaces_b = opB == Op::NoTrans ? n_workspaces : 0;
+  const std::size_t n_workspaces_bt = opB == Op::NoTrans ? 0 : n_workspaces;
+
+  common::RoundRobin<Panel<Coord::Col, T, D>> panelsA(n_workspaces_a, dist_c);
+  common::RoundRobin<Panel<Coord::Row, T, D>> panelsAk(n_workspaces_at, dist_a);
+  common::RoundRobin<Panel<Coord::Col, T, D, StoreTransposed::Yes>> panelsAt(n_workspaces_at, dist_c);
+
+  common::RoundRobin<Panel<Coord::Row, T, D>> panelsB(n_workspaces_b, dist_c);
+  common::RoundRobin<Panel<Coord::Col, T, D>> panelsBk(n_workspaces_bt, dist_b);
+  common::RoundRobin<Panel<Coord::Row, T, D, StoreTransposed::Yes>> panelsBt(n_workspaces_bt, dist_c);
+
+  // This loops over the global indices for k, because every rank have to participate in communication
+  for (SizeType k_tile = k_tile_begin; k_tile < k_tile_end; ++k_tile) {
+    const SizeType kb = std::min(nb, k - k_tile * nb);
+
+    // k-th col of op(A)
+    if (opA == Op::NoTrans) {
+      auto& panelA = panelsA.nextResource();
+      panelA.setWidth(kb);
+
+      const auto rank_k = dist_a.template rankGlobalTile<Coord::Col>(k_tile);
+      if (rank.col() == rank_k) {
+        const auto k_local = dist_a.template localTileFromGlobalTile<Coord::Col>(k_tile);
+        for (const auto& idx : panelA.iteratorLocal())
+          panelA.setTile(idx, mat_a.read(LocalTileIndex(idx.row(), k_local)));
+      }
+      broadcast(rank_k, panelA, row_task_chain);
+    }
+    else {
+      auto& panelAk = panelsAk.nextResource();
+      auto& panelAt = panelsAt.nextResource();
+      panelAk.setHeight(kb);
+      panelAt.setWidth(kb);
+
+      const auto rank_k = dist_a.template rankGlobalTile<Coord::Row>(k_tile);
+      if (rank.row() == rank_k) {
+        const auto k_local = dist_a.template localTileFromGlobalTile<Coord::Row>(k_tile);
+        for (const auto& idx : panelAk.iteratorLocal())
+          panelAk.setTile(idx, mat_a.read(LocalTileIndex(k_local, idx.col())));
+      }
+      broadcast(rank_k, panelAk, col_task_chain);
+      comm::broadcastTransposed(panelAk, panelAt, row_task_chain);
+    }
+
+    // k-th row of op(B)
+    if (opB == Op::NoTrans) {
+      auto& panelB = panelsB.nextResource();
+      panelB.setHeight(kb);
+
+      const auto rank_k = dist_b.template rankGlobalTile<Coord::Row>(k_tile);
+      if (rank.row() == rank_k) {
+        const auto k_local = dist_b.template localTileFromGlobalTile<Coord::Row>(k_tile);
+        for (const auto& idx : panelB.iteratorLocal())
+          panelB.setTile(idx, mat_b.read(LocalTileIndex(k_local, idx.col())));
+      }
+      broadcast(rank_k, panelB, col_task_chain);
+    }
+    else {
+      auto& panelBk = panelsBk.nextResource();
+      auto& panelBt = panelsBt.nextResource();
+      panelBk.setWidth(kb);
+      panelBt.setHeight(kb);
+
+      const auto rank_k = dist_b.template rankGlobalTile<Coord::Col>(k_tile);
+      if (rank.col() == rank_k) {
+        const auto k_local = dist_b.template localTileFromGlobalTile<Coord::Col>(k_tile);
+        for (const auto& idx : panelBk.iteratorLocal())
+          panelBk.setTile(idx, mat_b.read(LocalTileIndex(idx.row(), k_local)));
+      }
+      broadcast(rank_k, panelBk, row_task_chain);
+      comm::broadcastTransposed(panelBk, panelBt, col_task_chain);
+    }
+
+    auto read_a = [&](const LocalTileIndex& ij) {
+      return opA == Op::NoTrans ? panelsA.currentResource().read(ij)
+                                : panelsAt.currentResource().read(ij);
+    };
+    auto read_b = [&](const LocalTileIndex& ij) {
+      return opB == Op::NoTrans ? panelsB.currentResource().read(ij)
+                                : panelsBt.currentResource().read(ij);
+    };
+
+    // This is the core loop where the k step performs the update over the entire local matrix using
+    // the col and row workspaces.
+    for (const auto& ij : common::iterate_range2d(dist_c.localNrTiles())) {
+      ex::start_detached(dlaf::internal::whenAllLift(opA, opB, alpha, read_a(ij), read_b(ij),
+                                                     k_tile == k_tile_begin ? beta : T(1),
+                                                     mat_c.readwrite(ij)) |
+                         tile::gemm(dlaf::internal::Policy<B>()));
+    }
+
+    if (opA == Op::NoTrans) {
+      panelsA.currentResource().reset();
+    }
+    else {
+      panelsAk.currentResource().reset();
+      panelsAt.currentResource().reset();
+    }
+
+    if (opB == Op::NoTrans) {
+      panelsB.currentResource().reset();
+    }
+    else {
+      panelsBk.currentResource().reset();
+      panelsBt.currentResource().reset();
+    }
+  }
+}
+
+template <Backend B, Device D, class T>
+void General<B, D, T>::call(common::Pipeline<comm::Communicator>& row_task_chain,
+                            common::Pipeline<comm::Communicator>& col_task_chain, const blas::Op opA,
+                            const blas::Op opB, const T alpha, Matrix<const T, D>& mat_a,
+                            Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
+  const auto& dist_c = mat_c.distribution();
+
+  if (dist_c.size().isEmpty())
+    return;
+
+  const SizeType nb = dist_c.blockSize().rows();
+  const SizeType k = opA == blas::Op::NoTrans ? mat_a.size().cols() : mat_a.size().rows();
+
+  if (k == 0) {
+    scaleC<B>(beta, mat_c);
+    return;
+  }
+
+  summa<B>(row_task_chain, col_task_chain, 0, util::ceilDiv(k, nb), opA, opB, alpha, mat_a, mat_b, beta,
+           mat_c);
+}
+
+// 2.5D algorithm, based on
+//
+// Solomonik, Edgar, and James Demmel.
+// Communication-optimal parallel 2.5D matrix multiplication and LU factorization algorithms.
+// Euro-Par 2011 Parallel Processing: 90-101
+//
+// Each layer stores a replica of the matrices and it computes, with SUMMA, the contribution of a
+// contiguous range of steps k, i.e. 1/nr_layers of the panels are communicated within each layer. The
+// partial results are then summed up across the layers, such that all of them get the result.
+template <Backend B, Device D, class T>
+void General<B, D, T>::call(common::Pipeline<comm::Communicator>& row_task_chain,
+                            common::Pipeline<comm::Communicator>& col_task_chain,
+                            common::Pipeline<comm::Communicator>& layers_task_chain,
+                            const comm::IndexT_MPI layer, const comm::IndexT_MPI nr_layers,
+                            const blas::Op opA, const blas::Op opB, const T alpha,
+                            Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
+                            Matrix<T, D>& mat_c) {
+  namespace ex = pika::execution::experimental;
+
+  const auto& dist_c = mat_c.distribution();
+
+  if (dist_c.size().isEmpty())
+    return;
+
+  const SizeType nb = dist_c.blockSize().rows();
+  const SizeType k = opA == blas::Op::NoTrans ? mat_a.size().cols() : mat_a.size().rows();
+  const SizeType k_tiles = util::ceilDiv(k, nb);
+
+  // Note: all the layers store the same C, hence no reduction is needed.
+  if (k == 0) {
+    scaleC<B>(beta, mat_c);
+    return;
+  }
+
+  // Note:
+  // The first layer gets the first range of steps, which is never empty, hence it is the one taking
+  // into account beta C. The others start from zero.
+  const SizeType k_tiles_layer = util::ceilDiv(k_tiles, SizeType{nr_layers});
+  const SizeType k_tile_begin = std::min(k_tiles, layer * k_tiles_layer);
+  const SizeType k_tile_end = std::min(k_tiles, k_tile_begin + k_tiles_layer);
+  const T beta_layer = layer == 0 ? beta : T(0);
+
+  if (k_tile_begin < k_tile_end)
+    summa<B>(row_task_chain, col_task_chain, k_tile_begin, k_tile_end, opA, opB, alpha, mat_a, mat_b,
+             beta_layer, mat_c);
+  else
+    matrix::util::set0<B>(pika::execution::thread_priority::normal, mat_c);
+
+  if (nr_layers == 1)
+    return;
+
+  for (const auto& ij : common::iterate_range2d(dist_c.localNrTiles()))
+    ex::start_detached(
+        comm::scheduleAllReduceInPlace(layers_task_chain(), MPI_SUM, mat_c.readwrite(ij)));
+}
 }
 }
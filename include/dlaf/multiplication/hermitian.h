@@ -54,7 +54,7 @@ void hermitian(blas::Side side, blas::Uplo uplo, const T alpha, Matrix<const T,
         return internal::Hermitian<B, D, T>::call_LL(alpha, mat_a, mat_b, beta, mat_c);
         break;
       case blas::Uplo::Upper:
-        DLAF_UNIMPLEMENTED(uplo);
+        return internal::Hermitian<B, D, T>::call_LU(alpha, mat_a, mat_b, beta, mat_c);
         break;
       case blas::Uplo::General:
         DLAF_UNIMPLEMENTED(uplo);
@@ -64,7 +64,17 @@ void hermitian(blas::Side side, blas::Uplo uplo, const T alpha, Matrix<const T,
   else {
     DLAF_ASSERT(matrix::multipliable(mat_b, mat_a, mat_c, blas::Op::NoTrans, blas::Op::NoTrans), mat_a,
                 mat_b, mat_c);
-    DLAF_UNIMPLEMENTED(side);
+    switch (uplo) {
+      case blas::Uplo::Lower:
+        return internal::Hermitian<B, D, T>::call_RL(alpha, mat_a, mat_b, beta, mat_c);
+        break;
+      case blas::Uplo::Upper:
+        return internal::Hermitian<B, D, T>::call_RU(alpha, mat_a, mat_b, beta, mat_c);
+        break;
+      case blas::Uplo::General:
+        DLAF_UNIMPLEMENTED(uplo);
+        break;
+    }
   }
 }
 
@@ -102,7 +112,7 @@ void hermitian(comm::CommunicatorGrid grid, blas::Side side, blas::Uplo uplo, co
         return internal::Hermitian<B, D, T>::call_LL(grid, alpha, mat_a, mat_b, beta, mat_c);
         break;
       case blas::Uplo::Upper:
-        DLAF_UNIMPLEMENTED(uplo);
+        return internal::Hermitian<B, D, T>::call_LU(grid, alpha, mat_a, mat_b, beta, mat_c);
         break;
       case blas::Uplo::General:
         DLAF_UNIMPLEMENTED(uplo);
@@ -112,7 +122,17 @@ void hermitian(comm::CommunicatorGrid grid, blas::Side side, blas::Uplo uplo, co
   else {
     DLAF_ASSERT(matrix::multipliable(mat_b, mat_a, mat_c, blas::Op::NoTrans, blas::Op::NoTrans), mat_a,
                 mat_b, mat_c);
-    DLAF_UNIMPLEMENTED(side);
+    switch (uplo) {
+      case blas::Uplo::Lower:
+        return internal::Hermitian<B, D, T>::call_RL(grid, alpha, mat_a, mat_b, beta, mat_c);
+        break;
+      case blas::Uplo::Upper:
+        return internal::Hermitian<B, D, T>::call_RU(grid, alpha, mat_a, mat_b, beta, mat_c);
+        break;
+      case blas::Uplo::General:
+        DLAF_UNIMPLEMENTED(uplo);
+        break;
+    }
   }
 }
 
@@ -18,8 +18,26 @@ struct Hermitian {
   static void call_LL(const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
                       Matrix<T, D>& mat_c);
 
+  static void call_LU(const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
+                      Matrix<T, D>& mat_c);
+
+  static void call_RL(const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
+                      Matrix<T, D>& mat_c);
+
+  static void call_RU(const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
+                      Matrix<T, D>& mat_c);
+
   static void call_LL(comm::CommunicatorGrid grid, const T alpha, Matrix<const T, D>& mat_a,
                       Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c);
+
+  static void call_LU(comm::CommunicatorGrid grid, const T alpha, Matrix<const T, D>& mat_a,
+                      Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c);
+
+  static void call_RL(comm::CommunicatorGrid grid, const T alpha, Matrix<const T, D>& mat_a,
+                      Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c);
+
+  static void call_RU(comm::CommunicatorGrid grid, const T alpha, Matrix<const T, D>& mat_a,
+                      Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c);
 };
 
 // ETI
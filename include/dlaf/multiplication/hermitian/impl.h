@@ -9,6 +9,8 @@
 //
 #pragma once
 
+#include <utility>
+
 #include <pika/execution.hpp>
 #include <pika/thread.hpp>
 
@@ -31,69 +33,95 @@
 
 namespace dlaf::multiplication::internal {
 
-namespace hermitian_ll {
+namespace hermitian {
 template <Backend B, class T, typename ASender, typename BSender, typename CSender>
-void hemm(const T alpha, ASender&& a_tile, BSender&& b_tile, const T beta, CSender&& c_tile) {
+void hemm(const blas::Side side, const blas::Uplo uplo, const T alpha, ASender&& a_tile,
+          BSender&& b_tile, const T beta, CSender&& c_tile) {
   pika::execution::experimental::start_detached(
-      dlaf::internal::whenAllLift(blas::Side::Left, blas::Uplo::Lower, alpha,
-                                  std::forward<ASender>(a_tile), std::forward<BSender>(b_tile), beta,
-                                  std::forward<CSender>(c_tile)) |
+      dlaf::internal::whenAllLift(side, uplo, alpha, std::forward<ASender>(a_tile),
+                                  std::forward<BSender>(b_tile), beta, std::forward<CSender>(c_tile)) |
       tile::hemm(dlaf::internal::Policy<B>(pika::execution::thread_priority::normal)));
 }
 
 template <Backend B, class T, typename ASender, typename BSender, typename CSender>
-void gemmN(const T alpha, ASender&& a_tile, BSender&& b_tile, const T beta, CSender&& c_tile) {
+void gemm(const blas::Op op_a, const blas::Op op_b, const T alpha, ASender&& a_tile, BSender&& b_tile,
+          const T beta, CSender&& c_tile) {
   pika::execution::experimental::start_detached(
-      dlaf::internal::whenAllLift(blas::Op::NoTrans, blas::Op::NoTrans, alpha,
-                                  std::forward<ASender>(a_tile), std::forward<BSender>(b_tile), beta,
-                                  std::forward<CSender>(c_tile)) |
+      dlaf::internal::whenAllLift(op_a, op_b, alpha, std::forward<ASender>(a_tile),
+                                  std::forward<BSender>(b_tile), beta, std::forward<CSender>(c_tile)) |
       tile::gemm(dlaf::internal::Policy<B>(pika::execution::thread_priority::normal)));
 }
 
-template <Backend B, class T, typename ASender, typename BSender, typename CSender>
-void gemmC(const T alpha, ASender&& a_tile, BSender&& b_tile, const T beta, CSender&& c_tile) {
+template <Backend B, class T, typename CPanelSender, typename CSender>
+void add(CPanelSender&& c_panel_tile, CSender&& c_tile) {
   pika::execution::experimental::start_detached(
-      dlaf::internal::whenAllLift(blas::Op::ConjTrans, blas::Op::NoTrans, alpha,
-                                  std::forward<ASender>(a_tile), std::forward<BSender>(b_tile), beta,
+      dlaf::internal::whenAllLift(T{1}, std::forward<CPanelSender>(c_panel_tile),
                                   std::forward<CSender>(c_tile)) |
-      tile::gemm(dlaf::internal::Policy<B>(pika::execution::thread_priority::normal)));
-}
+      tile::add(dlaf::internal::Policy<B>(pika::execution::thread_priority::high)));
 }
 
+// Just the tiles of the triangle uplo of A are accessed, the others are obtained by symmetry:
+// A_ij = A_ji^H (where i != j) is used by applying op = ConjTrans to A_ji.
 template <Backend B, Device D, class T>
-void Hermitian<B, D, T>::call_LL(const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b,
-                                 const T beta, Matrix<T, D>& mat_c) {
-  using namespace hermitian_ll;
+void callLocal(const blas::Side side, const blas::Uplo uplo, const T alpha, Matrix<const T, D>& mat_a,
+               Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
+  using blas::Op;
   const SizeType k = mat_a.distribution().localNrTiles().cols();
 
   for (const auto ij : common::iterate_range2d(mat_c.distribution().localNrTiles())) {
-    T beta_ij = beta;
-    for (SizeType l = 0; l < ij.row(); ++l) {
-      auto il = LocalTileIndex{ij.row(), l};
-      auto lj = LocalTileIndex{l, ij.col()};
-      gemmN<B>(alpha, mat_a.read(il), mat_b.read(lj), beta_ij, mat_c.readwrite(ij));
-      beta_ij = 1;
-    }
-
-    {
-      auto ii = LocalTileIndex{ij.row(), ij.row()};
-      hemm<B>(alpha, mat_a.read(ii), mat_b.read(ij), beta_ij, mat_c.readwrite(ij));
-      beta_ij = 1;
-    }
+    // C_ij = sum_l A_il B_lj (side == Left) or C_ij = sum_l B_il A_lj (side == Right)
+    const SizeType i_a = side == blas::Side::Left ? ij.row() : ij.col();
 
-    for (SizeType l = ij.row() + 1; l < k; ++l) {
-      auto li = LocalTileIndex{l, ij.row()};
-      auto lj = LocalTileIndex{l, ij.col()};
-      gemmC<B>(alpha, mat_a.read(li), mat_b.read(lj), beta_ij, mat_c.readwrite(ij));
+    T beta_ij = beta;
+    for (SizeType l = 0; l < k; ++l) {
+      if (l == i_a) {
+        auto ii = LocalTileIndex{i_a, i_a};
+        hemm<B>(side, uplo, alpha, mat_a.read(ii), mat_b.read(ij), beta_ij, mat_c.readwrite(ij));
+      }
+      else if (side == blas::Side::Left) {
+        // A_il is stored if it is in the uplo triangle, otherwise A_li is used.
+        const bool stored = (uplo == blas::Uplo::Lower) == (l < i_a);
+        auto a_idx = stored ? LocalTileIndex{i_a, l} : LocalTileIndex{l, i_a};
+        auto lj = LocalTileIndex{l, ij.col()};
+        gemm<B>(stored ? Op::NoTrans : Op::ConjTrans, Op::NoTrans, alpha, mat_a.read(a_idx),
+                mat_b.read(lj), beta_ij, mat_c.readwrite(ij));
+      }
+      else {
+        // A_lj is stored if it is in the uplo triangle, otherwise A_jl is used.
+        const bool stored = (uplo == blas::Uplo::Lower) == (l > i_a);
+        auto a_idx = stored ? LocalTileIndex{l, i_a} : LocalTileIndex{i_a, l};
+        auto il = LocalTileIndex{ij.row(), l};
+        gemm<B>(Op::NoTrans, stored ? Op::NoTrans : Op::ConjTrans, alpha, mat_b.read(il),
+                mat_a.read(a_idx), beta_ij, mat_c.readwrite(ij));
+      }
       beta_ij = 1;
     }
   }
 }
 
+// Range of the tiles of the l-th tile column of A which are stored in the uplo triangle, i.e.
+// [l, k) for the lower triangle and [0, l] for the upper one.
+inline std::pair<GlobalTileIndex, GlobalTileIndex> storedColRange(const blas::Uplo uplo,
+                                                                  const SizeType l, const SizeType k) {
+  if (uplo == blas::Uplo::Lower)
+    return {{l, l}, {k, k}};
+  return {{0, 0}, {l + 1, l + 1}};
+}
+
+// At step l the l-th tile column of A (just its tiles in the uplo triangle) is broadcasted, and it is
+// used for both the contributions of A_il (i != l) and of A_li = A_il^H, such that the tiles of the
+// other triangle are never needed:
+//   C_ij += A_il B_lj (for the rows i of the triangle, with the l-th tile row of B broadcasted)
+//   C_lj += A_il^H B_ij (partial results of the l-th tile row of C are reduced on its owner)
+//   C_lj += A_ll B_lj (hemm)
+//
+// The steps are performed in the order in which the first one updates all the tiles of C, i.e.
+// forward for the lower triangle and backward for the upper one, such that it can apply beta.
 template <Backend B, Device D, class T>
-void Hermitian<B, D, T>::call_LL(comm::CommunicatorGrid grid, const T alpha, Matrix<const T, D>& mat_a,
-                                 Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
-  using namespace hermitian_ll;
+void callLeft(comm::CommunicatorGrid& grid, const blas::Uplo uplo, const T alpha,
+              Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
+              Matrix<T, D>& mat_c) {
+  using blas::Op;
   namespace ex = pika::execution::experimental;
   using pika::execution::thread_priority;
 
@@ -117,25 +145,28 @@ void Hermitian<B, D, T>::call_LL(comm::CommunicatorGrid grid, const T alpha, Mat
   const SizeType m_loc = distr_c.localNrTiles().rows();
   const SizeType n_loc = distr_c.localNrTiles().cols();
   const SizeType k = distr_a.nrTiles().cols();
+  const bool is_lower = uplo == blas::Uplo::Lower;
   T beta_ = beta;
 
-  for (SizeType l = 0; l < k; ++l) {
+  for (SizeType step = 0; step < k; ++step) {
+    const SizeType l = is_lower ? step : k - 1 - step;
     const GlobalTileIndex ll{l, l};
-    const LocalTileIndex ll_offset{distr_a.nextLocalTileFromGlobalTile<Coord::Row>(ll.row()),
-                                   distr_a.nextLocalTileFromGlobalTile<Coord::Col>(ll.col())};
+    const SizeType l_loc_a = distr_a.nextLocalTileFromGlobalTile<Coord::Col>(ll.col());
 
     const SizeType l_loc = distr_c.nextLocalTileFromGlobalTile<Coord::Row>(ll.row());
     const SizeType l1_loc = distr_c.nextLocalTileFromGlobalTile<Coord::Row>(ll.row() + 1);
     const LocalTileIndex diag_offset(l_loc, 0);
     const LocalTileIndex diag_end_offset(l1_loc, n_loc);
-    const LocalTileIndex lower_offset(l1_loc, 0);
-    const LocalTileIndex lower_end_offset(m_loc, n_loc);
+    const LocalTileIndex tri_offset(is_lower ? l1_loc : 0, 0);
+    const LocalTileIndex tri_end_offset(is_lower ? m_loc : l_loc, n_loc);
+    const bool has_tri = is_lower ? l < k - 1 : l > 0;
 
     auto& a_panel = a_panels.nextResource();
     auto& b_panel = b_panels.nextResource();
     auto& c_panel = c_panels.nextResource();
 
-    a_panel.setRangeStart(ll);
+    const auto [a_start, a_end] = storedColRange(uplo, l, k);
+    a_panel.setRange(a_start, a_end);
 
     if (l == mat_a.nrTiles().rows() - 1) {
       a_panel.setWidth(mat_a.tileSize(ll).cols());
@@ -145,10 +176,8 @@ void Hermitian<B, D, T>::call_LL(comm::CommunicatorGrid grid, const T alpha, Mat
 
     const auto rank_ll = distr_a.rankGlobalTile(ll);
     if (this_rank.col() == rank_ll.col()) {
-      for (SizeType i_loc = ll_offset.row(); i_loc < distr_a.localNrTiles().rows(); ++i_loc) {
-        const LocalTileIndex il{i_loc, ll_offset.col()};
-        a_panel.setTile(il, mat_a.read(il));
-      }
+      for (const auto& idx : a_panel.iteratorLocal())
+        a_panel.setTile(idx, mat_a.read(LocalTileIndex{idx.row(), l_loc_a}));
     }
     comm::broadcast(rank_ll.col(), a_panel, mpi_row_task_chain);
 
@@ -161,20 +190,23 @@ void Hermitian<B, D, T>::call_LL(comm::CommunicatorGrid grid, const T alpha, Mat
     comm::broadcast(rank_ll.row(), b_panel, mpi_col_task_chain);
 
     for (const auto ij : common::iterate_range2d(diag_offset, diag_end_offset)) {
-      hemm<B>(alpha, a_panel.read(ij), b_panel.read(ij), beta_, mat_c.readwrite(ij));
+      hemm<B>(blas::Side::Left, uplo, alpha, a_panel.read(ij), b_panel.read(ij), beta_,
+              mat_c.readwrite(ij));
     }
 
-    if (l < k - 1) {
+    if (has_tri) {
       matrix::util::set0<B>(thread_priority::normal, c_panel);
       // Note: As A is square, B and C have the same size and blocksize
-      for (const auto ij : common::iterate_range2d(lower_offset, lower_end_offset)) {
+      for (const auto ij : common::iterate_range2d(tri_offset, tri_end_offset)) {
         // No Transpose part
-        // C_ij += A_ik * B_kj
-        gemmN<B>(alpha, a_panel.read(ij), b_panel.read(ij), beta_, mat_c.readwrite(ij));
+        // C_ij += A_il * B_lj
+        gemm<B>(Op::NoTrans, Op::NoTrans, alpha, a_panel.read(ij), b_panel.read(ij), beta_,
+                mat_c.readwrite(ij));
 
         // ConjTranspose part
-        // C_kj += (A_ik)^T * B_ij
-        gemmC<B>(alpha, a_panel.read(ij), mat_b.read(ij), T{1}, c_panel.readwrite(ij));
+        // C_lj += (A_il)^H * B_ij
+        gemm<B>(Op::ConjTrans, Op::NoTrans, alpha, a_panel.read(ij), mat_b.read(ij), T{1},
+                c_panel.readwrite(ij));
       }
 
       if (grid.colCommunicator().size() != 1) {
@@ -190,9 +222,7 @@ void Hermitian<B, D, T>::call_LL(comm::CommunicatorGrid grid, const T alpha, Mat
         }
       }
       for (const auto lj : common::iterate_range2d(diag_offset, diag_end_offset)) {
-        pika::execution::experimental::start_detached(
-            dlaf::internal::whenAllLift(T{1}, c_panel.read(lj), mat_c.readwrite(lj)) |
-            tile::add(dlaf::internal::Policy<B>(thread_priority::high)));
+        add<B, T>(c_panel.read(lj), mat_c.readwrite(lj));
       }
     }
 
@@ -205,4 +235,183 @@ void Hermitian<B, D, T>::call_LL(comm::CommunicatorGrid grid, const T alpha, Mat
   }
 }
 
+// Dual of callLeft: at step l the l-th tile column of A (just its tiles in the uplo triangle) is
+// broadcasted along the grid rows and "transposed" along the grid cols, such that each rank gets the
+// tiles A_jl for the tile columns j of C it stores:
+//   C_ij += B_il A_jl^H (for the cols j of the triangle, with the l-th tile column of B broadcasted)
+//   C_il += B_ij A_jl (partial results of the l-th tile column of C are reduced on its owner)
+//   C_il += B_il A_ll (hemm)
+template <Backend B, Device D, class T>
+void callRight(comm::CommunicatorGrid& grid, const blas::Uplo uplo, const T alpha,
+               Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b, const T beta,
+               Matrix<T, D>& mat_c) {
+  using blas::Op;
+  namespace ex = pika::execution::experimental;
+  using pika::execution::thread_priority;
+
+  const comm::Index2D this_rank = grid.rank();
+
+  const matrix::Distribution& distr_a = mat_a.distribution();
+  const matrix::Distribution& distr_b = mat_b.distribution();
+  const matrix::Distribution& distr_c = mat_c.distribution();
+
+  if (mat_b.size().isEmpty())
+    return;
+
+  common::Pipeline<comm::Communicator> mpi_row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_col_task_chain(grid.colCommunicator().clone());
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> a_panels(n_workspaces, distr_a);
+  common::RoundRobin<matrix::Panel<Coord::Row, T, D, matrix::StoreTransposed::Yes>> at_panels(
+      n_workspaces, distr_c);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> b_panels(n_workspaces, distr_b);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> c_panels(n_workspaces, distr_c);
+
+  const SizeType m_loc = distr_c.localNrTiles().rows();
+  const SizeType n_loc = distr_c.localNrTiles().cols();
+  const SizeType k = distr_a.nrTiles().cols();
+  const bool is_lower = uplo == blas::Uplo::Lower;
+  T beta_ = beta;
+
+  for (SizeType step = 0; step < k; ++step) {
+    const SizeType l = is_lower ? step : k - 1 - step;
+    const GlobalTileIndex ll{l, l};
+    const SizeType l_loc_a = distr_a.nextLocalTileFromGlobalTile<Coord::Col>(ll.col());
+    const SizeType l_loc_b = distr_b.nextLocalTileFromGlobalTile<Coord::Col>(ll.col());
+
+    const SizeType l_loc = distr_c.nextLocalTileFromGlobalTile<Coord::Col>(ll.col());
+    const SizeType l1_loc = distr_c.nextLocalTileFromGlobalTile<Coord::Col>(ll.col() + 1);
+    const LocalTileIndex diag_offset(0, l_loc);
+    const LocalTileIndex diag_end_offset(m_loc, l1_loc);
+    const LocalTileIndex tri_offset(0, is_lower ? l1_loc : 0);
+    const LocalTileIndex tri_end_offset(m_loc, is_lower ? n_loc : l_loc);
+    const bool has_tri = is_lower ? l < k - 1 : l > 0;
+
+    auto& a_panel = a_panels.nextResource();
+    auto& at_panel = at_panels.nextResource();
+    auto& b_panel = b_panels.nextResource();
+    auto& c_panel = c_panels.nextResource();
+
+    const auto [a_start, a_end] = storedColRange(uplo, l, k);
+    a_panel.setRange(a_start, a_end);
+    at_panel.setRange(a_start, a_end);
+
+    if (l == mat_a.nrTiles().rows() - 1) {
+      a_panel.setWidth(mat_a.tileSize(ll).cols());
+      at_panel.setHeight(mat_a.tileSize(ll).cols());
+      b_panel.setWidth(mat_a.tileSize(ll).cols());
+      c_panel.setWidth(mat_a.tileSize(ll).cols());
+    }
+
+    const auto rank_ll = distr_a.rankGlobalTile(ll);
+    if (this_rank.col() == rank_ll.col()) {
+      for (const auto& idx : a_panel.iteratorLocal())
+        a_panel.setTile(idx, mat_a.read(LocalTileIndex{idx.row(), l_loc_a}));
+    }
+    comm::broadcast(rank_ll.col(), a_panel, mpi_row_task_chain);
+    comm::broadcastTransposed(a_panel, at_panel, mpi_col_task_chain);
+
+    if (this_rank.col() == rank_ll.col()) {
+      for (const auto& idx : b_panel.iteratorLocal())
+        b_panel.setTile(idx, mat_b.read(LocalTileIndex{idx.row(), l_loc_b}));
+    }
+    comm::broadcast(rank_ll.col(), b_panel, mpi_row_task_chain);
+
+    for (const auto ij : common::iterate_range2d(diag_offset, diag_end_offset)) {
+      hemm<B>(blas::Side::Right, uplo, alpha, at_panel.read(ij), b_panel.read(ij), beta_,
+              mat_c.readwrite(ij));
+    }
+
+    if (has_tri) {
+      matrix::util::set0<B>(thread_priority::normal, c_panel);
+      // Note: As A is square, B and C have the same size and blocksize
+      for (const auto ij : common::iterate_range2d(tri_offset, tri_end_offset)) {
+        // ConjTranspose part
+        // C_ij += B_il * (A_jl)^H
+        gemm<B>(Op::NoTrans, Op::ConjTrans, alpha, b_panel.read(ij), at_panel.read(ij), beta_,
+                mat_c.readwrite(ij));
+
+        // No Transpose part
+        // C_il += B_ij * A_jl
+        gemm<B>(Op::NoTrans, Op::NoTrans, alpha, mat_b.read(ij), at_panel.read(ij), T{1},
+                c_panel.readwrite(ij));
+      }
+
+      if (grid.rowCommunicator().size() != 1) {
+        for (const auto& idx : c_panel.iteratorLocal()) {
+          if (this_rank.col() == rank_ll.col()) {
+            ex::start_detached(comm::scheduleReduceRecvInPlace(mpi_row_task_chain(), MPI_SUM,
+                                                               c_panel.readwrite(idx)));
+          }
+          else {
+            ex::start_detached(comm::scheduleReduceSend(mpi_row_task_chain(), rank_ll.col(), MPI_SUM,
+                                                        c_panel.read(idx)));
+          }
+        }
+      }
+      for (const auto il : common::iterate_range2d(diag_offset, diag_end_offset)) {
+        add<B, T>(c_panel.read(il), mat_c.readwrite(il));
+      }
+    }
+
+    // First iteration scales all the C tiles.
+    beta_ = T{1};
+
+    a_panel.reset();
+    at_panel.reset();
+    b_panel.reset();
+    c_panel.reset();
+  }
+}
+}
+
+template <Backend B, Device D, class T>
+void Hermitian<B, D, T>::call_LL(const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b,
+                                 const T beta, Matrix<T, D>& mat_c) {
+  hermitian::callLocal<B>(blas::Side::Left, blas::Uplo::Lower, alpha, mat_a, mat_b, beta, mat_c);
+}
+
+template <Backend B, Device D, class T>
+void Hermitian<B, D, T>::call_LU(const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b,
+                                 const T beta, Matrix<T, D>& mat_c) {
+  hermitian::callLocal<B>(blas::Side::Left, blas::Uplo::Upper, alpha, mat_a, mat_b, beta, mat_c);
+}
+
+template <Backend B, Device D, class T>
+void Hermitian<B, D, T>::call_RL(const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b,
+                                 const T beta, Matrix<T, D>& mat_c) {
+  hermitian::callLocal<B>(blas::Side::Right, blas::Uplo::Lower, alpha, mat_a, mat_b, beta, mat_c);
+}
+
+template <Backend B, Device D, class T>
+void Hermitian<B, D, T>::call_RU(const T alpha, Matrix<const T, D>& mat_a, Matrix<const T, D>& mat_b,
+                                 const T beta, Matrix<T, D>& mat_c) {
+  hermitian::callLocal<B>(blas::Side::Right, blas::Uplo::Upper, alpha, mat_a, mat_b, beta, mat_c);
+}
+
+template <Backend B, Device D, class T>
+void Hermitian<B, D, T>::call_LL(comm::CommunicatorGrid grid, const T alpha, Matrix<const T, D>& mat_a,
+                                 Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
+  hermitian::callLeft<B>(grid, blas::Uplo::Lower, alpha, mat_a, mat_b, beta, mat_c);
+}
+
+template <Backend B, Device D, class T>
+void Hermitian<B, D, T>::call_LU(comm::CommunicatorGrid grid, const T alpha, Matrix<const T, D>& mat_a,
+                                 Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
+  hermitian::callLeft<B>(grid, blas::Uplo::Upper, alpha, mat_a, mat_b, beta, mat_c);
+}
+
+template <Backend B, Device D, class T>
+void Hermitian<B, D, T>::call_RL(comm::CommunicatorGrid grid, const T alpha, Matrix<const T, D>& mat_a,
+                                 Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
+  hermitian::callRight<B>(grid, blas::Uplo::Lower, alpha, mat_a, mat_b, beta, mat_c);
+}
+
+template <Backend B, Device D, class T>
+void Hermitian<B, D, T>::call_RU(comm::CommunicatorGrid grid, const T alpha, Matrix<const T, D>& mat_a,
+                                 Matrix<const T, D>& mat_b, const T beta, Matrix<T, D>& mat_c) {
+  hermitian::callRight<B>(grid, blas::Uplo::Upper, alpha, mat_a, mat_b, beta, mat_c);
+}
+
 }
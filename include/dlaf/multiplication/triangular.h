@@ -122,8 +122,7 @@ void triangular(comm::CommunicatorGrid grid, blas::Side side, blas::Uplo uplo, b
         internal::Triangular<backend, device, T>::call_LLN(grid, diag, alpha, mat_a, mat_b);
       }
       else {
-        // Left Lower Trans/ConjTrans
-        DLAF_UNIMPLEMENTED(side, uplo, op, diag);
+        internal::Triangular<backend, device, T>::call_LLT(grid, op, diag, alpha, mat_a, mat_b);
       }
     }
     else {
@@ -131,8 +130,7 @@ void triangular(comm::CommunicatorGrid grid, blas::Side side, blas::Uplo uplo, b
         internal::Triangular<backend, device, T>::call_LUN(grid, diag, alpha, mat_a, mat_b);
       }
       else {
-        // Left Upper Trans/ConjTrans
-        DLAF_UNIMPLEMENTED(side, uplo, op, diag);
+        internal::Triangular<backend, device, T>::call_LUT(grid, op, diag, alpha, mat_a, mat_b);
       }
     }
   }
@@ -144,8 +142,7 @@ void triangular(comm::CommunicatorGrid grid, blas::Side side, blas::Uplo uplo, b
         internal::Triangular<backend, device, T>::call_RLN(grid, diag, alpha, mat_a, mat_b);
       }
       else {
-        // Right Lower Trans/ConjTrans
-        DLAF_UNIMPLEMENTED(side, uplo, op, diag);
+        internal::Triangular<backend, device, T>::call_RLT(grid, op, diag, alpha, mat_a, mat_b);
       }
     }
     else {
@@ -153,8 +150,7 @@ void triangular(comm::CommunicatorGrid grid, blas::Side side, blas::Uplo uplo, b
         internal::Triangular<backend, device, T>::call_RUN(grid, diag, alpha, mat_a, mat_b);
       }
       else {
-        // Right Upper Trans/ConjTrans
-        DLAF_UNIMPLEMENTED(side, uplo, op, diag);
+        internal::Triangular<backend, device, T>::call_RUT(grid, op, diag, alpha, mat_a, mat_b);
       }
     }
   }
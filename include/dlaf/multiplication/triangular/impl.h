@@ -722,6 +722,372 @@ void Triangular<backend, device, T>::call_RUN(comm::CommunicatorGrid grid, blas:
   }
 }
 
+template <Backend backend, Device device, class T>
+void Triangular<backend, device, T>::call_LLT(comm::CommunicatorGrid grid, blas::Op op, blas::Diag diag,
+                                              T alpha, Matrix<const T, device>& mat_a,
+                                              Matrix<T, device>& mat_b) {
+  using namespace triangular_llt;
+  using pika::execution::thread_priority;
+
+  // Set up MPI executor pipelines
+  common::Pipeline<comm::Communicator> mpi_row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_col_task_chain(grid.colCommunicator().clone());
+
+  const comm::Index2D this_rank = grid.rank();
+
+  const matrix::Distribution& distr_a = mat_a.distribution();
+  const matrix::Distribution& distr_b = mat_b.distribution();
+
+  if (mat_b.size().isEmpty())
+    return;
+
+  // Note:
+  // The k-th tile row of A is broadcasted along the grid cols and then its tiles are "transposed" to
+  // the ranks storing the corresponding tile rows of B, such that op(A_ki) is available where B_ij is
+  // updated (op is applied by the kernels, i.e. A is not explicitly transposed).
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device>> a_panels(n_workspaces, distr_a);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device, matrix::StoreTransposed::Yes>> at_panels(
+      n_workspaces, distr_b);
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device>> b_panels(n_workspaces, distr_b);
+
+  const SizeType nrtiles = mat_a.nrTiles().rows();
+
+  for (SizeType k = 0; k < nrtiles; ++k) {
+    const GlobalTileIndex kk(k, k);
+    auto kk_rank = distr_a.rankGlobalTile(kk);
+
+    const LocalTileIndex kk_offset{
+        distr_a.nextLocalTileFromGlobalTile<Coord::Row>(k),
+        distr_a.nextLocalTileFromGlobalTile<Coord::Col>(k),
+    };
+
+    const LocalTileIndex bt_offset{distr_b.nextLocalTileFromGlobalTile<Coord::Row>(k), 0};
+
+    auto& a_panel = a_panels.nextResource();
+    auto& at_panel = at_panels.nextResource();
+    auto& b_panel = b_panels.nextResource();
+    a_panel.setRange({0, 0}, {k + 1, k + 1});
+    at_panel.setRange({0, 0}, {k + 1, k + 1});
+    if (k == nrtiles - 1) {
+      a_panel.setHeight(mat_a.tileSize(kk).rows());
+      at_panel.setWidth(mat_a.tileSize(kk).rows());
+      b_panel.setHeight(mat_a.tileSize(kk).cols());
+    }
+
+    if (kk_rank.row() == this_rank.row()) {
+      for (const auto& kj_panel : a_panel.iteratorLocal()) {
+        const LocalTileIndex kj(kk_offset.row(), kj_panel.col());
+        a_panel.setTile(kj_panel, mat_a.read(kj));
+      }
+    }
+    broadcast(kk_rank.row(), a_panel, mpi_col_task_chain);
+    broadcastTransposed(a_panel, at_panel, mpi_row_task_chain);
+
+    for (SizeType j_local = 0; j_local < distr_b.localNrTiles().cols(); ++j_local) {
+      if (kk_rank.row() == this_rank.row()) {
+        auto k_local_row = distr_b.localTileFromGlobalTile<Coord::Row>(k);
+        const LocalTileIndex kk_panel(Coord::Row, k_local_row);
+        const LocalTileIndex kj(k_local_row, j_local);
+        const LocalTileIndex kj_panel(Coord::Col, j_local);
+
+        b_panel.setTile(kj_panel, mat_b.read(kj));
+        trmmBPanelTile<backend>(thread_priority::high, op, diag, alpha, at_panel.read(kk_panel),
+                                mat_b.readwrite(kj));
+      }
+    }
+    broadcast(kk_rank.row(), b_panel, mpi_col_task_chain);
+
+    for (SizeType i_local = bt_offset.row() - 1; i_local >= 0; --i_local) {
+      const LocalTileIndex ik_panel(Coord::Row, i_local);
+      // Update trailing matrix
+      for (SizeType j_local = 0; j_local < distr_b.localNrTiles().cols(); ++j_local) {
+        const LocalTileIndex kj_panel(Coord::Col, j_local);
+        const LocalTileIndex ij(i_local, j_local);
+        gemmTrailingMatrixTile<backend>(thread_priority::normal, op, alpha, at_panel.read(ik_panel),
+                                        b_panel.read(kj_panel), mat_b.readwrite(ij));
+      }
+    }
+
+    a_panel.reset();
+    at_panel.reset();
+    b_panel.reset();
+  }
+}
+
+template <Backend backend, Device device, class T>
+void Triangular<backend, device, T>::call_LUT(comm::CommunicatorGrid grid, blas::Op op, blas::Diag diag,
+                                              T alpha, Matrix<const T, device>& mat_a,
+                                              Matrix<T, device>& mat_b) {
+  using namespace triangular_lut;
+  using pika::execution::thread_priority;
+
+  // Set up MPI executor pipelines
+  common::Pipeline<comm::Communicator> mpi_row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_col_task_chain(grid.colCommunicator().clone());
+
+  const comm::Index2D this_rank = grid.rank();
+
+  const matrix::Distribution& distr_a = mat_a.distribution();
+  const matrix::Distribution& distr_b = mat_b.distribution();
+
+  if (mat_b.size().isEmpty())
+    return;
+
+  // Note: the tiles of A are made available as in call_LLT.
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device>> a_panels(n_workspaces, distr_a);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device, matrix::StoreTransposed::Yes>> at_panels(
+      n_workspaces, distr_b);
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device>> b_panels(n_workspaces, distr_b);
+
+  const SizeType nrtiles = mat_a.nrTiles().rows();
+
+  for (SizeType k = nrtiles - 1; k >= 0; --k) {
+    const GlobalTileIndex kk(k, k);
+    auto kk_rank = distr_a.rankGlobalTile(kk);
+
+    const LocalTileIndex kk_offset{
+        distr_a.nextLocalTileFromGlobalTile<Coord::Row>(k),
+        distr_a.nextLocalTileFromGlobalTile<Coord::Col>(k),
+    };
+
+    const LocalTileIndex bt_offset{distr_b.nextLocalTileFromGlobalTile<Coord::Row>(k + 1), 0};
+
+    auto& a_panel = a_panels.nextResource();
+    auto& at_panel = at_panels.nextResource();
+    auto& b_panel = b_panels.nextResource();
+    a_panel.setRange(kk, {nrtiles, nrtiles});
+    at_panel.setRange(kk, {nrtiles, nrtiles});
+    if (k == nrtiles - 1) {
+      a_panel.setHeight(mat_a.tileSize(kk).rows());
+      at_panel.setWidth(mat_a.tileSize(kk).rows());
+      b_panel.setHeight(mat_a.tileSize(kk).cols());
+    }
+
+    if (kk_rank.row() == this_rank.row()) {
+      for (const auto& kj_panel : a_panel.iteratorLocal()) {
+        const LocalTileIndex kj(kk_offset.row(), kj_panel.col());
+        a_panel.setTile(kj_panel, mat_a.read(kj));
+      }
+    }
+    broadcast(kk_rank.row(), a_panel, mpi_col_task_chain);
+    broadcastTransposed(a_panel, at_panel, mpi_row_task_chain);
+
+    for (SizeType j_local = 0; j_local < distr_b.localNrTiles().cols(); ++j_local) {
+      if (kk_rank.row() == this_rank.row()) {
+        auto k_local_row = distr_b.localTileFromGlobalTile<Coord::Row>(k);
+        const LocalTileIndex kk_panel(Coord::Row, k_local_row);
+        const LocalTileIndex kj(k_local_row, j_local);
+        const LocalTileIndex kj_panel(Coord::Col, j_local);
+
+        b_panel.setTile(kj_panel, mat_b.read(kj));
+        trmmBPanelTile<backend>(thread_priority::high, op, diag, alpha, at_panel.read(kk_panel),
+                                mat_b.readwrite(kj));
+      }
+    }
+    broadcast(kk_rank.row(), b_panel, mpi_col_task_chain);
+
+    for (SizeType i_local = bt_offset.row(); i_local < distr_b.localNrTiles().rows(); ++i_local) {
+      const LocalTileIndex ik_panel(Coord::Row, i_local);
+      // Update trailing matrix
+      for (SizeType j_local = 0; j_local < distr_b.localNrTiles().cols(); ++j_local) {
+        const LocalTileIndex kj_panel(Coord::Col, j_local);
+        const LocalTileIndex ij(i_local, j_local);
+        gemmTrailingMatrixTile<backend>(thread_priority::normal, op, alpha, at_panel.read(ik_panel),
+                                        b_panel.read(kj_panel), mat_b.readwrite(ij));
+      }
+    }
+
+    a_panel.reset();
+    at_panel.reset();
+    b_panel.reset();
+  }
+}
+
+template <Backend backend, Device device, class T>
+void Triangular<backend, device, T>::call_RLT(comm::CommunicatorGrid grid, blas::Op op, blas::Diag diag,
+                                              T alpha, Matrix<const T, device>& mat_a,
+                                              Matrix<T, device>& mat_b) {
+  using namespace triangular_rlt;
+  using pika::execution::thread_priority;
+
+  // Set up MPI executor pipelines
+  common::Pipeline<comm::Communicator> mpi_row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_col_task_chain(grid.colCommunicator().clone());
+
+  const comm::Index2D this_rank = grid.rank();
+
+  const matrix::Distribution& distr_a = mat_a.distribution();
+  const matrix::Distribution& distr_b = mat_b.distribution();
+
+  if (mat_b.size().isEmpty())
+    return;
+
+  // Note:
+  // The k-th tile column of A is broadcasted along the grid rows and then its tiles are "transposed"
+  // to the ranks storing the corresponding tile columns of B, such that op(A_jk) is available where
+  // B_ij is updated (op is applied by the kernels, i.e. A is not explicitly transposed).
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device>> a_panels(n_workspaces, distr_a);
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device, matrix::StoreTransposed::Yes>> at_panels(
+      n_workspaces, distr_b);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device>> b_panels(n_workspaces, distr_b);
+
+  const SizeType nrtiles = mat_a.nrTiles().cols();
+
+  for (SizeType k = nrtiles - 1; k >= 0; --k) {
+    const GlobalTileIndex kk(k, k);
+    auto kk_rank = distr_a.rankGlobalTile(kk);
+
+    const LocalTileIndex kk_offset{
+        distr_a.nextLocalTileFromGlobalTile<Coord::Row>(k),
+        distr_a.nextLocalTileFromGlobalTile<Coord::Col>(k),
+    };
+
+    const LocalTileIndex bt_offset{0, distr_b.nextLocalTileFromGlobalTile<Coord::Col>(k + 1)};
+
+    auto& a_panel = a_panels.nextResource();
+    auto& at_panel = at_panels.nextResource();
+    auto& b_panel = b_panels.nextResource();
+    a_panel.setRange(kk, {nrtiles, nrtiles});
+    at_panel.setRange(kk, {nrtiles, nrtiles});
+    if (k == nrtiles - 1) {
+      a_panel.setWidth(mat_a.tileSize(kk).cols());
+      at_panel.setHeight(mat_a.tileSize(kk).cols());
+      b_panel.setWidth(mat_a.tileSize(kk).rows());
+    }
+
+    if (kk_rank.col() == this_rank.col()) {
+      for (const auto& ik_panel : a_panel.iteratorLocal()) {
+        const LocalTileIndex ik(ik_panel.row(), kk_offset.col());
+        a_panel.setTile(ik_panel, mat_a.read(ik));
+      }
+    }
+    broadcast(kk_rank.col(), a_panel, mpi_row_task_chain);
+    broadcastTransposed(a_panel, at_panel, mpi_col_task_chain);
+
+    for (SizeType i_local = distr_b.localNrTiles().rows() - 1; i_local >= 0; --i_local) {
+      if (kk_rank.col() == this_rank.col()) {
+        auto k_local_col = distr_b.localTileFromGlobalTile<Coord::Col>(k);
+        const LocalTileIndex kk_panel(Coord::Col, k_local_col);
+        const LocalTileIndex ik(i_local, k_local_col);
+        const LocalTileIndex ik_panel(Coord::Row, i_local);
+
+        b_panel.setTile(ik_panel, mat_b.read(ik));
+        trmmBPanelTile<backend>(thread_priority::high, op, diag, alpha, at_panel.read(kk_panel),
+                                mat_b.readwrite(ik));
+      }
+    }
+    broadcast(kk_rank.col(), b_panel, mpi_row_task_chain);
+
+    for (SizeType j_local = bt_offset.col(); j_local < distr_b.localNrTiles().cols(); ++j_local) {
+      const LocalTileIndex kj_panel(Coord::Col, j_local);
+      // Update trailing matrix
+      for (SizeType i_local = distr_b.localNrTiles().rows() - 1; i_local >= 0; --i_local) {
+        const LocalTileIndex ik_panel(Coord::Row, i_local);
+        const LocalTileIndex ij(i_local, j_local);
+        gemmTrailingMatrixTile<backend>(thread_priority::normal, op, alpha, b_panel.read(ik_panel),
+                                        at_panel.read(kj_panel), mat_b.readwrite(ij));
+      }
+    }
+
+    a_panel.reset();
+    at_panel.reset();
+    b_panel.reset();
+  }
+}
+
+template <Backend backend, Device device, class T>
+void Triangular<backend, device, T>::call_RUT(comm::CommunicatorGrid grid, blas::Op op, blas::Diag diag,
+                                              T alpha, Matrix<const T, device>& mat_a,
+                                              Matrix<T, device>& mat_b) {
+  using namespace triangular_rut;
+  using pika::execution::thread_priority;
+
+  // Set up MPI executor pipelines
+  common::Pipeline<comm::Communicator> mpi_row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_col_task_chain(grid.colCommunicator().clone());
+
+  const comm::Index2D this_rank = grid.rank();
+
+  const matrix::Distribution& distr_a = mat_a.distribution();
+  const matrix::Distribution& distr_b = mat_b.distribution();
+
+  if (mat_b.size().isEmpty())
+    return;
+
+  // Note: the tiles of A are made available as in call_RLT.
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device>> a_panels(n_workspaces, distr_a);
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device, matrix::StoreTransposed::Yes>> at_panels(
+      n_workspaces, distr_b);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device>> b_panels(n_workspaces, distr_b);
+
+  const SizeType nrtiles = mat_a.nrTiles().cols();
+
+  for (SizeType k = 0; k < nrtiles; ++k) {
+    const GlobalTileIndex kk(k, k);
+    auto kk_rank = distr_a.rankGlobalTile(kk);
+
+    const LocalTileIndex kk_offset{
+        distr_a.nextLocalTileFromGlobalTile<Coord::Row>(k),
+        distr_a.nextLocalTileFromGlobalTile<Coord::Col>(k),
+    };
+
+    const LocalTileIndex bt_offset{0, distr_b.nextLocalTileFromGlobalTile<Coord::Col>(k)};
+
+    auto& a_panel = a_panels.nextResource();
+    auto& at_panel = at_panels.nextResource();
+    auto& b_panel = b_panels.nextResource();
+    a_panel.setRange({0, 0}, {k + 1, k + 1});
+    at_panel.setRange({0, 0}, {k + 1, k + 1});
+    if (k == nrtiles - 1) {
+      a_panel.setWidth(mat_a.tileSize(kk).cols());
+      at_panel.setHeight(mat_a.tileSize(kk).cols());
+      b_panel.setWidth(mat_a.tileSize(kk).rows());
+    }
+
+    if (kk_rank.col() == this_rank.col()) {
+      for (const auto& ik_panel : a_panel.iteratorLocal()) {
+        const LocalTileIndex ik(ik_panel.row(), kk_offset.col());
+        a_panel.setTile(ik_panel, mat_a.read(ik));
+      }
+    }
+    broadcast(kk_rank.col(), a_panel, mpi_row_task_chain);
+    broadcastTransposed(a_panel, at_panel, mpi_col_task_chain);
+
+    for (SizeType i_local = 0; i_local < distr_b.localNrTiles().rows(); ++i_local) {
+      if (kk_rank.col() == this_rank.col()) {
+        auto k_local_col = distr_b.localTileFromGlobalTile<Coord::Col>(k);
+        const LocalTileIndex kk_panel(Coord::Col, k_local_col);
+        const LocalTileIndex ik(i_local, k_local_col);
+        const LocalTileIndex ik_panel(Coord::Row, i_local);
+
+        b_panel.setTile(ik_panel, mat_b.read(ik));
+        trmmBPanelTile<backend>(thread_priority::high, op, diag, alpha, at_panel.read(kk_panel),
+                                mat_b.readwrite(ik));
+      }
+    }
+    broadcast(kk_rank.col(), b_panel, mpi_row_task_chain);
+
+    for (SizeType j_local = bt_offset.col() - 1; j_local >= 0; --j_local) {
+      const LocalTileIndex kj_panel(Coord::Col, j_local);
+      // Update trailing matrix
+      for (SizeType i_local = 0; i_local < distr_b.localNrTiles().rows(); ++i_local) {
+        const LocalTileIndex ik_panel(Coord::Row, i_local);
+        const LocalTileIndex ij(i_local, j_local);
+        gemmTrailingMatrixTile<backend>(thread_priority::normal, op, alpha, b_panel.read(ik_panel),
+                                        at_panel.read(kj_panel), mat_b.readwrite(ij));
+      }
+    }
+
+    a_panel.reset();
+    at_panel.reset();
+    b_panel.reset();
+  }
+}
+
 }
 }
 }
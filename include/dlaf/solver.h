@@ -11,4 +11,5 @@
 
 /// @file
 
+#include <dlaf/solver/cholesky.h>
 #include <dlaf/solver/triangular.h>
@@ -0,0 +1,100 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+/// @file
+
+#include <blas.hh>
+
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/solver/cholesky/api.h>
+#include <dlaf/types.h>
+#include <dlaf/util_matrix.h>
+
+namespace dlaf {
+namespace solver {
+
+/// Cholesky solver implementation on local memory, solving A X = B, where A is an Hermitian positive
+/// definite matrix.
+///
+/// The Cholesky factorization of A (A = L L^H or A = U^H U) and the forward and backward substitutions
+/// are executed as a single task graph, i.e. the substitutions start as soon as the needed tiles of the
+/// factor are available.
+///
+/// @param uplo specifies if the elements of the Hermitian matrix to be referenced are the elements in
+/// the lower or upper triangular part,
+/// @param mat_a on entry it contains the Hermitian matrix A, on exit the matrix elements are
+/// overwritten with the elements of the Cholesky factor. Only the tiles of the matrix which contain the
+/// upper or the lower triangular part (depending on the value of uplo) are accessed,
+/// @param mat_b on entry it contains the matrix B, on exit the matrix elements are overwritten with the
+/// elements of the matrix X,
+/// @pre mat_a has a square size,
+/// @pre mat_a has a square block size,
+/// @pre mat_a and mat_b are not distributed,
+/// @pre mat_a and mat_b are multipliable.
+template <Backend backend, Device device, class T>
+void cholesky(blas::Uplo uplo, Matrix<T, device>& mat_a, Matrix<T, device>& mat_b) {
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(matrix::local_matrix(mat_a), mat_a);
+  DLAF_ASSERT(matrix::local_matrix(mat_b), mat_b);
+  DLAF_ASSERT(matrix::multipliable(mat_a, mat_b, mat_b, blas::Op::NoTrans, blas::Op::NoTrans), mat_a,
+              mat_b);
+
+  if (uplo == blas::Uplo::Lower)
+    internal::Cholesky<backend, device, T>::call_L(mat_a, mat_b);
+  else
+    internal::Cholesky<backend, device, T>::call_U(mat_a, mat_b);
+}
+
+/// Cholesky solver implementation on distributed memory, solving A X = B, where A is an Hermitian
+/// positive definite matrix.
+///
+/// The Cholesky factorization of A (A = L L^H or A = U^H U) and the forward and backward substitutions
+/// are executed as a single task graph, i.e. the substitutions start as soon as the needed tiles of the
+/// factor are available, and the panels of the factor communicated during the factorization are reused
+/// by the forward substitution. By default the backward substitution communicates them again; if the
+/// tune parameter cholesky_solver_keep_panels is set they are kept instead (see its memory cost in
+/// tune.h).
+///
+/// @param grid is the communicator grid on which the matrices A and B have been distributed,
+/// @param uplo specifies if the elements of the Hermitian matrix to be referenced are the elements in
+/// the lower or upper triangular part,
+/// @param mat_a on entry it contains the Hermitian matrix A, on exit the matrix elements are
+/// overwritten with the elements of the Cholesky factor. Only the tiles of the matrix which contain the
+/// upper or the lower triangular part (depending on the value of uplo) are accessed,
+/// @param mat_b on entry it contains the matrix B, on exit the matrix elements are overwritten with the
+/// elements of the matrix X,
+/// @pre mat_a has a square size,
+/// @pre mat_a has a square block size,
+/// @pre mat_a and mat_b are distributed according to the grid,
+/// @pre mat_a and mat_b have the same source rank,
+/// @pre mat_a and mat_b are multipliable.
+template <Backend backend, Device device, class T>
+void cholesky(comm::CommunicatorGrid grid, blas::Uplo uplo, Matrix<T, device>& mat_a,
+              Matrix<T, device>& mat_b) {
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_blocksize(mat_a), mat_a);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_a, grid), mat_a, grid);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_b, grid), mat_b, grid);
+  DLAF_ASSERT(mat_a.distribution().sourceRankIndex() == mat_b.distribution().sourceRankIndex(), mat_a,
+              mat_b);
+  DLAF_ASSERT(matrix::multipliable(mat_a, mat_b, mat_b, blas::Op::NoTrans, blas::Op::NoTrans), mat_a,
+              mat_b);
+
+  if (uplo == blas::Uplo::Lower)
+    internal::Cholesky<backend, device, T>::call_L(grid, mat_a, mat_b);
+  else
+    internal::Cholesky<backend, device, T>::call_U(grid, mat_a, mat_b);
+}
+
+}
+}
@@ -0,0 +1,46 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/types.h>
+
+namespace dlaf {
+namespace solver {
+namespace internal {
+template <Backend backend, Device device, class T>
+struct Cholesky {
+  static void call_L(Matrix<T, device>& mat_a, Matrix<T, device>& mat_b);
+  static void call_U(Matrix<T, device>& mat_a, Matrix<T, device>& mat_b);
+  static void call_L(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a,
+                     Matrix<T, device>& mat_b);
+  static void call_U(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a,
+                     Matrix<T, device>& mat_b);
+};
+
+// ETI
+#define DLAF_SOLVER_CHOLESKY_ETI(KWORD, BACKEND, DEVICE, DATATYPE) \
+  KWORD template struct Cholesky<BACKEND, DEVICE, DATATYPE>;
+
+DLAF_SOLVER_CHOLESKY_ETI(extern, Backend::MC, Device::CPU, float)
+DLAF_SOLVER_CHOLESKY_ETI(extern, Backend::MC, Device::CPU, double)
+DLAF_SOLVER_CHOLESKY_ETI(extern, Backend::MC, Device::CPU, std::complex<float>)
+DLAF_SOLVER_CHOLESKY_ETI(extern, Backend::MC, Device::CPU, std::complex<double>)
+
+#ifdef DLAF_WITH_GPU
+DLAF_SOLVER_CHOLESKY_ETI(extern, Backend::GPU, Device::GPU, float)
+DLAF_SOLVER_CHOLESKY_ETI(extern, Backend::GPU, Device::GPU, double)
+DLAF_SOLVER_CHOLESKY_ETI(extern, Backend::GPU, Device::GPU, std::complex<float>)
+DLAF_SOLVER_CHOLESKY_ETI(extern, Backend::GPU, Device::GPU, std::complex<double>)
+#endif
+}
+}
+}
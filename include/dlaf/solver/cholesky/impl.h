@@ -0,0 +1,715 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <pika/execution.hpp>
+#include <pika/thread.hpp>
+
+#include <dlaf/blas/tile.h>
+#include <dlaf/blas/tile_extensions.h>
+#include <dlaf/common/index2d.h>
+#include <dlaf/common/pipeline.h>
+#include <dlaf/common/round_robin.h>
+#include <dlaf/communication/broadcast_panel.h>
+#include <dlaf/communication/communicator.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/kernels.h>
+#include <dlaf/factorization/cholesky/impl.h>
+#include <dlaf/lapack/tile.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/index.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/panel.h>
+#include <dlaf/matrix/tile.h>
+#include <dlaf/sender/traits.h>
+#include <dlaf/sender/when_all_lift.h>
+#include <dlaf/solver/cholesky/api.h>
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
+#include <dlaf/util_matrix.h>
+
+namespace dlaf {
+namespace solver {
+namespace internal {
+
+namespace cholesky_solver {
+template <Backend backend, class KKTileSender, class BTileSender>
+void trsmBTile(pika::execution::thread_priority priority, blas::Uplo uplo, blas::Op op,
+               KKTileSender&& kk_tile, BTileSender&& b_tile) {
+  using ElementType = dlaf::internal::SenderElementType<KKTileSender>;
+
+  pika::execution::experimental::start_detached(
+      dlaf::internal::whenAllLift(blas::Side::Left, uplo, op, blas::Diag::NonUnit, ElementType(1.0),
+                                  std::forward<KKTileSender>(kk_tile),
+                                  std::forward<BTileSender>(b_tile)) |
+      tile::trsm(dlaf::internal::Policy<backend>(priority)));
+}
+
+// C -= op(A) B
+template <Backend backend, class ATileSender, class BTileSender, class CTileSender>
+void gemmBTile(pika::execution::thread_priority priority, blas::Op op, ATileSender&& a_tile,
+               BTileSender&& b_tile, CTileSender&& c_tile) {
+  using ElementType = dlaf::internal::SenderElementType<ATileSender>;
+
+  pika::execution::experimental::start_detached(
+      dlaf::internal::whenAllLift(op, blas::Op::NoTrans, ElementType(-1.0),
+                                  std::forward<ATileSender>(a_tile), std::forward<BTileSender>(b_tile),
+                                  ElementType(1.0), std::forward<CTileSender>(c_tile)) |
+      tile::gemm(dlaf::internal::Policy<backend>(priority)));
+}
+
+template <Backend backend, class WTileSender, class BTileSender>
+void addBTile(pika::execution::thread_priority priority, WTileSender&& w_tile, BTileSender&& b_tile) {
+  using ElementType = dlaf::internal::SenderElementType<WTileSender>;
+
+  pika::execution::experimental::start_detached(
+      dlaf::internal::whenAllLift(ElementType(1.0), std::forward<WTileSender>(w_tile),
+                                  std::forward<BTileSender>(b_tile)) |
+      tile::add(dlaf::internal::Policy<backend>(priority)));
+}
+
+// Makes the diagonal tile A_kk available to all the ranks of the grid row storing it (i.e. to the
+// ranks storing the k-th tile row of B), in the tile of diag_panel with the same local row index.
+template <class T, Device D>
+void broadcastDiagTile(const comm::Index2D this_rank, const SizeType k, Matrix<T, D>& mat_a,
+                       matrix::Panel<Coord::Col, T, D>& diag_panel,
+                       common::Pipeline<comm::Communicator>& mpi_row_task_chain) {
+  const matrix::Distribution& distr = mat_a.distribution();
+  const GlobalTileIndex kk_idx(k, k);
+  const comm::Index2D kk_rank = distr.rankGlobalTile(kk_idx);
+
+  diag_panel.setRange(kk_idx, GlobalTileIndex(k + 1, k + 1));
+  if (k == distr.nrTiles().cols() - 1)
+    diag_panel.setWidth(mat_a.tileSize(kk_idx).cols());
+
+  if (kk_rank.row() != this_rank.row())
+    return;
+
+  if (kk_rank.col() == this_rank.col())
+    diag_panel.setTile({Coord::Row, distr.localTileFromGlobalTile<Coord::Row>(k)}, mat_a.read(kk_idx));
+  comm::broadcast(kk_rank.col(), diag_panel, mpi_row_task_chain);
+}
+
+// Solves op(A_kk) X_kj = B_kj for the tiles of the k-th tile row of B stored by this rank, where A_kk
+// is the diagonal tile of the triangle uplo made available by broadcastDiagTile.
+template <Backend backend, class T, Device D>
+void trsmBRow(const comm::Index2D this_rank, const blas::Uplo uplo, const blas::Op op, const SizeType k,
+              matrix::Panel<Coord::Col, T, D>& diag_panel, Matrix<T, D>& mat_b) {
+  const matrix::Distribution& distr_b = mat_b.distribution();
+
+  if (distr_b.rankGlobalTile<Coord::Row>(k) != this_rank.row())
+    return;
+
+  const SizeType k_local = distr_b.localTileFromGlobalTile<Coord::Row>(k);
+  for (SizeType j = 0; j < distr_b.localNrTiles().cols(); ++j)
+    trsmBTile<backend>(pika::execution::thread_priority::high, uplo, op,
+                       diag_panel.read({Coord::Row, k_local}),
+                       mat_b.readwrite(LocalTileIndex(k_local, j)));
+}
+
+// Makes the tiles L_ik (i > k) of the k-th tile column of the lower triangular factor available to the
+// ranks storing the corresponding tile rows of B, in the tiles of panel with local row index i.
+template <class T, Device D>
+void broadcastColPanelL(const comm::Index2D this_rank, const SizeType k, Matrix<T, D>& mat_a,
+                        matrix::Panel<Coord::Col, T, D>& panel,
+                        common::Pipeline<comm::Communicator>& mpi_row_task_chain) {
+  const matrix::Distribution& distr = mat_a.distribution();
+  const comm::IndexT_MPI k_rank_col = distr.rankGlobalTile<Coord::Col>(k);
+
+  panel.setRangeStart(GlobalTileIndex(k + 1, k + 1));
+
+  if (k_rank_col == this_rank.col()) {
+    const SizeType k_local = distr.localTileFromGlobalTile<Coord::Col>(k);
+    for (const auto& idx : panel.iteratorLocal())
+      panel.setTile(idx, mat_a.read(LocalTileIndex(idx.row(), k_local)));
+  }
+  comm::broadcast(k_rank_col, panel, mpi_row_task_chain);
+}
+
+// Makes the tiles U_ki (i > k) of the k-th tile row of the upper triangular factor available to the
+// ranks storing the corresponding tile rows of B, in the tiles of panelT with local row index i.
+// panel is used as workspace for the broadcast of the tile row.
+template <class T, Device D>
+void broadcastRowPanelU(const comm::Index2D this_rank, const SizeType k, Matrix<T, D>& mat_a,
+                        matrix::Panel<Coord::Row, T, D>& panel,
+                        matrix::Panel<Coord::Col, T, D, matrix::StoreTransposed::Yes>& panelT,
+                        common::Pipeline<comm::Communicator>& mpi_row_task_chain,
+                        common::Pipeline<comm::Communicator>& mpi_col_task_chain) {
+  const matrix::Distribution& distr = mat_a.distribution();
+  const comm::IndexT_MPI k_rank_row = distr.rankGlobalTile<Coord::Row>(k);
+
+  panel.setRangeStart(GlobalTileIndex(k + 1, k + 1));
+  panelT.setRangeStart(GlobalTileIndex(k + 1, k + 1));
+
+  if (k_rank_row == this_rank.row()) {
+    const SizeType k_local = distr.localTileFromGlobalTile<Coord::Row>(k);
+    for (const auto& idx : panel.iteratorLocal())
+      panel.setTile(idx, mat_a.read(LocalTileIndex(k_local, idx.col())));
+  }
+  comm::broadcast(k_rank_row, panel, mpi_col_task_chain);
+  comm::broadcastTransposed(panel, panelT, mpi_row_task_chain);
+
+  panel.reset();
+}
+
+// Backward substitution X_k = op(A_kk)^-1 (Y_k - sum_{i>k} op(A_ik) X_i), for k = nrtile - 1, ..., 0,
+// where Y is the result of the forward substitution stored in mat_b.
+//
+// op(A_ik) is obtained applying op to the tile with local row index i of the panel returned by
+// get_panel(k) (which is reset after its use), i.e. either a panel of the factor kept by the
+// factorization, or a panel communicated again (see broadcastColPanelL and broadcastRowPanelU).
+// Each rank computes the contributions of the tile rows of X it stores, which are then reduced along
+// the grid columns on the ranks storing the k-th tile row of B.
+template <Backend backend, class T, Device D, class GetPanel>
+void backwardSubstitution(const comm::Index2D this_rank, const blas::Uplo uplo, const blas::Op op,
+                          Matrix<T, D>& mat_a, GetPanel&& get_panel,
+                          common::Pipeline<comm::Communicator>& mpi_row_task_chain,
+                          common::Pipeline<comm::Communicator>& mpi_col_task_chain,
+                          Matrix<T, D>& mat_b) {
+  namespace ex = pika::execution::experimental;
+  using pika::execution::thread_priority;
+
+  const matrix::Distribution& distr_b = mat_b.distribution();
+  const SizeType nrtile = mat_a.nrTiles().cols();
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> diag_panels(n_workspaces, mat_a.distribution());
+  common::RoundRobin<matrix::Panel<Coord::Row, T, D>> w_panels(n_workspaces, distr_b);
+
+  for (SizeType k = nrtile - 1; k >= 0; --k) {
+    const SizeType kt = k + 1;
+    const auto k_rank_row = distr_b.rankGlobalTile<Coord::Row>(k);
+
+    auto& diag_panel = diag_panels.nextResource();
+    broadcastDiagTile(this_rank, k, mat_a, diag_panel, mpi_row_task_chain);
+
+    if (kt < nrtile) {
+      auto& panel = get_panel(k);
+      auto& w_panel = w_panels.nextResource();
+
+      matrix::util::set0<backend>(thread_priority::normal, w_panel);
+
+      for (SizeType i = distr_b.nextLocalTileFromGlobalTile<Coord::Row>(kt);
+           i < distr_b.localNrTiles().rows(); ++i) {
+        for (SizeType j = 0; j < distr_b.localNrTiles().cols(); ++j) {
+          gemmBTile<backend>(thread_priority::normal, op, panel.read({Coord::Row, i}),
+                             mat_b.read(LocalTileIndex(i, j)), w_panel.readwrite({Coord::Col, j}));
+        }
+      }
+
+      if (distr_b.commGridSize().rows() > 1) {
+        for (const auto& idx : w_panel.iteratorLocal()) {
+          if (this_rank.row() == k_rank_row)
+            ex::start_detached(comm::scheduleReduceRecvInPlace(mpi_col_task_chain(), MPI_SUM,
+                                                               w_panel.readwrite(idx)));
+          else
+            ex::start_detached(comm::scheduleReduceSend(mpi_col_task_chain(), k_rank_row, MPI_SUM,
+                                                        w_panel.read(idx)));
+        }
+      }
+
+      if (this_rank.row() == k_rank_row) {
+        const SizeType k_local = distr_b.localTileFromGlobalTile<Coord::Row>(k);
+        for (SizeType j = 0; j < distr_b.localNrTiles().cols(); ++j)
+          addBTile<backend>(thread_priority::high, w_panel.read({Coord::Col, j}),
+                            mat_b.readwrite(LocalTileIndex(k_local, j)));
+      }
+
+      w_panel.reset();
+      panel.reset();
+    }
+
+    trsmBRow<backend>(this_rank, uplo, op, k, diag_panel, mat_b);
+
+    diag_panel.reset();
+  }
+}
+}
+
+// Local implementation of the Cholesky solver (Lower).
+template <Backend backend, Device device, class T>
+void Cholesky<backend, device, T>::call_L(Matrix<T, device>& mat_a, Matrix<T, device>& mat_b) {
+  using namespace factorization::internal::cholesky_l;
+  using namespace cholesky_solver;
+  using pika::execution::thread_priority;
+
+  const SizeType nrtile = mat_a.nrTiles().cols();
+  const SizeType n = mat_b.nrTiles().cols();
+
+  for (SizeType k = 0; k < nrtile; ++k) {
+    const LocalTileIndex kk{k, k};
+
+    potrfDiagTile<backend>(thread_priority::normal, mat_a.readwrite(kk));
+
+    for (SizeType i = k + 1; i < nrtile; ++i)
+      trsmPanelTile<backend>(thread_priority::high, mat_a.read(kk),
+                             mat_a.readwrite(LocalTileIndex{i, k}));
+
+    // Forward substitution of the k-th tile row of B, which starts as soon as L_kk is available
+    // and does not wait for the trailing matrix update.
+    for (SizeType j = 0; j < n; ++j) {
+      const LocalTileIndex kj{k, j};
+
+      trsmBTile<backend>(thread_priority::high, blas::Uplo::Lower, blas::Op::NoTrans, mat_a.read(kk),
+                         mat_b.readwrite(kj));
+
+      for (SizeType i = k + 1; i < nrtile; ++i)
+        gemmBTile<backend>(thread_priority::normal, blas::Op::NoTrans,
+                           mat_a.read(LocalTileIndex{i, k}), mat_b.read(kj),
+                           mat_b.readwrite(LocalTileIndex{i, j}));
+    }
+
+    for (SizeType j = k + 1; j < nrtile; ++j) {
+      const auto trailing_matrix_priority =
+          (j == k + 1) ? thread_priority::high : thread_priority::normal;
+
+      herkTrailingDiagTile<backend>(trailing_matrix_priority, mat_a.read(LocalTileIndex{j, k}),
+                                    mat_a.readwrite(LocalTileIndex{j, j}));
+
+      for (SizeType i = j + 1; i < nrtile; ++i)
+        gemmTrailingMatrixTile<backend>(thread_priority::normal, mat_a.read(LocalTileIndex{i, k}),
+                                        mat_a.read(LocalTileIndex{j, k}),
+                                        mat_a.readwrite(LocalTileIndex{i, j}));
+    }
+  }
+
+  // Backward substitution
+  for (SizeType k = nrtile - 1; k >= 0; --k) {
+    for (SizeType j = 0; j < n; ++j) {
+      const LocalTileIndex kj{k, j};
+
+      for (SizeType i = k + 1; i < nrtile; ++i)
+        gemmBTile<backend>(thread_priority::normal, blas::Op::ConjTrans,
+                           mat_a.read(LocalTileIndex{i, k}), mat_b.read(LocalTileIndex{i, j}),
+                           mat_b.readwrite(kj));
+
+      trsmBTile<backend>(thread_priority::high, blas::Uplo::Lower, blas::Op::ConjTrans,
+                         mat_a.read(LocalTileIndex{k, k}), mat_b.readwrite(kj));
+    }
+  }
+}
+
+// Local implementation of the Cholesky solver (Upper).
+template <Backend backend, Device device, class T>
+void Cholesky<backend, device, T>::call_U(Matrix<T, device>& mat_a, Matrix<T, device>& mat_b) {
+  using namespace factorization::internal::cholesky_u;
+  using namespace cholesky_solver;
+  using pika::execution::thread_priority;
+
+  const SizeType nrtile = mat_a.nrTiles().cols();
+  const SizeType n = mat_b.nrTiles().cols();
+
+  for (SizeType k = 0; k < nrtile; ++k) {
+    const LocalTileIndex kk{k, k};
+
+    potrfDiagTile<backend>(thread_priority::normal, mat_a.readwrite(kk));
+
+    for (SizeType j = k + 1; j < nrtile; ++j)
+      trsmPanelTile<backend>(thread_priority::high, mat_a.read(kk),
+                             mat_a.readwrite(LocalTileIndex{k, j}));
+
+    // Forward substitution of the k-th tile row of B, which starts as soon as U_kk is available
+    // and does not wait for the trailing matrix update.
+    for (SizeType j = 0; j < n; ++j) {
+      const LocalTileIndex kj{k, j};
+
+      trsmBTile<backend>(thread_priority::high, blas::Uplo::Upper, blas::Op::ConjTrans, mat_a.read(kk),
+                         mat_b.readwrite(kj));
+
+      for (SizeType i = k + 1; i < nrtile; ++i)
+        gemmBTile<backend>(thread_priority::normal, blas::Op::ConjTrans,
+                           mat_a.read(LocalTileIndex{k, i}), mat_b.read(kj),
+                           mat_b.readwrite(LocalTileIndex{i, j}));
+    }
+
+    for (SizeType i = k + 1; i < nrtile; ++i) {
+      const auto trailing_matrix_priority =
+          (i == k + 1) ? thread_priority::high : thread_priority::normal;
+
+      herkTrailingDiagTile<backend>(trailing_matrix_priority, mat_a.read(LocalTileIndex{k, i}),
+                                    mat_a.readwrite(LocalTileIndex{i, i}));
+
+      for (SizeType j = i + 1; j < nrtile; ++j)
+        gemmTrailingMatrixTile<backend>(thread_priority::normal, mat_a.read(LocalTileIndex{k, i}),
+                                        mat_a.read(LocalTileIndex{k, j}),
+                                        mat_a.readwrite(LocalTileIndex{i, j}));
+    }
+  }
+
+  // Backward substitution
+  for (SizeType k = nrtile - 1; k >= 0; --k) {
+    for (SizeType j = 0; j < n; ++j) {
+      const LocalTileIndex kj{k, j};
+
+      for (SizeType i = k + 1; i < nrtile; ++i)
+        gemmBTile<backend>(thread_priority::normal, blas::Op::NoTrans,
+                           mat_a.read(LocalTileIndex{k, i}), mat_b.read(LocalTileIndex{i, j}),
+                           mat_b.readwrite(kj));
+
+      trsmBTile<backend>(thread_priority::high, blas::Uplo::Upper, blas::Op::NoTrans,
+                         mat_a.read(LocalTileIndex{k, k}), mat_b.readwrite(kj));
+    }
+  }
+}
+
+template <Backend backend, Device device, class T>
+void Cholesky<backend, device, T>::call_L(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a,
+                                          Matrix<T, device>& mat_b) {
+  using namespace factorization::internal::cholesky_l;
+  using namespace cholesky_solver;
+  using pika::execution::thread_priority;
+
+  // Set up MPI executor pipelines
+  common::Pipeline<comm::Communicator> mpi_row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_col_task_chain(grid.colCommunicator().clone());
+
+  const comm::Index2D this_rank = grid.rank();
+
+  const matrix::Distribution& distr = mat_a.distribution();
+  const matrix::Distribution& distr_b = mat_b.distribution();
+  const SizeType nrtile = mat_a.nrTiles().cols();
+
+  // Note: A has to be factorized even if B is empty.
+  const bool has_rhs = !mat_b.size().isEmpty();
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device, matrix::StoreTransposed::Yes>> panelsT(
+      n_workspaces, distr);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device>> diag_panels(n_workspaces, distr);
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device>> b_panels(n_workspaces, distr_b);
+
+  // Note:
+  // If cholesky_solver_keep_panels is set, the column panels of L broadcasted by the factorization are
+  // kept (instead of being recycled), such that the backward substitution does not have to communicate
+  // them again. They are never kept if there is no right-hand side.
+  const bool keep_panels = has_rhs && getTuneParameters().cholesky_solver_keep_panels;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device>> panels(keep_panels ? 0 : n_workspaces,
+                                                                  distr);
+  std::vector<matrix::Panel<Coord::Col, T, device>> kept_panels;
+  if (keep_panels)
+    kept_panels.reserve(to_sizet(std::max<SizeType>(0, nrtile - 1)));
+
+  for (SizeType k = 0; k < nrtile; ++k) {
+    const GlobalTileIndex kk_idx(k, k);
+    const comm::Index2D kk_rank = distr.rankGlobalTile(kk_idx);
+
+    // Factorization of diagonal tile and broadcast it along the k-th column
+    if (kk_rank == this_rank)
+      potrfDiagTile<backend>(thread_priority::normal, mat_a.readwrite(kk_idx));
+
+    // FORWARD SUBSTITUTION (k-th tile row of B)
+    if (has_rhs) {
+      auto& diag_panel = diag_panels.nextResource();
+
+      broadcastDiagTile(this_rank, k, mat_a, diag_panel, mpi_row_task_chain);
+      trsmBRow<backend>(this_rank, blas::Uplo::Lower, blas::Op::NoTrans, k, diag_panel, mat_b);
+
+      diag_panel.reset();
+    }
+
+    // If there is no trailing matrix
+    const SizeType kt = k + 1;
+    if (kt == nrtile)
+      continue;
+
+    auto& panel = keep_panels ? kept_panels.emplace_back(distr, GlobalTileIndex(kt, kt))
+                              : panels.nextResource();
+    auto& panelT = panelsT.nextResource();
+
+    panel.setRangeStart(GlobalTileIndex(kt, kt));
+
+    if (kk_rank.col() == this_rank.col()) {
+      const LocalTileIndex diag_wp_idx{0, distr.localTileFromGlobalTile<Coord::Col>(k)};
+
+      // Note:
+      // panelT shrinked to a single tile for temporarly storing and communicating the diagonal
+      // tile used for the column update
+      panelT.setRange({k, k}, {kt, kt});
+
+      if (kk_rank.row() == this_rank.row())
+        panelT.setTile(diag_wp_idx, mat_a.read(kk_idx));
+      broadcast(kk_rank.row(), panelT, mpi_col_task_chain);
+
+      // COLUMN UPDATE
+      for (SizeType i = distr.nextLocalTileFromGlobalTile<Coord::Row>(kt);
+           i < distr.localNrTiles().rows(); ++i) {
+        const LocalTileIndex local_idx(Coord::Row, i);
+        const LocalTileIndex ik_idx(i, distr.localTileFromGlobalTile<Coord::Col>(k));
+
+        trsmPanelTile<backend>(thread_priority::high, panelT.read(diag_wp_idx), mat_a.readwrite(ik_idx));
+
+        panel.setTile(local_idx, mat_a.read(ik_idx));
+      }
+
+      // row panel has been used for temporary storage of diagonal panel for column update
+      panelT.reset();
+    }
+
+    panelT.setRange({kt, kt}, indexFromOrigin(distr.nrTiles()));
+
+    broadcast(kk_rank.col(), panel, panelT, mpi_row_task_chain, mpi_col_task_chain);
+
+    // FORWARD SUBSTITUTION (update of the following tile rows of B)
+    // It uses the same column panel of L used by the trailing matrix update, and it does not wait
+    // for the update itself.
+    if (has_rhs) {
+      auto& b_panel = b_panels.nextResource();
+
+      if (kk_rank.row() == this_rank.row()) {
+        const SizeType k_local = distr_b.localTileFromGlobalTile<Coord::Row>(k);
+        for (SizeType j = 0; j < distr_b.localNrTiles().cols(); ++j)
+          b_panel.setTile({Coord::Col, j}, mat_b.read(LocalTileIndex(k_local, j)));
+      }
+      broadcast(kk_rank.row(), b_panel, mpi_col_task_chain);
+
+      for (SizeType i = distr_b.nextLocalTileFromGlobalTile<Coord::Row>(kt);
+           i < distr_b.localNrTiles().rows(); ++i) {
+        const auto priority = (distr_b.globalTileFromLocalTile<Coord::Row>(i) == kt)
+                                  ? thread_priority::high
+                                  : thread_priority::normal;
+
+        for (SizeType j = 0; j < distr_b.localNrTiles().cols(); ++j)
+          gemmBTile<backend>(priority, blas::Op::NoTrans, panel.read({Coord::Row, i}),
+                             b_panel.read({Coord::Col, j}), mat_b.readwrite(LocalTileIndex(i, j)));
+      }
+
+      b_panel.reset();
+    }
+
+    // TRAILING MATRIX
+    for (SizeType jt_idx = kt; jt_idx < nrtile; ++jt_idx) {
+      const auto owner = distr.rankGlobalTile({jt_idx, jt_idx});
+
+      if (owner.col() != this_rank.col())
+        continue;
+
+      const auto j = distr.localTileFromGlobalTile<Coord::Col>(jt_idx);
+      const auto trailing_matrix_priority =
+          (jt_idx == kt) ? thread_priority::high : thread_priority::normal;
+      if (this_rank.row() == owner.row()) {
+        const auto i = distr.localTileFromGlobalTile<Coord::Row>(jt_idx);
+
+        herkTrailingDiagTile<backend>(trailing_matrix_priority, panel.read({Coord::Row, i}),
+                                      mat_a.readwrite(LocalTileIndex{i, j}));
+      }
+
+      for (SizeType i_idx = jt_idx + 1; i_idx < nrtile; ++i_idx) {
+        const auto owner_row = distr.rankGlobalTile<Coord::Row>(i_idx);
+
+        if (owner_row != this_rank.row())
+          continue;
+
+        const auto i = distr.localTileFromGlobalTile<Coord::Row>(i_idx);
+        gemmTrailingMatrixTile<backend>(thread_priority::normal, panel.read({Coord::Row, i}),
+                                        panelT.read({Coord::Col, j}),
+                                        mat_a.readwrite(LocalTileIndex{i, j}));
+      }
+    }
+
+    panelT.reset();
+    if (!keep_panels)
+      panel.reset();
+  }
+
+  if (!has_rhs)
+    return;
+
+  // BACKWARD SUBSTITUTION: X_k = L_kk^-H (Y_k - sum_{i>k} L_ik^H X_i)
+  auto get_panel = [&](const SizeType k) -> matrix::Panel<Coord::Col, T, device>& {
+    if (keep_panels)
+      return kept_panels[to_sizet(k)];
+
+    auto& panel = panels.nextResource();
+    broadcastColPanelL(this_rank, k, mat_a, panel, mpi_row_task_chain);
+    return panel;
+  };
+  backwardSubstitution<backend>(this_rank, blas::Uplo::Lower, blas::Op::ConjTrans, mat_a, get_panel,
+                                mpi_row_task_chain, mpi_col_task_chain, mat_b);
+}
+
+template <Backend backend, Device device, class T>
+void Cholesky<backend, device, T>::call_U(comm::CommunicatorGrid grid, Matrix<T, device>& mat_a,
+                                          Matrix<T, device>& mat_b) {
+  using namespace factorization::internal::cholesky_u;
+  using namespace cholesky_solver;
+  using pika::execution::thread_priority;
+
+  // Set up MPI executor pipelines
+  common::Pipeline<comm::Communicator> mpi_row_task_chain(grid.rowCommunicator().clone());
+  common::Pipeline<comm::Communicator> mpi_col_task_chain(grid.colCommunicator().clone());
+
+  const comm::Index2D this_rank = grid.rank();
+
+  const matrix::Distribution& distr = mat_a.distribution();
+  const matrix::Distribution& distr_b = mat_b.distribution();
+  const SizeType nrtile = mat_a.nrTiles().cols();
+
+  // Note: A has to be factorized even if B is empty.
+  const bool has_rhs = !mat_b.size().isEmpty();
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device>> panels(n_workspaces, distr);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device>> diag_panels(n_workspaces, distr);
+  common::RoundRobin<matrix::Panel<Coord::Row, T, device>> b_panels(n_workspaces, distr_b);
+
+  // Note:
+  // The transposed row panels of U (i.e. the tiles U_ki accessed with the row index i) are used by both
+  // the trailing matrix update and the substitutions. If cholesky_solver_keep_panels is set, they are
+  // kept (instead of being recycled), such that the backward substitution does not have to communicate
+  // them again. They are never kept if there is no right-hand side.
+  // They are populated with broadcastTransposed since, differently from the broadcast of panel pairs,
+  // it makes available also the last tile, which is needed by the forward substitution.
+  const bool keep_panels = has_rhs && getTuneParameters().cholesky_solver_keep_panels;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, device, matrix::StoreTransposed::Yes>> panelsT(
+      keep_panels ? 0 : n_workspaces, distr);
+  std::vector<matrix::Panel<Coord::Col, T, device, matrix::StoreTransposed::Yes>> kept_panelsT;
+  if (keep_panels)
+    kept_panelsT.reserve(to_sizet(std::max<SizeType>(0, nrtile - 1)));
+
+  for (SizeType k = 0; k < nrtile; ++k) {
+    const GlobalTileIndex kk_idx(k, k);
+    const comm::Index2D kk_rank = distr.rankGlobalTile(kk_idx);
+
+    // Factorization of diagonal tile and broadcast it along the k-th row
+    if (kk_rank == this_rank)
+      potrfDiagTile<backend>(thread_priority::normal, mat_a.readwrite(kk_idx));
+
+    // Note:
+    // The diagonal tile is used by both the row update and the forward substitution.
+    auto& diag_panel = diag_panels.nextResource();
+    broadcastDiagTile(this_rank, k, mat_a, diag_panel, mpi_row_task_chain);
+
+    // FORWARD SUBSTITUTION (k-th tile row of B)
+    if (has_rhs)
+      trsmBRow<backend>(this_rank, blas::Uplo::Upper, blas::Op::ConjTrans, k, diag_panel, mat_b);
+
+    // If there is no trailing matrix
+    const SizeType kt = k + 1;
+    if (kt == nrtile) {
+      diag_panel.reset();
+      continue;
+    }
+
+    auto& panel = panels.nextResource();
+    auto& panelT = keep_panels ? kept_panelsT.emplace_back(distr, GlobalTileIndex(kt, kt))
+                               : panelsT.nextResource();
+
+    panel.setRangeStart(GlobalTileIndex(kt, kt));
+    panelT.setRangeStart(GlobalTileIndex(kt, kt));
+
+    if (kk_rank.row() == this_rank.row()) {
+      const LocalTileIndex diag_wp_idx(Coord::Row, distr.localTileFromGlobalTile<Coord::Row>(k));
+
+      // ROW UPDATE
+      for (SizeType j = distr.nextLocalTileFromGlobalTile<Coord::Col>(kt);
+           j < distr.localNrTiles().cols(); ++j) {
+        const LocalTileIndex local_idx(Coord::Col, j);
+        const LocalTileIndex kj_idx(distr.localTileFromGlobalTile<Coord::Row>(k), j);
+
+        trsmPanelTile<backend>(thread_priority::high, diag_panel.read(diag_wp_idx),
+                               mat_a.readwrite(kj_idx));
+
+        panel.setTile(local_idx, mat_a.read(kj_idx));
+      }
+    }
+
+    diag_panel.reset();
+
+    broadcast(kk_rank.row(), panel, mpi_col_task_chain);
+    broadcastTransposed(panel, panelT, mpi_row_task_chain);
+
+    // FORWARD SUBSTITUTION (update of the following tile rows of B)
+    // It uses the same (transposed) row panel of U used by the trailing matrix update, and it does not
+    // wait for the update itself.
+    if (has_rhs) {
+      auto& b_panel = b_panels.nextResource();
+
+      if (kk_rank.row() == this_rank.row()) {
+        const SizeType k_local = distr_b.localTileFromGlobalTile<Coord::Row>(k);
+        for (SizeType j = 0; j < distr_b.localNrTiles().cols(); ++j)
+          b_panel.setTile({Coord::Col, j}, mat_b.read(LocalTileIndex(k_local, j)));
+      }
+      broadcast(kk_rank.row(), b_panel, mpi_col_task_chain);
+
+      for (SizeType i = distr_b.nextLocalTileFromGlobalTile<Coord::Row>(kt);
+           i < distr_b.localNrTiles().rows(); ++i) {
+        const auto priority = (distr_b.globalTileFromLocalTile<Coord::Row>(i) == kt)
+                                  ? thread_priority::high
+                                  : thread_priority::normal;
+
+        for (SizeType j = 0; j < distr_b.localNrTiles().cols(); ++j)
+          gemmBTile<backend>(priority, blas::Op::ConjTrans, panelT.read({Coord::Row, i}),
+                             b_panel.read({Coord::Col, j}), mat_b.readwrite(LocalTileIndex(i, j)));
+      }
+
+      b_panel.reset();
+    }
+
+    // TRAILING MATRIX
+    for (SizeType it_idx = kt; it_idx < nrtile; ++it_idx) {
+      const auto owner = distr.rankGlobalTile({it_idx, it_idx});
+
+      if (owner.row() != this_rank.row())
+        continue;
+
+      const auto i = distr.localTileFromGlobalTile<Coord::Row>(it_idx);
+      const auto trailing_matrix_priority =
+          (it_idx == kt) ? thread_priority::high : thread_priority::normal;
+      if (this_rank.col() == owner.col()) {
+        const auto j = distr.localTileFromGlobalTile<Coord::Col>(it_idx);
+
+        herkTrailingDiagTile<backend>(trailing_matrix_priority, panel.read({Coord::Col, j}),
+                                      mat_a.readwrite(LocalTileIndex{i, j}));
+      }
+
+      for (SizeType j_idx = it_idx + 1; j_idx < nrtile; ++j_idx) {
+        const auto owner_col = distr.rankGlobalTile<Coord::Col>(j_idx);
+
+        if (owner_col != this_rank.col())
+          continue;
+
+        const auto j = distr.localTileFromGlobalTile<Coord::Col>(j_idx);
+
+        gemmTrailingMatrixTile<backend>(thread_priority::normal, panelT.read({Coord::Row, i}),
+                                        panel.read({Coord::Col, j}),
+                                        mat_a.readwrite(LocalTileIndex{i, j}));
+      }
+    }
+
+    panel.reset();
+    if (!keep_panels)
+      panelT.reset();
+  }
+
+  if (!has_rhs)
+    return;
+
+  // BACKWARD SUBSTITUTION: X_k = U_kk^-1 (Y_k - sum_{i>k} U_ki X_i)
+  auto get_panel =
+      [&](const SizeType k) -> matrix::Panel<Coord::Col, T, device, matrix::StoreTransposed::Yes>& {
+    if (keep_panels)
+      return kept_panelsT[to_sizet(k)];
+
+    auto& panelT = panelsT.nextResource();
+    broadcastRowPanelU(this_rank, k, mat_a, panels.nextResource(), panelT, mpi_row_task_chain,
+                       mpi_col_task_chain);
+    return panelT;
+  };
+  backwardSubstitution<backend>(this_rank, blas::Uplo::Upper, blas::Op::NoTrans, mat_a, get_panel,
+                                mpi_row_task_chain, mpi_col_task_chain, mat_b);
+}
+}
+}
+}
@@ -12,6 +12,7 @@
 /// @file
 
 #include <cstdint>
+#include <ostream>
 
 #include <pika/runtime.hpp>
 
@@ -27,6 +28,22 @@ namespace dlaf {
 /// - red2band_barrier_busy_wait_us:
 ///     The duration in microseconds to busy-wait in barriers in the reduction to band algorithm.
 ///     Set with --dlaf:red2band-barrier-busy-wait-us or env variable DLAF_RED2BAND_BARRIER_BUSY_WAIT_US.
+/// - red2band_panel_adaptive:
+///     Choose the number of workers and the barrier busy-wait duration of the panel of the reduction to
+///     band algorithm for each panel, depending on its height and on the measured duration of the
+///     previous panels. red2band_panel_nworkers and red2band_barrier_busy_wait_us are used as upper
+///     bounds. Set with --dlaf:red2band-panel-adaptive or env variable DLAF_RED2BAND_PANEL_ADAPTIVE.
+/// - red2band_lookahead_depth:
+///     The number of next panels whose columns of the trailing matrix are updated first and with high
+///     priority in the reduction to band algorithm, such that the computation of the next panels can
+///     start as soon as possible, while the rest of the trailing matrix is updated with normal priority.
+///     Set with --dlaf:red2band-lookahead-depth or env variable DLAF_RED2BAND_LOOKAHEAD_DEPTH.
+/// - red2band_panel_cholqr:
+///     Use the communication-avoiding factorization of the panels (shifted CholeskyQR3 followed by the
+///     Householder reconstruction) in the distributed reduction to band algorithm (MC and GPU backends),
+///     which needs a constant number of collectives per panel instead of two per column. The column-wise
+///     factorization is used as fallback for numerically rank-deficient panels. Set with
+///     --dlaf:red2band-panel-cholqr or env variable DLAF_RED2BAND_PANEL_CHOLQR.
 /// - tridiag_rank1_nworkers:
 ///     The maximum number of threads to use for computing rank1 problem solution in tridiagonal solver
 ///     algorithm. Set with --dlaf:tridiag-rank1-nworkers or env variable DLAF_TRIDIAG_RANK1_NWORKERS.
@@ -34,33 +51,118 @@ namespace dlaf {
 ///     The duration in microseconds to busy-wait in barriers when computing rank1 problem solution in
 ///     the tridiagonal solver algorithm. Set with --dlaf:tridiag-rank1-barrier-busy-wait-us or env
 ///     variable DLAF_TRIDIAG_RANK1_BARRIER_BUSY_WAIT_US.
+/// - tridiag_rank1_adaptive:
+///     Choose the number of workers and the barrier busy-wait duration for each rank1 problem of the
+///     tridiagonal solver, depending on its size and on the measured duration of the previous ones.
+///     tridiag_rank1_nworkers and tridiag_rank1_barrier_busy_wait_us are used as upper bounds. Set with
+///     --dlaf:tridiag-rank1-adaptive or env variable DLAF_TRIDIAG_RANK1_ADAPTIVE.
 /// - eigensolver_min_band:
 ///     The minimum value to start looking for a divisor of the block size.
 ///     Set with --dlaf:eigensolver-min-band or env variable DLAF_EIGENSOLVER_MIN_BAND.
+/// - eigensolver_intermediate_band:
+///     If larger than 1, the local eigensolver (MC backend) reduces the band matrix to an intermediate
+///     band matrix, whose band size is the largest divisor of the band size not larger than this value,
+///     before reducing it to tridiagonal form. Disabled if 0 or if it is not smaller than the band size.
+///     Set with --dlaf:eigensolver-intermediate-band or env variable
+///     DLAF_EIGENSOLVER_INTERMEDIATE_BAND.
+/// - eigensolver_bt_pipeline_col_tiles:
+///     If larger than 0, the local eigensolver applies the back-transformations to blocks of this number
+///     of tile columns of the eigenvectors, one block after the other, such that the back-transformation
+///     of the reduction to band of a block can start while the previous back-transformation is still
+///     working on the next blocks. V and W of all the blocks of HH reflectors are computed once and kept
+///     until all the blocks have been processed (i.e. O(n^2) extra memory). Disabled if 0. Set with
+///     --dlaf:eigensolver-bt-pipeline-col-tiles or env variable DLAF_EIGENSOLVER_BT_PIPELINE_COL_TILES.
+/// - eigensolver_bt_pipeline_lookahead:
+///     The maximum number of column blocks of the pipelined back-transformations (see
+///     eigensolver_bt_pipeline_col_tiles) in flight, i.e. a column block can start only after the one
+///     this number of positions before it has been completed. Set with
+///     --dlaf:eigensolver-bt-pipeline-lookahead or env variable DLAF_EIGENSOLVER_BT_PIPELINE_LOOKAHEAD.
 /// - band_to_tridiag_1d_block_size_base:
-///     The 1D block size for band_to_tridiagonal is computed as 1d_block_size_base / nb * nb. The input
-///     matrix is distributed with a {nb x nb} block size. Set with
+///     The 1D block size for band_to_tridiagonal is computed as 1d_block_size_base / nb * nb (and
+///     possibly reduced according to band_to_tridiag_1d_min_blocks_per_rank). The input matrix is
+///     distributed with a {nb x nb} block size. Set with
 ///     --dlaf:band-to-tridiag-1d-block-size-base or env variable
 ///     DLAF_BAND_TO_TRIDIAG_1D_BLOCK_SIZE_BASE.
+/// - band_to_tridiag_1d_min_blocks_per_rank:
+///     The 1D block size of the distributed band to tridiagonal reduction is reduced (down to nb) such
+///     that each rank gets at least this number of blocks, which are assigned in round-robin. This way
+///     more sweeps are pipelined across the ranks and the ranks are kept busy also when the matrix is
+///     small compared to the number of ranks times 1d_block_size_base. 0 (default) disables the limit.
+///     Set with --dlaf:band-to-tridiag-1d-min-blocks-per-rank or env variable
+///     DLAF_BAND_TO_TRIDIAG_1D_MIN_BLOCKS_PER_RANK.
+/// - band_to_tridiag_sweeps_per_task:
+///     If larger than 1, each task of the local band to tridiagonal reduction (MC backend) advances
+///     this number of consecutive sweeps in a time-skewed order over a window of the band, such that
+///     the band data is reused in cache by the sweeps. Set with
+///     --dlaf:band-to-tridiag-sweeps-per-task or env variable DLAF_BAND_TO_TRIDIAG_SWEEPS_PER_TASK.
+/// - bt_reduction_to_band_merge_panels:
+///     If larger than 1, the local back-transformation of the reduction to band merges the HH reflectors
+///     of this number of consecutive panels into a single compact WY block (V, T), such that the
+///     eigenvectors are updated with fewer GEMMs of rank (merge_panels * mb) instead of rank mb ones.
+///     Set with --dlaf:bt-reduction-to-band-merge-panels or env variable
+///     DLAF_BT_REDUCTION_TO_BAND_MERGE_PANELS.
 /// - bt_band_to_tridiag_hh_apply_group_size:
 ///     The application of the HH reflector is splitted in smaller applications of the group size
 ///     reflectors. Set with --dlaf:bt-band-to-tridiag-hh-apply-group-size or env variable
 ///     DLAF_BT_BAND_TO_TRIDIAG_HH_APPLY_GROUP_SIZE.
+/// - bt_band_to_tridiag_hh_merge_steps:
+///     If larger than 1, the local back-transformation of the band to tridiagonal reduction (MC backend)
+///     merges the blocks of HH reflectors of this number of consecutive steps into a single compact WY
+///     block, such that the eigenvectors are updated with rank (merge_steps * b) GEMMs instead of rank b
+///     ones. The value is reduced to the largest divisor of nb / b not larger than it. Set with
+///     --dlaf:bt-band-to-tridiag-hh-merge-steps or env variable
+///     DLAF_BT_BAND_TO_TRIDIAG_HH_MERGE_STEPS.
+/// - tridiag_subset_mrrr_max_fraction:
+///     When a subset of k eigenvectors of a n x n matrix is requested, the eigenvectors of the
+///     tridiagonal matrix are computed with MRRR (O(n k) operations, no n x n workspaces) instead of
+///     divide and conquer if k <= tridiag_subset_mrrr_max_fraction * n. Set with
+///     --dlaf:tridiag-subset-mrrr-max-fraction or env variable DLAF_TRIDIAG_SUBSET_MRRR_MAX_FRACTION.
+/// - tridiag_memory_lean:
+///     Use the memory-lean mode of the local divide and conquer tridiagonal eigensolver, which needs one
+///     n x n workspace instead of two, at the cost of a less parallel eigenvector update. Set with
+///     --dlaf:tridiag-memory-lean or env variable DLAF_TRIDIAG_MEMORY_LEAN.
+/// - cholesky_solver_keep_panels:
+///     The distributed Cholesky solver keeps the panels of the factor communicated by the factorization
+///     for the backward substitution, instead of recycling them and communicating them again. Each rank
+///     keeps the local rows of all the panels, i.e. about n^2 / (2 P_rows) extra elements, where P_rows
+///     is the number of rows of the communicator grid (e.g. a whole triangle of the factor on a 1 x P
+///     grid). Set with --dlaf:cholesky-solver-keep-panels or env variable
+///     DLAF_CHOLESKY_SOLVER_KEEP_PANELS.
 /// Note to developers: Users can change these values, therefore consistency has to be ensured by
 /// algorithms.
 struct TuneParameters {
   std::size_t red2band_panel_nworkers =
       std::max<std::size_t>(1, pika::resource::get_thread_pool("default").get_os_thread_count() / 2);
   std::size_t red2band_barrier_busy_wait_us = 1000;
+  SizeType red2band_lookahead_depth = 1;
+  bool red2band_panel_adaptive = false;
+  bool red2band_panel_cholqr = false;
   std::size_t tridiag_rank1_nworkers =
       std::max<std::size_t>(1, pika::resource::get_thread_pool("default").get_os_thread_count() / 2);
   std::size_t tridiag_rank1_barrier_busy_wait_us = 0;
+  bool tridiag_rank1_adaptive = false;
 
   SizeType eigensolver_min_band = 100;
+  SizeType eigensolver_intermediate_band = 0;
+  SizeType eigensolver_bt_pipeline_col_tiles = 0;
+  SizeType eigensolver_bt_pipeline_lookahead = 2;
   SizeType band_to_tridiag_1d_block_size_base = 8192;
+  SizeType band_to_tridiag_1d_min_blocks_per_rank = 0;
+  SizeType band_to_tridiag_sweeps_per_task = 1;
+  SizeType bt_reduction_to_band_merge_panels = 1;
   SizeType bt_band_to_tridiag_hh_apply_group_size = 64;
+  SizeType bt_band_to_tridiag_hh_merge_steps = 1;
+
+  double tridiag_subset_mrrr_max_fraction = 0.1;
+
+  bool tridiag_memory_lean = false;
+
+  bool cholesky_solver_keep_panels = false;
 };
 
 TuneParameters& getTuneParameters();
 
+/// Prints the tune parameters, together with the last choices of the adaptive policies (if enabled).
+std::ostream& operator<<(std::ostream& os, const TuneParameters& params);
+
 }
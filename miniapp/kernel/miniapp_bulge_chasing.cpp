@@ -0,0 +1,225 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <vector>
+
+#include <lapack.hh>
+// LAPACKPP includes complex.h which defines the macro I.
+// This breaks pika.
+#ifdef I
+#undef I
+#endif
+
+#include <dlaf/common/format_short.h>
+#include <dlaf/eigensolver/band_to_tridiag/kernels.h>
+#include <dlaf/miniapp/dispatch.h>
+#include <dlaf/miniapp/kernel_runner.h>
+#include <dlaf/miniapp/options.h>
+#include <dlaf/types.h>
+
+using namespace dlaf;
+using namespace dlaf::miniapp;
+
+struct Options : MiniappKernelOptions<SupportReal::Yes, SupportComplex::Yes> {
+  SizeType b;
+
+  Options(const pika::program_options::variables_map& vm)
+      : MiniappKernelOptions(vm), b(vm["band-size"].as<SizeType>()) {
+    DLAF_ASSERT(b >= 2, b);
+  }
+
+  Options(Options&&) = default;
+  Options(const Options&) = default;
+  Options& operator=(Options&&) = default;
+  Options& operator=(const Options&) = default;
+};
+
+template <class T>
+T element(const SizeType i) {
+  const auto x = static_cast<BaseType<T>>(i);
+  if constexpr (isComplex_v<T>)
+    return T(std::sin(x), std::cos(3 * x));
+  else
+    return std::sin(x);
+}
+
+// Data of a single step of the bulge chasing: the band is stored as in BandBlock (i.e. the element
+// (j + offset, j) is stored at data[j * (ld + 1) + offset] with ld = 2b - 1), and the reflector
+// (tau, v) is a valid Householder reflector of size b, such that the repeated application of the
+// kernels does not change the norm of the data.
+template <class T>
+struct StepData {
+  StepData(const SizeType b) : b(b), ld(2 * b - 1), a(to_sizet(2 * b * (2 * b + 1))), v(to_sizet(b)) {
+    for (SizeType i = 0; i < to_SizeType(a.size()); ++i)
+      a[to_sizet(i)] = element<T>(i);
+
+    for (SizeType i = 0; i < b; ++i)
+      v[to_sizet(i)] = element<T>(7 * i + 1);
+    lapack::larfg(b, v.data(), v.data() + 1, 1, &tau);
+    v[0] = T{1};
+  }
+
+  T* ptr(const SizeType offset, const SizeType j) {
+    return a.data() + j * (ld + 1) + offset;
+  }
+
+  SizeType b;
+  SizeType ld;
+  std::vector<T> a;
+  std::vector<T> v;
+  T tau;
+};
+
+// The three kernels of a bulge chasing step (see SweepWorker::doStepFull) with maximum sizes.
+enum class Kernel { LeftRightHerm, Right, Left };
+
+template <bool fused, class T>
+void applyKernel(const Kernel kernel, StepData<T>& data, T* w) {
+  using namespace dlaf::eigensolver::internal;
+  const SizeType b = data.b;
+
+  switch (kernel) {
+    case Kernel::LeftRightHerm:
+      if constexpr (fused)
+        applyHHLeftRightHermFused(b, data.tau, data.v.data(), data.ptr(0, 0), data.ld, w);
+      else
+        applyHHLeftRightHermBlas(b, data.tau, data.v.data(), data.ptr(0, 0), data.ld, w);
+      break;
+    case Kernel::Right:
+      if constexpr (fused)
+        applyHHRightFused(b, b, data.tau, data.v.data(), data.ptr(b, 0), data.ld, w);
+      else
+        applyHHRightBlas(b, b, data.tau, data.v.data(), data.ptr(b, 0), data.ld, w);
+      break;
+    case Kernel::Left:
+      if constexpr (fused)
+        applyHHLeftFused(b, b - 1, data.tau, data.v.data(), data.ptr(b - 1, 1), data.ld, w);
+      else
+        applyHHLeftBlas(b, b - 1, data.tau, data.v.data(), data.ptr(b - 1, 1), data.ld, w);
+      break;
+  }
+}
+
+const char* kernelName(const Kernel kernel) {
+  switch (kernel) {
+    case Kernel::LeftRightHerm:
+      return "LeftRightHerm";
+    case Kernel::Right:
+      return "Right";
+    case Kernel::Left:
+      return "Left";
+  }
+  return "";
+}
+
+struct Test {
+  template <Backend backend, class T>
+  static void run(const Options& opts) {
+    if constexpr (backend != Backend::MC) {
+      std::cout << "miniapp_bulge_chasing is available only for the MC backend." << std::endl;
+      return;
+    }
+    else {
+      const SizeType b = opts.b;
+      std::vector<StepData<T>> data(to_sizet(opts.count), StepData<T>(b));
+      std::vector<std::vector<T>> ws(to_sizet(opts.count), std::vector<T>(to_sizet(b)));
+
+      KernelRunner<backend> runner(opts.count, opts.nparallel);
+
+      for (SizeType run_index = 0; run_index < opts.nruns; ++run_index) {
+        double step_blas = 0;
+        double step_fused = 0;
+
+        for (const auto kernel : {Kernel::LeftRightHerm, Kernel::Right, Kernel::Left}) {
+          auto kernel_blas = [kernel, &data, &ws](SizeType i) {
+            applyKernel<false>(kernel, data[to_sizet(i)], ws[to_sizet(i)].data());
+          };
+          auto kernel_fused = [kernel, &data, &ws](SizeType i) {
+            applyKernel<true>(kernel, data[to_sizet(i)], ws[to_sizet(i)].data());
+          };
+
+          const double elapsed_blas = runner.run(kernel_blas);
+          const double elapsed_fused = runner.run(kernel_fused);
+          step_blas += elapsed_blas;
+          step_fused += elapsed_fused;
+
+          std::cout << "[" << run_index << "] " << kernelName(kernel) << " blas " << elapsed_blas
+                    << "s fused " << elapsed_fused << "s speedup " << elapsed_blas / elapsed_fused
+                    << " " << dlaf::internal::FormatShort{opts.type} << " " << b << " "
+                    << opts.nparallel << " " << backend << std::endl;
+        }
+
+        // A sweep of a matrix of size n requires about n / b steps.
+        std::cout << "[" << run_index << "] Step rate blas " << opts.nparallel / step_blas
+                  << " steps/s fused " << opts.nparallel / step_fused << " steps/s speedup "
+                  << step_blas / step_fused << " " << dlaf::internal::FormatShort{opts.type} << " "
+                  << b << " " << opts.nparallel << " " << backend << std::endl;
+
+        if ((opts.do_check == dlaf::miniapp::CheckIterFreq::Last && run_index == (opts.nruns - 1)) ||
+            opts.do_check == dlaf::miniapp::CheckIterFreq::All) {
+          // Differences between the results of the two implementations applied to the same data,
+          // relative to the norm of the data (preserved by the transformations), in units of eps.
+          const auto eps = std::numeric_limits<BaseType<T>>::epsilon();
+          std::vector<T> w(to_sizet(b));
+          BaseType<T> error = 0;
+          for (const auto kernel : {Kernel::LeftRightHerm, Kernel::Right, Kernel::Left}) {
+            StepData<T> data_blas = data[0];
+            StepData<T> data_fused = data[0];
+            applyKernel<false>(kernel, data_blas, w.data());
+            applyKernel<true>(kernel, data_fused, w.data());
+
+            BaseType<T> norm = 0;
+            BaseType<T> diff = 0;
+            for (std::size_t i = 0; i < data_blas.a.size(); ++i) {
+              norm = std::max(norm, std::abs(data_blas.a[i]));
+              diff = std::max(diff, std::abs(data_blas.a[i] - data_fused.a[i]));
+            }
+            error = std::max(error, diff / std::max(norm, eps) / eps);
+          }
+
+          if (error > 10 * b)
+            std::cout << "CHECK FAILED!!!: ";
+
+          std::cout << "| a_fused - a_blas | / | a_blas | / eps: " << error << std::endl;
+        }
+      }
+    }
+  }
+};
+
+int main(int argc, char** argv) {
+  // options
+  using namespace pika::program_options;
+  options_description desc_commandline("Usage: miniapp_bulge_chasing [options]");
+  desc_commandline.add(getMiniappKernelOptionsDescription());
+
+  // clang-format off
+  desc_commandline.add_options()
+    ("band-size",  value<SizeType>() ->default_value(64), "Band size")
+  ;
+  // clang-format on
+
+  variables_map vm;
+  store(parse_command_line(argc, argv, desc_commandline), vm);
+  notify(vm);
+  if (vm.count("help")) {
+    std::cout << desc_commandline << "\n";
+    return 1;
+  }
+  Options options(vm);
+
+  dispatchMiniapp<Test>(options);
+
+  return 0;
+}
@@ -0,0 +1,173 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <vector>
+
+#include <dlaf/common/format_short.h>
+#include <dlaf/common/single_threaded_blas.h>
+#include <dlaf/eigensolver/tridiag_solver/secular.h>
+#include <dlaf/miniapp/dispatch.h>
+#include <dlaf/miniapp/kernel_runner.h>
+#include <dlaf/miniapp/options.h>
+#include <dlaf/types.h>
+
+using namespace dlaf;
+using namespace dlaf::miniapp;
+
+struct Options : MiniappKernelOptions<SupportReal::Yes, SupportComplex::No> {
+  SizeType k;
+
+  Options(const pika::program_options::variables_map& vm)
+      : MiniappKernelOptions(vm), k(vm["k"].as<SizeType>()) {
+    DLAF_ASSERT(k > 0, k);
+  }
+
+  Options(Options&&) = default;
+  Options(const Options&) = default;
+  Options& operator=(Options&&) = default;
+  Options& operator=(const Options&) = default;
+};
+
+// Rank-1 problem diag(d) + rho * z * z^T with d sorted in ascending order and ||z|| == 1.
+template <class T>
+struct Rank1Problem {
+  Rank1Problem(const SizeType k) : d(to_sizet(k)), z(to_sizet(k)), rho(1) {
+    T norm = 0;
+    for (SizeType j = 0; j < k; ++j) {
+      const T jt = static_cast<T>(j);
+      d[to_sizet(j)] = (jt + T(0.1) * std::sin(jt)) / static_cast<T>(k);
+      z[to_sizet(j)] = 1 + T(0.5) * std::cos(jt);
+      norm += z[to_sizet(j)] * z[to_sizet(j)];
+    }
+    norm = std::sqrt(norm);
+    for (auto& z_j : z)
+      z_j /= norm;
+  }
+
+  std::vector<T> d;
+  std::vector<T> z;
+  T rho;
+};
+
+// Storage for the eigenvalues and the (k x k) delta matrix of each of the count problems.
+template <class T>
+struct Rank1Results {
+  Rank1Results(const SizeType count, const SizeType k)
+      : k(k), evals(to_sizet(count), std::vector<T>(to_sizet(k))),
+        deltas(to_sizet(count), std::vector<T>(to_sizet(k * k))) {}
+
+  auto deltaCol(const SizeType i) {
+    return [this, i](const SizeType j) { return deltas[to_sizet(i)].data() + j * k; };
+  }
+
+  SizeType k;
+  std::vector<std::vector<T>> evals;
+  std::vector<std::vector<T>> deltas;
+};
+
+struct Test {
+  template <Backend backend, class T>
+  static void run(const Options& opts) {
+    if constexpr (backend != Backend::MC) {
+      std::cout << "miniapp_secular_equation is available only for the MC backend." << std::endl;
+      return;
+    }
+    else {
+      const SizeType k = opts.k;
+      const Rank1Problem<T> problem(k);
+      Rank1Results<T> res_laed4(opts.count, k);
+      Rank1Results<T> res_batched(opts.count, k);
+
+      auto kernel_laed4 = [k, &problem, &res_laed4](SizeType i) {
+        dlaf::common::internal::SingleThreadedBlasScope single;
+        eigensolver::internal::solveSecularEquationsLaed4(k, 0, k, problem.d.data(), problem.z.data(),
+                                                          problem.rho,
+                                                          res_laed4.evals[to_sizet(i)].data(),
+                                                          res_laed4.deltaCol(i));
+      };
+      auto kernel_batched = [k, &problem, &res_batched](SizeType i) {
+        eigensolver::internal::solveSecularEquations(k, 0, k, problem.d.data(), problem.z.data(),
+                                                     problem.rho, res_batched.evals[to_sizet(i)].data(),
+                                                     res_batched.deltaCol(i));
+      };
+
+      KernelRunner<backend> runner(opts.count, opts.nparallel);
+
+      for (SizeType run_index = 0; run_index < opts.nruns; ++run_index) {
+        const double elapsed_laed4 = runner.run(kernel_laed4);
+        const double elapsed_batched = runner.run(kernel_batched);
+
+        std::cout << "[" << run_index << "]"
+                  << " laed4 " << elapsed_laed4 << "s"
+                  << " batched " << elapsed_batched << "s"
+                  << " speedup " << elapsed_laed4 / elapsed_batched << " "
+                  << dlaf::internal::FormatShort{opts.type} << " " << k << " " << opts.nparallel << " "
+                  << backend << std::endl;
+
+        if ((opts.do_check == dlaf::miniapp::CheckIterFreq::Last && run_index == (opts.nruns - 1)) ||
+            opts.do_check == dlaf::miniapp::CheckIterFreq::All) {
+          // Relative differences between the results of the two implementations, in units of eps.
+          const T eps = std::numeric_limits<T>::epsilon();
+          T error_evals = 0;
+          T error_deltas = 0;
+          for (SizeType i = 0; i < opts.count; ++i) {
+            const auto& evals_ref = res_laed4.evals[to_sizet(i)];
+            const auto& evals = res_batched.evals[to_sizet(i)];
+            const auto& deltas_ref = res_laed4.deltas[to_sizet(i)];
+            const auto& deltas = res_batched.deltas[to_sizet(i)];
+            for (std::size_t j = 0; j < evals.size(); ++j)
+              error_evals = std::max(error_evals, std::abs(evals[j] - evals_ref[j]) /
+                                                      std::max(std::abs(evals_ref[j]), eps) / eps);
+            for (std::size_t j = 0; j < deltas.size(); ++j)
+              error_deltas = std::max(error_deltas, std::abs(deltas[j] - deltas_ref[j]) /
+                                                        std::max(std::abs(deltas_ref[j]), eps) / eps);
+          }
+
+          if (error_evals > 100 || error_deltas > 100)
+            std::cout << "CHECK FAILED!!!: ";
+
+          std::cout << "| evals - evals_laed4 | / | evals_laed4 | / eps: " << error_evals
+                    << ", | delta - delta_laed4 | / | delta_laed4 | / eps: " << error_deltas
+                    << std::endl;
+        }
+      }
+    }
+  }
+};
+
+int main(int argc, char** argv) {
+  // options
+  using namespace pika::program_options;
+  options_description desc_commandline("Usage: miniapp_secular_equation [options]");
+  desc_commandline.add(getMiniappKernelOptionsDescription());
+
+  // clang-format off
+  desc_commandline.add_options()
+    ("k",  value<SizeType>() ->default_value(512), "Size of the rank-1 problem")
+  ;
+  // clang-format on
+
+  variables_map vm;
+  store(parse_command_line(argc, argv, desc_commandline), vm);
+  notify(vm);
+  if (vm.count("help")) {
+    std::cout << desc_commandline << "\n";
+    return 1;
+  }
+  Options options(vm);
+
+  dispatchMiniapp<Test>(options);
+
+  return 0;
+}
@@ -0,0 +1,303 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+#include <blas/util.hh>
+#include <mpi.h>
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/program_options.hpp>
+#include <pika/runtime.hpp>
+
+#include <dlaf/common/format_short.h>
+#include <dlaf/common/index2d.h>
+#include <dlaf/common/range2d.h>
+#include <dlaf/common/timer.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/datatypes.h>
+#include <dlaf/communication/init.h>
+#include <dlaf/init.h>
+#include <dlaf/matrix/index.h>
+#include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/miniapp/dispatch.h>
+#include <dlaf/miniapp/options.h>
+#include <dlaf/multiplication/general.h>
+#include <dlaf/types.h>
+#include <dlaf/util_matrix.h>
+
+namespace {
+
+using dlaf::Backend;
+using dlaf::DefaultDevice_v;
+using dlaf::Device;
+using dlaf::GlobalElementIndex;
+using dlaf::GlobalElementSize;
+using dlaf::SizeType;
+using dlaf::TileElementSize;
+using dlaf::comm::Communicator;
+using dlaf::comm::CommunicatorGrid;
+using dlaf::comm::CommunicatorGridLayers;
+using dlaf::common::Ordering;
+using pika::this_thread::experimental::sync_wait;
+
+struct Options : dlaf::miniapp::MiniappOptions<dlaf::miniapp::SupportReal::Yes,
+                                               dlaf::miniapp::SupportComplex::Yes> {
+  SizeType m;
+  SizeType n;
+  SizeType k;
+  SizeType mb;
+  blas::Op opA;
+  blas::Op opB;
+  int layers;
+
+  Options(const pika::program_options::variables_map& vm)
+      : MiniappOptions(vm), m(vm["m"].as<SizeType>()), n(vm["n"].as<SizeType>()),
+        k(vm["k"].as<SizeType>()), mb(vm["mb"].as<SizeType>()),
+        opA(dlaf::miniapp::parseOp(vm["opA"].as<std::string>())),
+        opB(dlaf::miniapp::parseOp(vm["opB"].as<std::string>())), layers(vm["layers"].as<int>()) {
+    DLAF_ASSERT(m > 0 && n > 0 && k > 0, m, n, k);
+    DLAF_ASSERT(mb > 0, mb);
+    DLAF_ASSERT(layers > 0, layers);
+    DLAF_ASSERT(!local || layers == 1, local, layers);
+  }
+
+  Options(Options&&) = default;
+  Options(const Options&) = default;
+  Options& operator=(Options&&) = default;
+  Options& operator=(const Options&) = default;
+};
+
+template <class T>
+T polar(const double r, const double theta) {
+  if constexpr (dlaf::isComplex_v<T>)
+    return std::polar<dlaf::BaseType<T>>(static_cast<dlaf::BaseType<T>>(r),
+                                         static_cast<dlaf::BaseType<T>>(theta));
+  else
+    return static_cast<T>(r);
+}
+
+// The elements are chosen such that:
+//   op(A)_ik = .9 * (i+1) / (l+.5) * exp(I*(2*i-l)),
+//   op(B)_lj = .8 * (l+.5) / (j+2) * exp(I*(l+j)),
+//   C_ij = 1.2 * i / (j+1) * exp(I*(-i+j)),
+// where I = 0 for real types or I is the complex unit for complex types.
+// Therefore the result is
+//   res_ij = beta * C_ij + .72 * k * alpha * (i+1) / (j+2) * exp(I*(2*i+j)).
+template <class T>
+auto elementOp(const blas::Op op, T (*el_op)(double, double)) {
+  return [op, el_op](const GlobalElementIndex& index) {
+    if (op == blas::Op::NoTrans)
+      return el_op(index.row(), index.col());
+    const T el = el_op(index.col(), index.row());
+    return op == blas::Op::ConjTrans ? dlaf::conj(el) : el;
+  };
+}
+
+template <class T>
+T elementOpA(const double i, const double l) {
+  return polar<T>(.9 * (i + 1) / (l + .5), 2 * i - l);
+}
+
+template <class T>
+T elementOpB(const double l, const double j) {
+  return polar<T>(.8 * (l + .5) / (j + 2), l + j);
+}
+
+template <class T>
+T elementC(const GlobalElementIndex& index) {
+  const double i = index.row();
+  const double j = index.col();
+  return polar<T>(1.2 * i / (j + 1), -i + j);
+}
+}
+
+struct GemmMiniapp {
+  template <Backend backend, typename T>
+  static void run(const Options& opts) {
+    Communicator world(MPI_COMM_WORLD);
+    // Note: with a single layer it is a plain CommunicatorGrid.
+    CommunicatorGridLayers layers(world, opts.layers, opts.grid_rows, opts.grid_cols,
+                                  Ordering::ColumnMajor);
+    CommunicatorGrid& comm_grid = layers.grid();
+
+    const TileElementSize block_size(opts.mb, opts.mb);
+    const GlobalElementSize size_a = opts.opA == blas::Op::NoTrans ? GlobalElementSize(opts.m, opts.k)
+                                                                   : GlobalElementSize(opts.k, opts.m);
+    const GlobalElementSize size_b = opts.opB == blas::Op::NoTrans ? GlobalElementSize(opts.k, opts.n)
+                                                                   : GlobalElementSize(opts.n, opts.k);
+
+    dlaf::matrix::Matrix<T, Device::CPU> ah(size_a, block_size, comm_grid);
+    dlaf::matrix::Matrix<T, Device::CPU> bh(size_b, block_size, comm_grid);
+    dlaf::matrix::Matrix<T, Device::CPU> ch(GlobalElementSize(opts.m, opts.n), block_size, comm_grid);
+
+    dlaf::matrix::util::set(ah, elementOp<T>(opts.opA, &elementOpA<T>));
+    dlaf::matrix::util::set(bh, elementOp<T>(opts.opB, &elementOpB<T>));
+
+    dlaf::matrix::MatrixMirror<const T, DefaultDevice_v<backend>, Device::CPU> a(ah);
+    dlaf::matrix::MatrixMirror<const T, DefaultDevice_v<backend>, Device::CPU> b(bh);
+    dlaf::matrix::MatrixMirror<T, DefaultDevice_v<backend>, Device::CPU> c(ch);
+
+    auto sync_barrier = [&]() {
+      c.get().waitLocalTiles();
+      DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+    };
+
+    const T alpha = polar<T>(1.2, .3);
+    const T beta = polar<T>(.7, -.5);
+
+    const double m = opts.m;
+    const double n = opts.n;
+    const double k = opts.k;
+    const double add_mul = m * n * k;
+    const double total_ops = dlaf::total_ops<T>(add_mul, add_mul);
+
+    for (int64_t run_index = -opts.nwarmups; run_index < opts.nruns; ++run_index) {
+      if (0 == world.rank() && run_index >= 0)
+        std::cout << "[" << run_index << "]" << std::endl;
+
+      dlaf::matrix::util::set(ch, elementC<T>);
+      c.copySourceToTarget();
+
+      a.get().waitLocalTiles();
+      b.get().waitLocalTiles();
+      sync_barrier();
+
+      dlaf::common::Timer<> timeit;
+      if (opts.local)
+        dlaf::multiplication::generalMatrix<backend, DefaultDevice_v<backend>, T>(opts.opA, opts.opB,
+                                                                                  alpha, a.get(),
+                                                                                  b.get(), beta,
+                                                                                  c.get());
+      else if (opts.layers == 1)
+        dlaf::multiplication::generalMatrix<backend, DefaultDevice_v<backend>, T>(comm_grid, opts.opA,
+                                                                                  opts.opB, alpha,
+                                                                                  a.get(), b.get(),
+                                                                                  beta, c.get());
+      else
+        dlaf::multiplication::generalMatrix<backend, DefaultDevice_v<backend>, T>(layers, opts.opA,
+                                                                                  opts.opB, alpha,
+                                                                                  a.get(), b.get(),
+                                                                                  beta, c.get());
+
+      sync_barrier();
+
+      // benchmark results
+      if (0 == world.rank() && run_index >= 0) {
+        auto elapsed_time = timeit.elapsed();
+        double gigaflops = total_ops / elapsed_time / 1e9;
+
+        std::cout << "[" << run_index << "]"
+                  << " " << elapsed_time << "s"
+                  << " " << gigaflops << "GFlop/s"
+                  << " " << dlaf::internal::FormatShort{opts.type}
+                  << dlaf::internal::FormatShort{opts.opA} << dlaf::internal::FormatShort{opts.opB}
+                  << " " << ch.size() << " " << opts.k << " " << ch.blockSize() << " "
+                  << comm_grid.size() << "x" << opts.layers << " " << pika::get_os_thread_count()
+                  << " " << backend << std::endl;
+      }
+
+      c.copyTargetToSource();
+
+      // (optional) run test
+      if ((opts.do_check == dlaf::miniapp::CheckIterFreq::Last && run_index == (opts.nruns - 1)) ||
+          opts.do_check == dlaf::miniapp::CheckIterFreq::All) {
+        checkGemm(world, ch, alpha, beta, opts.k);
+      }
+    }
+  }
+
+  template <typename T>
+  static void checkGemm(Communicator& world, dlaf::matrix::Matrix<T, Device::CPU>& ch,
+                        const T alpha, const T beta, const SizeType k) {
+    const auto& dist = ch.distribution();
+    const T gamma = static_cast<T>(.72 * k) * alpha;
+
+    dlaf::BaseType<T> error = 0;
+    for (const auto& ij_local : dlaf::common::iterate_range2d(dist.localNrTiles())) {
+      const auto tile_wrapper = sync_wait(ch.read(ij_local));
+      const auto& tile = tile_wrapper.get();
+      const auto ij = dist.globalTileIndex(ij_local);
+
+      for (const auto& el : dlaf::common::iterate_range2d(tile.size())) {
+        const auto index = dist.globalElementIndex(ij, el);
+        const double i = index.row();
+        const double j = index.col();
+        const T expected = beta * elementC<T>(index) + gamma * polar<T>((i + 1) / (j + 2), 2 * i + j);
+        error = std::max(error, std::abs(tile(el) - expected));
+      }
+    }
+
+    DLAF_MPI_CHECK_ERROR(MPI_Allreduce(MPI_IN_PLACE, &error, 1,
+                                       dlaf::comm::mpi_datatype<dlaf::BaseType<T>>::type, MPI_MAX,
+                                       world));
+
+    // Note: the elements of the result are O(k), hence the error is compared to k * eps.
+    const auto eps = std::numeric_limits<dlaf::BaseType<T>>::epsilon();
+    const auto diff_ratio = error / (std::max<SizeType>(1, k) * eps);
+
+    if (0 == world.rank()) {
+      if (diff_ratio > 100)
+        std::cout << "CHECK FAILED!!!: ";
+      std::cout << "max| C - C_ref | / (k eps): " << diff_ratio << std::endl;
+    }
+  }
+};
+
+int pika_main(pika::program_options::variables_map& vm) {
+  pika::scoped_finalize pika_finalizer;
+  dlaf::ScopedInitializer init(vm);
+
+  const Options opts(vm);
+  dlaf::miniapp::dispatchMiniapp<GemmMiniapp>(opts);
+
+  return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv) {
+  dlaf::comm::mpi_init mpi_initter(argc, argv);
+
+  // options
+  using namespace pika::program_options;
+  options_description desc_commandline(
+      "Benchmark computation of C = alpha . op(A) . op(B) + beta . C, "
+      "where op(A) is an m by k matrix, op(B) is a k by n matrix and C is an m by n matrix\n\n"
+      "options\n"
+      "Usage: miniapp_gemm [options]");
+  desc_commandline.add(dlaf::miniapp::getMiniappOptionsDescription());
+  desc_commandline.add(dlaf::getOptionsDescription());
+
+  // clang-format off
+  desc_commandline.add_options()
+    ("m",      value<SizeType>()    ->default_value(4096), "Matrix C rows")
+    ("n",      value<SizeType>()    ->default_value(4096), "Matrix C columns")
+    ("k",      value<SizeType>()    ->default_value(4096), "Inner dimension of op(A) op(B)")
+    ("mb",     value<SizeType>()    ->default_value( 256), "Block size")
+    ("opA",    value<std::string>() ->default_value("N"),  "op(A): 'N' (NoTrans), 'T' (Trans), "
+                                                           "'C' (ConjTrans)")
+    ("opB",    value<std::string>() ->default_value("N"),  "op(B): 'N' (NoTrans), 'T' (Trans), "
+                                                           "'C' (ConjTrans)")
+    ("layers", value<int>()         ->default_value(1),    "Number of replicated grid layers (2.5D "
+                                                           "algorithm if > 1), it requires "
+                                                           "layers x grid-rows x grid-cols ranks")
+  ;
+  // clang-format on
+
+  pika::init_params p;
+  p.desc_cmdline = desc_commandline;
+  p.rp_callback = dlaf::initResourcePartitionerHandler;
+  return pika::init(pika_main, argc, argv, p);
+}
@@ -92,6 +92,16 @@ struct TridiagSolverMiniapp {
       return tridiag;
     }();
 
+    if (0 == world.rank()) {
+      const auto mode = opts.local ? dlaf::eigensolver::internal::getTridiagMemoryMode()
+                                   : dlaf::eigensolver::TridiagMemoryMode::Standard;
+      using dlaf::eigensolver::tridiagSolverPeakMemoryBytes;
+      const std::size_t peak_bytes =
+          tridiagSolverPeakMemoryBytes<DefaultDevice_v<backend>, T>(dist_evecs, !opts.local, mode);
+      std::cout << "Peak memory (rank 0): " << static_cast<double>(peak_bytes) / 1e9 << "GB (" << mode
+                << ")" << std::endl;
+    }
+
     for (int64_t run_index = -opts.nwarmups; run_index < opts.nruns; ++run_index) {
       if (0 == world.rank() && run_index >= 0)
         std::cout << "[" << run_index << "]" << std::endl;
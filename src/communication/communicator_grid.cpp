@@ -46,5 +46,27 @@ CommunicatorGrid::CommunicatorGrid(Communicator comm, IndexT_MPI nrows, IndexT_M
   row_ = make_communicator_managed(mpi_row);
   col_ = make_communicator_managed(mpi_col);
 }
+
+namespace {
+Communicator splitCommunicator(Communicator& comm, IndexT_MPI color, IndexT_MPI key) {
+  MPI_Comm mpi_comm;
+  DLAF_MPI_CHECK_ERROR(MPI_Comm_split(comm, color, key, &mpi_comm));
+  return make_communicator_managed(mpi_comm);
+}
+
+// Checks the layers configuration (before any communicator is split) and returns the index of the layer
+// of the current process.
+IndexT_MPI layerIndex(const Communicator& comm, IndexT_MPI nlayers, IndexT_MPI nrows, IndexT_MPI ncols) {
+  DLAF_ASSERT(nlayers > 0 && nrows > 0 && ncols > 0, nlayers, nrows, ncols);
+  DLAF_ASSERT(nlayers * nrows * ncols == comm.size(), nlayers, nrows, ncols, comm.size());
+  return comm.rank() / (nrows * ncols);
+}
+}
+
+CommunicatorGridLayers::CommunicatorGridLayers(Communicator comm, IndexT_MPI nlayers, IndexT_MPI nrows,
+                                               IndexT_MPI ncols, common::Ordering ordering)
+    : layer_(layerIndex(comm, nlayers, nrows, ncols)), nr_layers_(nlayers),
+      layers_(splitCommunicator(comm, comm.rank() % (nrows * ncols), layer_)),
+      grid_(splitCommunicator(comm, layer_, comm.rank()), nrows, ncols, ordering) {}
 }
 }
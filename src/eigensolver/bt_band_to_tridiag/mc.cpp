@@ -16,4 +16,9 @@ DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(, Backend::MC, Device::CPU, float)
 DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(, Backend::MC, Device::CPU, double)
 DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(, Backend::MC, Device::CPU, std::complex<float>)
 DLAF_EIGENSOLVER_BT_BAND_TO_TRIDIAGONAL_ETI(, Backend::MC, Device::CPU, std::complex<double>)
+
+DLAF_EIGENSOLVER_BT_BAND_TO_BAND_ETI(, Backend::MC, Device::CPU, float)
+DLAF_EIGENSOLVER_BT_BAND_TO_BAND_ETI(, Backend::MC, Device::CPU, double)
+DLAF_EIGENSOLVER_BT_BAND_TO_BAND_ETI(, Backend::MC, Device::CPU, std::complex<float>)
+DLAF_EIGENSOLVER_BT_BAND_TO_BAND_ETI(, Backend::MC, Device::CPU, std::complex<double>)
 }
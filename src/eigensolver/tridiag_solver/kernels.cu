@@ -35,19 +35,20 @@ constexpr unsigned cast_complex_kernel_tile_rows = 64;
 constexpr unsigned cast_complex_kernel_tile_cols = 16;
 
 template <class T, class CT>
-__global__ void castToComplex(const unsigned m, const unsigned n, SizeType ld, const T* in, CT* out) {
+__global__ void castToComplex(const unsigned m, const unsigned n, const T* in, SizeType ld_in, CT* out,
+                              SizeType ld_out) {
   const unsigned i = blockIdx.x * cast_complex_kernel_tile_rows + threadIdx.x;
   const unsigned j = blockIdx.y * cast_complex_kernel_tile_cols + threadIdx.y;
 
   if (i >= m || j >= n)
     return;
 
-  SizeType idx = i + j * ld;
+  const T val = in[i + j * ld_in];
   if constexpr (std::is_same<T, float>::value) {
-    out[idx] = make_cuComplex(in[idx], 0);
+    out[i + j * ld_out] = make_cuComplex(val, 0);
   }
   else {
-    out[idx] = make_cuDoubleComplex(in[idx], 0);
+    out[i + j * ld_out] = make_cuDoubleComplex(val, 0);
   }
 }
 
@@ -56,7 +57,6 @@ void castToComplex(const matrix::Tile<const T, Device::GPU>& in,
                    const matrix::Tile<std::complex<T>, Device::GPU>& out, whip::stream_t stream) {
   SizeType m = in.size().rows();
   SizeType n = in.size().cols();
-  SizeType ld = in.ld();
   const T* in_ptr = in.ptr();
   std::complex<T>* out_ptr = out.ptr();
 
@@ -65,8 +65,8 @@ void castToComplex(const matrix::Tile<const T, Device::GPU>& in,
   dim3 nr_threads(cast_complex_kernel_tile_rows, cast_complex_kernel_tile_cols);
   dim3 nr_blocks(util::ceilDiv(um, cast_complex_kernel_tile_rows),
                  util::ceilDiv(un, cast_complex_kernel_tile_cols));
-  castToComplex<<<nr_blocks, nr_threads, 0, stream>>>(um, un, ld, util::cppToCudaCast(in_ptr),
-                                                      util::cppToCudaCast(out_ptr));
+  castToComplex<<<nr_blocks, nr_threads, 0, stream>>>(um, un, util::cppToCudaCast(in_ptr), in.ld(),
+                                                      util::cppToCudaCast(out_ptr), out.ld());
 }
 
 DLAF_GPU_CAST_TO_COMPLEX_ETI(, float);
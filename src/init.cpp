@@ -38,6 +38,11 @@ bool& initialized() {
   return i;
 }
 
+bool& printConfig() {
+  static bool print = false;
+  return print;
+}
+
 template <Backend D>
 struct Init {
   // Initialization and finalization does nothing by default. Behaviour can be
@@ -122,6 +127,20 @@ struct parseFromString<SizeType> {
   };
 };
 
+template <>
+struct parseFromString<double> {
+  static double call(const std::string& var) {
+    return std::stod(var);
+  };
+};
+
+template <>
+struct parseFromString<bool> {
+  static bool call(const std::string& var) {
+    return var == "1" || var == "true" || var == "on" || var == "yes";
+  };
+};
+
 template <class T>
 struct parseFromCommandLine {
   static T call(const pika::program_options::variables_map& vm, const std::string& cmd_val) {
@@ -165,21 +184,64 @@ void updateConfiguration(const pika::program_options::variables_map& vm, configu
   updateConfigurationValue(vm, param.red2band_barrier_busy_wait_us, "RED2BAND_BARRIER_BUSY_WAIT_US",
                            "red2band-barrier-busy-wait-us");
 
+  updateConfigurationValue(vm, param.red2band_panel_adaptive, "RED2BAND_PANEL_ADAPTIVE",
+                           "red2band-panel-adaptive");
+
+  updateConfigurationValue(vm, param.red2band_lookahead_depth, "RED2BAND_LOOKAHEAD_DEPTH",
+                           "red2band-lookahead-depth");
+
+  updateConfigurationValue(vm, param.red2band_panel_cholqr, "RED2BAND_PANEL_CHOLQR",
+                           "red2band-panel-cholqr");
+
   updateConfigurationValue(vm, param.eigensolver_min_band, "EIGENSOLVER_MIN_BAND",
                            "eigensolver-min-band");
 
+  updateConfigurationValue(vm, param.eigensolver_intermediate_band, "EIGENSOLVER_INTERMEDIATE_BAND",
+                           "eigensolver-intermediate-band");
+
+  updateConfigurationValue(vm, param.eigensolver_bt_pipeline_col_tiles,
+                           "EIGENSOLVER_BT_PIPELINE_COL_TILES", "eigensolver-bt-pipeline-col-tiles");
+
+  updateConfigurationValue(vm, param.eigensolver_bt_pipeline_lookahead,
+                           "EIGENSOLVER_BT_PIPELINE_LOOKAHEAD", "eigensolver-bt-pipeline-lookahead");
+
   updateConfigurationValue(vm, param.band_to_tridiag_1d_block_size_base,
                            "BAND_TO_TRIDIAG_1D_BLOCK_SIZE_BASE", "band-to-tridiag-1d-block-size-base");
 
+  updateConfigurationValue(vm, param.band_to_tridiag_1d_min_blocks_per_rank,
+                           "BAND_TO_TRIDIAG_1D_MIN_BLOCKS_PER_RANK",
+                           "band-to-tridiag-1d-min-blocks-per-rank");
+
+  updateConfigurationValue(vm, param.band_to_tridiag_sweeps_per_task,
+                           "BAND_TO_TRIDIAG_SWEEPS_PER_TASK", "band-to-tridiag-sweeps-per-task");
+
   updateConfigurationValue(vm, param.tridiag_rank1_nworkers, "TRIDIAG_RANK1_NWORKERS",
                            "tridiag-rank1-nworkers");
 
   updateConfigurationValue(vm, param.tridiag_rank1_barrier_busy_wait_us,
                            "TRIDIAG_RANK1_BARRIER_BUSY_WAIT_US", "tridiag-rank1-barrier-busy-wait-us");
 
+  updateConfigurationValue(vm, param.tridiag_rank1_adaptive, "TRIDIAG_RANK1_ADAPTIVE",
+                           "tridiag-rank1-adaptive");
+
+  updateConfigurationValue(vm, param.bt_reduction_to_band_merge_panels,
+                           "BT_REDUCTION_TO_BAND_MERGE_PANELS", "bt-reduction-to-band-merge-panels");
+
   updateConfigurationValue(vm, param.bt_band_to_tridiag_hh_apply_group_size,
                            "DLAF_BT_BAND_TO_TRIDIAG_HH_APPLY_GROUP_SIZE",
                            "bt-band-to-tridiag-hh-apply-group-size");
+
+  updateConfigurationValue(vm, param.bt_band_to_tridiag_hh_merge_steps,
+                           "BT_BAND_TO_TRIDIAG_HH_MERGE_STEPS", "bt-band-to-tridiag-hh-merge-steps");
+
+  updateConfigurationValue(vm, param.tridiag_subset_mrrr_max_fraction,
+                           "TRIDIAG_SUBSET_MRRR_MAX_FRACTION", "tridiag-subset-mrrr-max-fraction");
+
+  updateConfigurationValue(vm, param.tridiag_memory_lean, "TRIDIAG_MEMORY_LEAN",
+                           "tridiag-memory-lean");
+
+  updateConfigurationValue(vm, param.cholesky_solver_keep_panels, "CHOLESKY_SOLVER_KEEP_PANELS",
+                           "cholesky-solver-keep-panels");
 }
 
 configuration& getConfiguration() {
@@ -212,21 +274,63 @@ pika::program_options::options_description getOptionsDescription() {
   desc.add_options()(
       "dlaf:red2band-barrier-busy-wait-us", pika::program_options::value<std::size_t>(),
       "The duration in microseconds to busy-wait in barriers in the reduction to band algorithm.");
+  desc.add_options()(
+      "dlaf:red2band-panel-adaptive", pika::program_options::value<bool>(),
+      "Choose the number of workers and the barrier busy-wait duration of each panel of the reduction to band algorithm adaptively. (The configured values are used as upper bounds.)");
+  desc.add_options()(
+      "dlaf:red2band-lookahead-depth", pika::program_options::value<SizeType>(),
+      "The number of next panels whose columns are updated first and with high priority in the reduction to band algorithm. (0 disables the lookahead.)");
+  desc.add_options()(
+      "dlaf:red2band-panel-cholqr", pika::program_options::value<bool>(),
+      "Use the communication-avoiding (CholeskyQR based) panel factorization in the distributed reduction to band algorithm.");
   desc.add_options()(
       "dlaf:eigensolver-min-band", pika::program_options::value<SizeType>(),
       "The minimum value to start looking for a divisor of the block size. When larger than the block size, the block size will be used instead.");
+  desc.add_options()(
+      "dlaf:eigensolver-intermediate-band", pika::program_options::value<SizeType>(),
+      "The maximum band size of the intermediate band matrix of the two-stage band to tridiagonal reduction of the local eigensolver. (0 disables the intermediate reduction.)");
+  desc.add_options()(
+      "dlaf:eigensolver-bt-pipeline-col-tiles", pika::program_options::value<SizeType>(),
+      "The number of tile columns of the eigenvectors streamed through both back-transformations at once by the local eigensolver. (0 disables the pipelining.)");
+  desc.add_options()(
+      "dlaf:eigensolver-bt-pipeline-lookahead", pika::program_options::value<SizeType>(),
+      "The maximum number of column blocks of the pipelined back-transformations of the local eigensolver in flight.");
   desc.add_options()(
       "dlaf:band-to-tridiag-1d-block-size-base", pika::program_options::value<SizeType>(),
-      "The 1D block size for band_to_tridiagonal is computed as 1d_block_size_base / nb * nb. (The input matrix is distributed with a {nb x nb} block size.)");
+      "The 1D block size for band_to_tridiagonal is computed as 1d_block_size_base / nb * nb, and it is reduced if dlaf:band-to-tridiag-1d-min-blocks-per-rank is set. (The input matrix is distributed with a {nb x nb} block size.)");
+  desc.add_options()(
+      "dlaf:band-to-tridiag-1d-min-blocks-per-rank", pika::program_options::value<SizeType>(),
+      "The 1D block size of the distributed band to tridiagonal reduction is reduced such that each rank gets at least this number of blocks. (0, the default, disables the limit.)");
+  desc.add_options()(
+      "dlaf:band-to-tridiag-sweeps-per-task", pika::program_options::value<SizeType>(),
+      "The number of consecutive sweeps advanced by each task of the local band to tridiagonal reduction. (1 disables the multi-sweep mode.)");
   desc.add_options()(
       "dlaf:tridiag-rank1-nworkers", pika::program_options::value<std::size_t>(),
       "The maximum number of threads to use for computing rank1 problem solution in tridiagonal solver algorithm.");
   desc.add_options()(
       "dlaf:tridiag-rank1-barrier-busy-wait-us", pika::program_options::value<std::size_t>(),
       "The duration in microseconds to busy-wait in barriers when computing rank1 problem solution in the tridiagonal solver algorithm.");
+  desc.add_options()(
+      "dlaf:tridiag-rank1-adaptive", pika::program_options::value<bool>(),
+      "Choose the number of workers and the barrier busy-wait duration of each rank1 problem of the tridiagonal solver adaptively. (The configured values are used as upper bounds.)");
+  desc.add_options()(
+      "dlaf:bt-reduction-to-band-merge-panels", pika::program_options::value<SizeType>(),
+      "The number of consecutive panels whose HH reflectors are merged in a single block by the local back-transformation of the reduction to band. (1 disables the merging.)");
   desc.add_options()(
       "dlaf:bt-band-to-tridiag-hh-apply-group-size", pika::program_options::value<SizeType>(),
       "The application of the HH reflector is splitted in smaller applications of group size reflectors.");
+  desc.add_options()(
+      "dlaf:bt-band-to-tridiag-hh-merge-steps", pika::program_options::value<SizeType>(),
+      "The number of consecutive steps whose HH reflectors are merged in a single block by the local back-transformation of the band to tridiagonal reduction. (1 disables the merging.)");
+  desc.add_options()(
+      "dlaf:tridiag-subset-mrrr-max-fraction", pika::program_options::value<double>(),
+      "The eigenvectors of a subset of k eigenvalues of a n x n matrix are computed with MRRR instead of divide and conquer if k <= fraction * n.");
+  desc.add_options()(
+      "dlaf:tridiag-memory-lean", pika::program_options::value<bool>(),
+      "Use the memory-lean mode (one n x n workspace instead of two) of the local tridiagonal eigensolver.");
+  desc.add_options()(
+      "dlaf:cholesky-solver-keep-panels", pika::program_options::value<bool>(),
+      "Keep the panels of the factor for the backward substitution of the distributed Cholesky solver, instead of communicating them again (about n^2 / (2 P_rows) extra elements per rank).");
 
   return desc;
 }
@@ -242,9 +346,12 @@ void initialize(const pika::program_options::variables_map& vm, const configurat
   internal::updateConfiguration(vm, cfg);
   internal::getConfiguration() = cfg;
 
-  if (vm.count("dlaf:print-config") > 0) {
+  internal::printConfig() = vm.count("dlaf:print-config") > 0;
+  if (internal::printConfig()) {
     std::cout << "DLA-Future configuration options:" << std::endl;
     std::cout << cfg << std::endl;
+    std::cout << "DLA-Future tune parameters:" << std::endl;
+    std::cout << getTuneParameters() << std::endl;
     std::cout << std::endl;
   }
 
@@ -283,6 +390,13 @@ void initialize(int argc, const char* const argv[], const configuration& user_cf
 
 void finalize() {
   DLAF_ASSERT(internal::initialized(), "");
+  // Note: the choices of the adaptive tune policies are available just after the algorithms ran.
+  const auto& param = getTuneParameters();
+  if (internal::printConfig() && (param.red2band_panel_adaptive || param.tridiag_rank1_adaptive)) {
+    std::cout << "DLA-Future tune parameters (at finalization):" << std::endl;
+    std::cout << param << std::endl;
+  }
+  internal::printConfig() = false;
   internal::Init<Backend::MC>::finalize();
 #ifdef DLAF_WITH_GPU
   internal::Init<Backend::GPU>::finalize();
@@ -0,0 +1,92 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <whip.hpp>
+
+#include <dlaf/gpu/assert.cu.h>
+#include <dlaf/gpu/blas/api.h>
+#include <dlaf/lapack/gpu/conj_transpose.h>
+#include <dlaf/types.h>
+#include <dlaf/util_cublas.h>
+#include <dlaf/util_math.h>
+
+namespace dlaf::gpulapack {
+namespace kernels {
+
+using namespace dlaf::util::cuda_operators;
+
+struct ConjTransposeParams {
+  static constexpr unsigned kernel_tile_size = 32;
+  static constexpr unsigned kernel_block_rows = 8;
+};
+
+// Each block transposes a (kernel_tile_size x kernel_tile_size) kernel tile through shared memory,
+// so that both the reads of a and the writes of b are coalesced.
+template <class T>
+__global__ void conjTranspose(const unsigned m, const unsigned n, const T* a, const unsigned lda, T* b,
+                              const unsigned ldb) {
+  constexpr unsigned kernel_tile_size = ConjTransposeParams::kernel_tile_size;
+  constexpr unsigned kernel_block_rows = ConjTransposeParams::kernel_block_rows;
+
+  DLAF_GPU_ASSERT_HEAVY(kernel_tile_size == blockDim.x);
+  DLAF_GPU_ASSERT_HEAVY(kernel_block_rows == blockDim.y);
+  DLAF_GPU_ASSERT_HEAVY(1 == blockDim.z);
+  DLAF_GPU_ASSERT_HEAVY(gridDim.x == ceilDiv(m, kernel_tile_size));
+  DLAF_GPU_ASSERT_HEAVY(gridDim.y == ceilDiv(n, kernel_tile_size));
+  DLAF_GPU_ASSERT_HEAVY(1 == gridDim.z);
+
+  // Note: the additional column avoids shared memory bank conflicts.
+  __shared__ T tile[kernel_tile_size][kernel_tile_size + 1];
+
+  const unsigned i_a = blockIdx.x * kernel_tile_size + threadIdx.x;
+  for (unsigned k = threadIdx.y; k < kernel_tile_size; k += kernel_block_rows) {
+    const unsigned j_a = blockIdx.y * kernel_tile_size + k;
+    if (i_a < m && j_a < n)
+      tile[k][threadIdx.x] = a[i_a + j_a * lda];
+  }
+
+  __syncthreads();
+
+  const unsigned i_b = blockIdx.y * kernel_tile_size + threadIdx.x;
+  for (unsigned k = threadIdx.y; k < kernel_tile_size; k += kernel_block_rows) {
+    const unsigned j_b = blockIdx.x * kernel_tile_size + k;
+    if (i_b < n && j_b < m)
+      b[i_b + j_b * ldb] = conj(tile[threadIdx.x][k]);
+  }
+}
+}
+
+template <class T>
+void conjTranspose(const SizeType m, const SizeType n, const T* a, const SizeType lda, T* b,
+                   const SizeType ldb, const whip::stream_t stream) {
+  if (m == 0 || n == 0)
+    return;
+
+  DLAF_ASSERT_HEAVY(m <= lda, m, lda);
+  DLAF_ASSERT_HEAVY(n <= ldb, n, ldb);
+
+  constexpr unsigned kernel_tile_size = kernels::ConjTransposeParams::kernel_tile_size;
+  constexpr unsigned kernel_block_rows = kernels::ConjTransposeParams::kernel_block_rows;
+
+  const unsigned um = to_uint(m);
+  const unsigned un = to_uint(n);
+
+  const dim3 nr_threads(kernel_tile_size, kernel_block_rows);
+  const dim3 nr_blocks(util::ceilDiv(um, kernel_tile_size), util::ceilDiv(un, kernel_tile_size));
+  kernels::conjTranspose<<<nr_blocks, nr_threads, 0, stream>>>(um, un, util::cppToCudaCast(a),
+                                                               to_uint(lda), util::cppToCudaCast(b),
+                                                               to_uint(ldb));
+}
+
+DLAF_CUBLAS_CONJ_TRANSPOSE_ETI(, float);
+DLAF_CUBLAS_CONJ_TRANSPOSE_ETI(, double);
+DLAF_CUBLAS_CONJ_TRANSPOSE_ETI(, std::complex<float>);
+DLAF_CUBLAS_CONJ_TRANSPOSE_ETI(, std::complex<double>);
+}
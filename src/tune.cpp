@@ -8,6 +8,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <ostream>
+
+#include <dlaf/eigensolver/internal/get_red2band_panel_nworkers.h>
+#include <dlaf/eigensolver/internal/get_tridiag_rank1_nworkers.h>
 #include <dlaf/init.h>
 #include <dlaf/tune.h>
 
@@ -18,4 +22,47 @@ TuneParameters& getTuneParameters() {
   return params;
 }
 
+std::ostream& operator<<(std::ostream& os, const TuneParameters& params) {
+  using eigensolver::internal::getReductionToBandPanelPolicy;
+  using eigensolver::internal::getTridiagRank1Policy;
+
+  os << "  red2band_panel_nworkers = " << params.red2band_panel_nworkers << std::endl;
+  os << "  red2band_barrier_busy_wait_us = " << params.red2band_barrier_busy_wait_us << std::endl;
+  os << "  red2band_panel_adaptive = " << params.red2band_panel_adaptive;
+  if (params.red2band_panel_adaptive)
+    os << " (" << getReductionToBandPanelPolicy() << ")";
+  os << std::endl;
+  os << "  red2band_lookahead_depth = " << params.red2band_lookahead_depth << std::endl;
+  os << "  red2band_panel_cholqr = " << params.red2band_panel_cholqr << std::endl;
+  os << "  tridiag_rank1_nworkers = " << params.tridiag_rank1_nworkers << std::endl;
+  os << "  tridiag_rank1_barrier_busy_wait_us = " << params.tridiag_rank1_barrier_busy_wait_us
+     << std::endl;
+  os << "  tridiag_rank1_adaptive = " << params.tridiag_rank1_adaptive;
+  if (params.tridiag_rank1_adaptive)
+    os << " (" << getTridiagRank1Policy() << ")";
+  os << std::endl;
+  os << "  eigensolver_min_band = " << params.eigensolver_min_band << std::endl;
+  os << "  eigensolver_intermediate_band = " << params.eigensolver_intermediate_band << std::endl;
+  os << "  eigensolver_bt_pipeline_col_tiles = " << params.eigensolver_bt_pipeline_col_tiles
+     << std::endl;
+  os << "  eigensolver_bt_pipeline_lookahead = " << params.eigensolver_bt_pipeline_lookahead
+     << std::endl;
+  os << "  band_to_tridiag_1d_block_size_base = " << params.band_to_tridiag_1d_block_size_base
+     << std::endl;
+  os << "  band_to_tridiag_1d_min_blocks_per_rank = "
+     << params.band_to_tridiag_1d_min_blocks_per_rank << std::endl;
+  os << "  band_to_tridiag_sweeps_per_task = " << params.band_to_tridiag_sweeps_per_task << std::endl;
+  os << "  bt_reduction_to_band_merge_panels = " << params.bt_reduction_to_band_merge_panels
+     << std::endl;
+  os << "  bt_band_to_tridiag_hh_apply_group_size = "
+     << params.bt_band_to_tridiag_hh_apply_group_size << std::endl;
+  os << "  bt_band_to_tridiag_hh_merge_steps = " << params.bt_band_to_tridiag_hh_merge_steps
+     << std::endl;
+  os << "  tridiag_subset_mrrr_max_fraction = " << params.tridiag_subset_mrrr_max_fraction
+     << std::endl;
+  os << "  tridiag_memory_lean = " << params.tridiag_memory_lean << std::endl;
+  os << "  cholesky_solver_keep_panels = " << params.cholesky_solver_keep_panels << std::endl;
+  return os;
+}
+
 }
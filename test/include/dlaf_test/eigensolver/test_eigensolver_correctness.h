@@ -30,6 +30,10 @@
 
 namespace dlaf::test {
 
+/// Check the correctness of the eigenpairs of the Hermitian matrix @p reference.
+///
+/// @p eigenvectors is a M x K matrix, where K <= M, and the j-th column is checked against the
+/// eigenvalue stored in the j-th element of the K x 1 matrix @p eigenvalues.
 template <class T, Device D, class... GridIfDistributed>
 void testEigensolverCorrectness(const blas::Uplo uplo, Matrix<const T, Device::CPU>& reference,
                                 Matrix<const BaseType<T>, D>& eigenvalues,
@@ -45,6 +49,7 @@ void testEigensolverCorrectness(const blas::Uplo uplo, Matrix<const T, Device::C
     pika::threads::get_thread_manager().wait();
 
   const SizeType m = reference.size().rows();
+  const SizeType k = eigenvectors.size().cols();
 
   auto mat_a_local = allGather(blas::Uplo::General, reference, grid...);
   auto mat_evalues_local = [&]() {
@@ -56,30 +61,32 @@ void testEigensolverCorrectness(const blas::Uplo uplo, Matrix<const T, Device::C
     return allGather(blas::Uplo::General, mat_e.get(), grid...);
   }();
 
-  MatrixLocal<T> workspace({m, m}, reference.blockSize());
+  MatrixLocal<T> workspace_ortho({k, k}, reference.blockSize());
+  MatrixLocal<T> workspace({m, k}, reference.blockSize());
 
   dlaf::common::internal::SingleThreadedBlasScope single;
 
   // Check eigenvectors orthogonality (E^H E == Id)
-  blas::gemm(blas::Layout::ColMajor, blas::Op::ConjTrans, blas::Op::NoTrans, m, m, m, T{1},
+  blas::gemm(blas::Layout::ColMajor, blas::Op::ConjTrans, blas::Op::NoTrans, k, k, m, T{1},
              mat_e_local.ptr(), mat_e_local.ld(), mat_e_local.ptr(), mat_e_local.ld(), T{0},
-             workspace.ptr(), workspace.ld());
+             workspace_ortho.ptr(), workspace_ortho.ld());
 
   auto id = [](GlobalElementIndex index) {
     if (index.row() == index.col())
       return T{1};
     return T{0};
   };
-  CHECK_MATRIX_NEAR(id, workspace, m * TypeUtilities<T>::error, 10 * m * TypeUtilities<T>::error);
+  CHECK_MATRIX_NEAR(id, workspace_ortho, m * TypeUtilities<T>::error,
+                    10 * m * TypeUtilities<T>::error);
 
   // Check Ax = lambda x
   // Compute A E
-  blas::hemm(blas::Layout::ColMajor, blas::Side::Left, uplo, m, m, T{1}, mat_a_local.ptr(),
+  blas::hemm(blas::Layout::ColMajor, blas::Side::Left, uplo, m, k, T{1}, mat_a_local.ptr(),
              mat_a_local.ld(), mat_e_local.ptr(), mat_e_local.ld(), T{0}, workspace.ptr(),
              workspace.ld());
 
   // Compute Lambda E (in place in mat_e_local)
-  for (SizeType j = 0; j < m; ++j) {
+  for (SizeType j = 0; j < k; ++j) {
     blas::scal(m, mat_evalues_local({j, 0}), mat_e_local.ptr({0, j}), 1);
   }
 
@@ -87,6 +87,62 @@ auto getSubMatrixMatrixMultiplication(const SizeType a, const SizeType b,
   return std::make_tuple<>(elA, elB, elC, elR);
 }
 
+/// Returns a tuple of element generators of the matrices A, B, C and of the result of
+/// alpha op(A) op(B) + beta C, where op(A) is (m x k) and op(B) is (k x n) (m and n can be any value).
+///
+/// The elements are chosen such that:
+///   op(A)_ik = .9 * (i+1) / (k+.5) * exp(I*(2*i-k)),
+///   op(B)_kj = .8 * (k+.5) / (j+2) * exp(I*(k+j)),
+///   C_ij = 1.2 * i / (j+1) * exp(I*(-i+j)),
+/// where I = 0 for real types or I is the complex unit for complex types.
+/// Therefore the result is
+///   res_ij = beta * C_ij + gamma * (i+1) / (j+2) * exp(I*(2*i+j)),
+/// where gamma = .72 * k * alpha.
+/// Note: the generators of A and B return the elements of the stored matrices, i.e. op is taken into
+/// account.
+template <class ElementIndex, class T>
+auto getMatrixMatrixMultiplication(const blas::Op opA, const blas::Op opB, const SizeType k,
+                                   const T alpha, const T beta) {
+  using dlaf::test::TypeUtilities;
+
+  auto el_op = [](const blas::Op op, auto el_op_x) {
+    return [op, el_op_x](const ElementIndex& index) {
+      switch (op) {
+        case blas::Op::NoTrans:
+          return el_op_x(index.row(), index.col());
+        case blas::Op::Trans:
+          return el_op_x(index.col(), index.row());
+        case blas::Op::ConjTrans:
+          return dlaf::conj(el_op_x(index.col(), index.row()));
+      }
+      return T{};
+    };
+  };
+
+  auto el_a = el_op(opA, [](const double i, const double k) {
+    return TypeUtilities<T>::polar(.9 * (i + 1) / (k + .5), 2 * i - k);
+  });
+
+  auto el_b = el_op(opB, [](const double k, const double j) {
+    return TypeUtilities<T>::polar(.8 * (k + .5) / (j + 2), k + j);
+  });
+
+  auto el_c = [](const ElementIndex& index) {
+    const double i = index.row();
+    const double j = index.col();
+    return TypeUtilities<T>::polar(1.2 * i / (j + 1), -i + j);
+  };
+
+  const T gamma = TypeUtilities<T>::element(.72 * k, 0) * alpha;
+  auto res_c = [beta, gamma, el_c](const ElementIndex& index) {
+    const double i = index.row();
+    const double j = index.col();
+    return beta * el_c(index) + gamma * TypeUtilities<T>::polar((i + 1) / (j + 2), 2 * i + j);
+  };
+
+  return std::make_tuple<>(el_a, el_b, el_c, res_c);
+}
+
 template <class ElementIndex, class T>
 auto getHermitianMatrixMultiplication(const blas::Side side, const blas::Uplo uplo, const SizeType k,
                                       const T alpha, const T beta) {
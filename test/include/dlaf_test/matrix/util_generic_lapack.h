@@ -67,6 +67,46 @@ auto getCholeskySetters(blas::Uplo uplo) {
   return std::make_tuple(el_a, el_t);
 }
 
+/// Returns a tuple of element generators of three matrices A(m x m), B(m x n) and X(m x n),
+/// such that A X = B, where A is the Hermitian positive definite matrix of getCholeskySetters.
+///
+/// With r = 1 / 2 * exp(-I), the Cholesky factor of A is L = U^H, where
+/// l_ij = r^(i-j) (for i >= j).
+/// The elements of B are chosen such that Y = L^H X has all the elements of each column equal,
+/// y_ij = c_j = (j+1) * exp(-I * 2/5 * j), i.e.
+/// b_ij = Sum_k(l_ik * c_j) = c_j * (1 - r^(i+1)) / (1 - r), where k = 0 .. i
+/// Therefore,
+/// x_ij = c_j * (1 - conj(r)) if i < m - 1,
+/// x_ij = c_j                 if i = m - 1,
+/// where I = 0 for real types or I is the complex unit for complex types.
+template <class ElementIndex, class T>
+auto getCholeskySolverSetters(blas::Uplo uplo, SizeType m) {
+  using dlaf::test::TypeUtilities;
+
+  auto el_a = std::get<0>(getCholeskySetters<ElementIndex, T>(uplo));
+
+  auto c = [](const double j) { return TypeUtilities<T>::polar(j + 1, -.4 * j); };
+
+  std::function<T(const ElementIndex&)> el_b = [c](const ElementIndex& index) {
+    const double i = index.row();
+    const double j = index.col();
+
+    return c(j) * (T(1) - TypeUtilities<T>::polar(std::exp2(-(i + 1)), -(i + 1))) /
+           (T(1) - TypeUtilities<T>::polar(.5, -1));
+  };
+
+  // Analytical results
+  std::function<T(const ElementIndex&)> res_x = [c, m](const ElementIndex& index) {
+    const double j = index.col();
+
+    if (index.row() == m - 1)
+      return c(j);
+    return c(j) * (T(1) - TypeUtilities<T>::polar(.5, 1));
+  };
+
+  return std::make_tuple(el_a, el_b, res_x);
+}
+
 /// Returns a tuple of element generators of three matrices T (n x n), A(n x n) and B (n x n).
 /// It holds, for @p itype == 1
 /// B = U^(-H) A U^(-1), if @p uplo == Upper,
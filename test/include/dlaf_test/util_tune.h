@@ -0,0 +1,46 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <type_traits>
+
+#include <dlaf/tune.h>
+
+namespace dlaf {
+namespace test {
+
+/// Sets a tune parameter for the lifetime of the object and restores its previous value on destruction,
+/// such that the value configured by the user (environment or command line) is not lost and the
+/// following tests are not affected, even if the test exits early.
+///
+/// Example: ScopedTuneParameter guard(&TuneParameters::tridiag_memory_lean, true);
+template <class Param>
+class [[nodiscard]] ScopedTuneParameter {
+public:
+  ScopedTuneParameter(Param TuneParameters::*param, const std::common_type_t<Param>& value)
+      : param_(param), old_value_(getTuneParameters().*param) {
+    getTuneParameters().*param_ = value;
+  }
+
+  ~ScopedTuneParameter() {
+    getTuneParameters().*param_ = old_value_;
+  }
+
+  ScopedTuneParameter(const ScopedTuneParameter&) = delete;
+  ScopedTuneParameter& operator=(const ScopedTuneParameter&) = delete;
+
+private:
+  Param TuneParameters::*param_;
+  Param old_value_;
+};
+
+}
+}
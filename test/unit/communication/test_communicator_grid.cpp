@@ -249,3 +249,40 @@ TEST_P(CommunicatorGridTest, Rank) {
 }
 
 INSTANTIATE_TEST_SUITE_P(Rank, CommunicatorGridTest, valid_orderings);
+
+TEST_P(CommunicatorGridTest, Layers) {
+  static_assert(NUM_MPI_RANKS % 2 == 0, "The number of ranks must be even");
+
+  const int nlayers = 2;
+  auto grid_dims = computeGridDims(NUM_MPI_RANKS / nlayers);
+
+  Communicator world(MPI_COMM_WORLD);
+  CommunicatorGridLayers layers(world, nlayers, grid_dims[0], grid_dims[1], GetParam());
+
+  const int grid_area = grid_dims[0] * grid_dims[1];
+
+  EXPECT_EQ(nlayers, layers.nrLayers());
+  EXPECT_EQ(world.rank() / grid_area, layers.layer());
+
+  EXPECT_NE(MPI_COMM_NULL, layers.layersCommunicator());
+  EXPECT_EQ(nlayers, layers.layersCommunicator().size());
+  EXPECT_EQ(layers.layer(), layers.layersCommunicator().rank());
+
+  auto& grid = layers.grid();
+  EXPECT_EQ(grid_dims[0], grid.size().rows());
+  EXPECT_EQ(grid_dims[1], grid.size().cols());
+
+  auto coords = dlaf::common::computeCoords(GetParam(), world.rank() % grid_area, Size2D(grid_dims));
+  EXPECT_EQ(coords.row(), grid.rank().row());
+  EXPECT_EQ(coords.col(), grid.rank().col());
+
+  test_grid_communication(grid);
+
+  // ranks with the same position in all the layers
+  std::array<int, 2> position{grid.rank().row(), grid.rank().col()};
+  std::array<int, 2> position_root = position;
+  DLAF_MPI_CHECK_ERROR(MPI_Bcast(position_root.data(), 2, MPI_INT, 0, layers.layersCommunicator()));
+  EXPECT_EQ(position, position_root);
+}
+
+INSTANTIATE_TEST_SUITE_P(Layers, CommunicatorGridTest, valid_orderings);
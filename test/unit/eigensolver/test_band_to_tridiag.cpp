@@ -8,13 +8,19 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <cmath>
+#include <cstdlib>
 #include <exception>
 #include <functional>
 #include <sstream>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <dlaf/common/single_threaded_blas.h>
 #include <dlaf/eigensolver/band_to_tridiag.h>
+#include <dlaf/eigensolver/band_to_tridiag/kernels.h>
+#include <dlaf/eigensolver/bt_band_to_tridiag.h>
 #include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_mirror.h>
@@ -28,6 +34,7 @@
 #include <dlaf_test/matrix/util_generic_lapack.h>
 #include <dlaf_test/matrix/util_matrix.h>
 #include <dlaf_test/matrix/util_matrix_local.h>
+#include <dlaf_test/util_tune.h>
 #include <dlaf_test/util_types.h>
 
 using namespace dlaf;
@@ -55,6 +62,15 @@ const std::vector<std::tuple<SizeType, SizeType, SizeType, SizeType>> sizes = {
     {18, 4, 8, 4}, {34, 6, 18, 6}, {37, 9, 9, 3}     // m != mb
 };
 
+const std::vector<std::tuple<SizeType, SizeType, SizeType, SizeType>> sizes_band_to_band = {
+    // {m, mb, band_size, band_size_out}
+    {0, 4, 4, 2},                                                    // m = 0
+    {1, 4, 4, 2},   {3, 4, 4, 2},                                    // m < mb
+    {8, 8, 8, 4},   {8, 4, 4, 2},                                    // m = mb, m != mb
+    {16, 12, 6, 2}, {17, 12, 6, 3}, {34, 6, 6, 3}, {37, 9, 9, 3},  // m != mb
+    {41, 8, 8, 2},  {40, 12, 12, 4}                                  // m != mb
+};
+
 template <class T, class... GridIfDistributed>
 void testBandToTridiagOutputCorrectness(const blas::Uplo uplo, const SizeType band_size,
                                         const SizeType m, const SizeType mb,
@@ -165,6 +181,111 @@ void testBandToTridiag(CommunicatorGrid grid, blas::Uplo uplo, const SizeType ba
   testBandToTridiagOutputCorrectness(uplo, band_size, m, mb, mat_a_h, mat_trid, mat_v, grid);
 }
 
+// Returns the elements of the Hermitian band matrix with the given band_size, whose lower triangular
+// part is stored in mat.
+template <class T>
+auto hermitianBand(const MatrixLocal<T>& mat, const SizeType band_size) {
+  return [&mat, band_size](const GlobalElementIndex& index) {
+    const SizeType diag_index = index.row() - index.col();
+    if (std::abs(diag_index) > band_size)
+      return T{0};
+    if (diag_index >= 0)
+      return mat(index);
+    return dlaf::conj(mat(transposed(index)));
+  };
+}
+
+template <Device D, class T>
+void testBandToBand(const SizeType band_size, const SizeType band_size_out, const SizeType m,
+                    const SizeType mb) {
+  const LocalElementSize size(m, m);
+  const TileElementSize block_size(mb, mb);
+
+  Matrix<T, Device::CPU> mat_a_h(size, block_size);
+  matrix::util::set_random_hermitian(mat_a_h);
+
+  auto [mat_band, mat_v] = [&]() {
+    MatrixMirror<const T, D, Device::CPU> mat_a(mat_a_h);
+    return eigensolver::bandToBand<Backend::MC>(blas::Uplo::Lower, band_size, band_size_out,
+                                                mat_a.get());
+  }();
+
+  if (m == 0)
+    return;
+
+  auto mat_a_local = allGather(blas::Uplo::Lower, mat_a_h);
+  auto mat_band_local = allGather(blas::Uplo::Lower, mat_band);
+
+  // Check that Q B Q^H = A, where B is the Hermitian band matrix with band size band_size_out returned
+  // and A is the Hermitian band matrix with band size band_size stored in mat_a.
+  // Q B Q^H is computed as Q (Q B)^H, as B is Hermitian.
+  Matrix<T, Device::CPU> mat_res(size, block_size);
+  set(mat_res, hermitianBand(mat_band_local, band_size_out));
+  eigensolver::backTransformationBandToBand<Backend::MC>(band_size, band_size_out, mat_res, mat_v);
+
+  auto mat_res_local = allGather(blas::Uplo::General, mat_res);
+  set(mat_res, [&mat_res_local](const GlobalElementIndex& index) {
+    return dlaf::conj(mat_res_local(transposed(index)));
+  });
+  eigensolver::backTransformationBandToBand<Backend::MC>(band_size, band_size_out, mat_res, mat_v);
+
+  SCOPED_TRACE(::testing::Message() << "size " << m << ", block " << mb << ", band " << band_size
+                                    << ", band_out " << band_size_out);
+
+  CHECK_MATRIX_NEAR(hermitianBand(mat_a_local, band_size), mat_res, mb * m * TypeUtilities<T>::error,
+                    m * TypeUtilities<T>::error);
+}
+
+template <class T>
+void testHHKernels(const SizeType m, const SizeType n) {
+  using namespace dlaf::eigensolver::internal;
+  const SizeType lda = 2 * std::max(m, n) + 1;
+
+  std::vector<T> a(to_sizet(lda * n));
+  for (std::size_t i = 0; i < a.size(); ++i)
+    a[i] = TypeUtilities<T>::element(std::sin(i), std::cos(3 * i));
+  std::vector<T> v(to_sizet(std::max(m, n)));
+  for (std::size_t i = 0; i < v.size(); ++i)
+    v[i] = TypeUtilities<T>::element(std::cos(i), std::sin(5 * i));
+  const T tau = TypeUtilities<T>::element(1.3, -.2);
+  std::vector<T> w(to_sizet(lda));
+
+  auto check = [&](auto&& apply_blas, auto&& apply_fused) {
+    std::vector<T> a_blas = a;
+    std::vector<T> a_fused = a;
+    apply_blas(a_blas.data());
+    apply_fused(a_fused.data());
+    for (std::size_t i = 0; i < a.size(); ++i)
+      EXPECT_NEAR(0, std::abs(a_blas[i] - a_fused[i]), 10 * (m + n) * TypeUtilities<T>::error) << i;
+  };
+
+  SCOPED_TRACE(::testing::Message() << "m " << m << ", n " << n);
+  check([&](T* a) { applyHHLeftRightHermBlas(n, tau, v.data(), a, lda, w.data()); },
+        [&](T* a) { applyHHLeftRightHermFused(n, tau, v.data(), a, lda, w.data()); });
+  check([&](T* a) { applyHHLeftBlas(m, n, tau, v.data(), a, lda, w.data()); },
+        [&](T* a) { applyHHLeftFused(m, n, tau, v.data(), a, lda, w.data()); });
+  check([&](T* a) { applyHHRightBlas(m, n, tau, v.data(), a, lda, w.data()); },
+        [&](T* a) { applyHHRightFused(m, n, tau, v.data(), a, lda, w.data()); });
+}
+
+TYPED_TEST(EigensolverBandToTridiagTest, HHKernels) {
+  for (const auto& [m, n] : std::vector<std::pair<SizeType, SizeType>>{
+           {0, 0}, {1, 1}, {3, 2}, {2, 7}, {8, 8}, {17, 13}, {32, 31}, {64, 64}})
+    testHHKernels<TypeParam>(m, n);
+}
+
+TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessBandToBandLocalFromCPU) {
+  for (const auto& [m, mb, b, b_out] : sizes_band_to_band)
+    testBandToBand<Device::CPU, TypeParam>(b, b_out, m, mb);
+}
+
+#ifdef DLAF_WITH_GPU
+TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessBandToBandLocalFromGPU) {
+  for (const auto& [m, mb, b, b_out] : sizes_band_to_band)
+    testBandToBand<Device::GPU, TypeParam>(b, b_out, m, mb);
+}
+#endif
+
 TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessLocalFromCPU) {
   const blas::Uplo uplo = blas::Uplo::Lower;
 
@@ -174,6 +295,19 @@ TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessLocalFromCPU) {
   }
 }
 
+TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessLocalMultiSweepFromCPU) {
+  const blas::Uplo uplo = blas::Uplo::Lower;
+
+  for (const SizeType sweeps_per_task : {2, 3, 8}) {
+    const ScopedTuneParameter sweeps_guard(&TuneParameters::band_to_tridiag_sweeps_per_task,
+                                           sweeps_per_task);
+    for (const auto& [m, mb, mb_1d, b] : sizes) {
+      getTuneParameters().band_to_tridiag_1d_block_size_base = mb_1d;
+      testBandToTridiag<Device::CPU, TypeParam>(uplo, b, m, mb);
+    }
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessLocalFromGPU) {
   const blas::Uplo uplo = blas::Uplo::Lower;
@@ -196,6 +330,22 @@ TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessDistributed) {
   }
 }
 
+TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessDistributedRoundRobin) {
+  const blas::Uplo uplo = blas::Uplo::Lower;
+
+  // The 1D block size is determined by the minimum number of blocks per rank.
+  const ScopedTuneParameter base_guard(&TuneParameters::band_to_tridiag_1d_block_size_base, 8192);
+  for (const SizeType min_blocks : {1, 2, 3}) {
+    const ScopedTuneParameter min_blocks_guard(&TuneParameters::band_to_tridiag_1d_min_blocks_per_rank,
+                                               min_blocks);
+    for (const auto& comm_grid : this->commGrids()) {
+      for (const auto& [m, mb, mb_1d, b] : sizes) {
+        testBandToTridiag<Device::CPU, TypeParam>(comm_grid, uplo, b, m, mb);
+      }
+    }
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessDistributedFromGPU) {
   const blas::Uplo uplo = blas::Uplo::Lower;
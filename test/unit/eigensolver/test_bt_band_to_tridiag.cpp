@@ -25,6 +25,7 @@
 #include <dlaf_test/matrix/matrix_local.h>
 #include <dlaf_test/matrix/util_matrix.h>
 #include <dlaf_test/matrix/util_matrix_local.h>
+#include <dlaf_test/util_tune.h>
 #include <dlaf_test/util_types.h>
 
 using namespace dlaf;
@@ -303,6 +304,22 @@ TYPED_TEST(BacktransformationBandToTridiagTestMC, CorrectnessLocalSubBand) {
   }
 }
 
+std::vector<config_t> configs_merged{
+    {12, 12, 4, 4, 4, 2}, {13, 7, 8, 4, 8, 2},   {25, 10, 9, 5, 9, 3},
+    {17, 17, 6, 6, 6, 2}, {40, 13, 12, 5, 12, 3}, {7, 7, 16, 16, 16, 4},
+};
+
+TYPED_TEST(BacktransformationBandToTridiagTestMC, CorrectnessLocalMergedSteps) {
+  for (const SizeType merge_steps : {2, 4}) {
+    const ScopedTuneParameter steps_guard(&TuneParameters::bt_band_to_tridiag_hh_merge_steps,
+                                          merge_steps);
+    for (const auto& [m, n, mb, nb, group_size, b] : configs_merged) {
+      getTuneParameters().bt_band_to_tridiag_hh_apply_group_size = group_size;
+      testBacktransformation<Backend::MC, Device::CPU, TypeParam>(m, n, mb, nb, b);
+    }
+  }
+}
+
 TYPED_TEST(BacktransformationBandToTridiagTestMC, CorrectnessDistributedSubBand) {
   for (const auto& comm_grid : this->commGrids()) {
     for (const auto& [m, n, mb, nb, group_size, b] : configs_subband) {
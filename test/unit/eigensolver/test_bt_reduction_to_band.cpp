@@ -23,6 +23,7 @@
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_base.h>
 #include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/tune.h>
 #include <dlaf/types.h>
 #include <dlaf/util_matrix.h>
 
@@ -31,6 +32,7 @@
 #include <dlaf_test/comm_grids/grids_6_ranks.h>
 #include <dlaf_test/matrix/util_matrix.h>
 #include <dlaf_test/matrix/util_matrix_local.h>
+#include <dlaf_test/util_tune.h>
 #include <dlaf_test/util_types.h>
 
 using namespace dlaf;
@@ -241,6 +243,28 @@ TYPED_TEST(BackTransformationReductionToBandEigenSolverTestGPU, CorrectnessLocal
 }
 #endif
 
+TYPED_TEST(BackTransformationReductionToBandEigenSolverTestMC, CorrectnessLocalMergedPanels) {
+  for (const SizeType merge_panels : {2, 3}) {
+    const ScopedTuneParameter panels_guard(&TuneParameters::bt_reduction_to_band_merge_panels,
+                                           merge_panels);
+    for (const auto& [m, n, mb, nb, b] : sizes) {
+      testBackTransformationReductionToBand<TypeParam, Backend::MC, Device::CPU>(m, n, mb, nb, b);
+    }
+  }
+}
+
+#ifdef DLAF_WITH_GPU
+TYPED_TEST(BackTransformationReductionToBandEigenSolverTestGPU, CorrectnessLocalMergedPanels) {
+  for (const SizeType merge_panels : {2, 3}) {
+    const ScopedTuneParameter panels_guard(&TuneParameters::bt_reduction_to_band_merge_panels,
+                                           merge_panels);
+    for (const auto& [m, n, mb, nb, b] : sizes) {
+      testBackTransformationReductionToBand<TypeParam, Backend::GPU, Device::GPU>(m, n, mb, nb, b);
+    }
+  }
+}
+#endif
+
 TYPED_TEST(BackTransformationReductionToBandEigenSolverTestMC, CorrectnessDistributed) {
   for (const auto& comm_grid : this->commGrids()) {
     for (const auto& [m, n, mb, nb, b] : sizes) {
@@ -9,7 +9,9 @@
 //
 
 #include <functional>
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/eigensolver/eigensolver.h>
@@ -19,6 +21,7 @@
 #include <dlaf/matrix/matrix_mirror.h>
 #include <dlaf/tune.h>
 #include <dlaf/types.h>
+#include <dlaf/util_matrix.h>
 
 #include <gtest/gtest.h>
 
@@ -27,6 +30,7 @@
 #include <dlaf_test/matrix/matrix_local.h>
 #include <dlaf_test/matrix/util_matrix.h>
 #include <dlaf_test/matrix/util_matrix_local.h>
+#include <dlaf_test/util_tune.h>
 #include <dlaf_test/util_types.h>
 
 using namespace dlaf;
@@ -56,7 +60,7 @@ TYPED_TEST_SUITE(EigensolverTestGPU, MatrixElementTypes);
 
 enum class Allocation { use_preallocated, do_allocation };
 
-const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower});
+const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower, blas::Uplo::Upper});
 
 const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
     // {m, mb, eigensolver_min_band}
@@ -66,24 +70,30 @@ const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
     {34, 8, 3},  {32, 6, 3}                                   // m > mb, sub-band
 };
 
+// Returns a random Hermitian m x m matrix (distributed on @p grid if given), used as reference.
+template <class T, class... GridIfDistributed>
+Matrix<T, Device::CPU> createReferenceMatrix(const SizeType m, const SizeType mb,
+                                             GridIfDistributed... grid) {
+  constexpr bool isDistributed = (sizeof...(grid) == 1);
+  const TileElementSize block_size(mb, mb);
+
+  auto reference = [&]() -> auto{
+    if constexpr (isDistributed)
+      return Matrix<T, Device::CPU>(GlobalElementSize(m, m), block_size, grid...);
+    else
+      return Matrix<T, Device::CPU>(LocalElementSize(m, m), block_size);
+  }
+  ();
+  matrix::util::set_random_hermitian(reference);
+  return reference;
+}
+
 template <class T, Backend B, Device D, Allocation allocation, class... GridIfDistributed>
 void testEigensolver(const blas::Uplo uplo, const SizeType m, const SizeType mb,
                      GridIfDistributed... grid) {
   constexpr bool isDistributed = (sizeof...(grid) == 1);
-  const LocalElementSize size(m, m);
-  const TileElementSize block_size(mb, mb);
 
-  Matrix<const T, Device::CPU> reference = [&]() {
-    auto reference = [&]() -> auto{
-      if constexpr (isDistributed)
-        return Matrix<T, Device::CPU>(GlobalElementSize(m, m), block_size, grid...);
-      else
-        return Matrix<T, Device::CPU>(LocalElementSize(m, m), block_size);
-    }
-    ();
-    matrix::util::set_random_hermitian(reference);
-    return reference;
-  }();
+  Matrix<const T, Device::CPU> reference = createReferenceMatrix<T>(m, mb, grid...);
 
   Matrix<T, Device::CPU> mat_a_h(reference.distribution());
   copy(reference, mat_a_h);
@@ -122,6 +132,204 @@ void testEigensolver(const blas::Uplo uplo, const SizeType m, const SizeType mb,
   testEigensolverCorrectness(uplo, reference, ret.eigenvalues, ret.eigenvectors, grid...);
 }
 
+// Ranges of eigenvalue indices [begin, end) given as fractions of m, so that they can be used with all
+// the sizes.
+const std::vector<std::tuple<double, double>> eval_ranges = {
+    {0., 0.},    // empty range
+    {0., .25},   // lower end of the spectrum
+    {.3, .65},   // interior of the spectrum (not aligned to tiles)
+    {.5, 1.},    // upper end of the spectrum
+};
+
+// Values of tridiag_subset_mrrr_max_fraction, used to test both the D&C (0) and MRRR (1) tridiagonal
+// solvers.
+const std::vector<double> mrrr_fractions = {0., 1.};
+
+template <class T, Backend B, Device D, class... GridIfDistributed>
+void testEigensolverSubset(const blas::Uplo uplo, const SizeType m, const SizeType mb,
+                           const SizeType eval_idx_begin, const SizeType eval_idx_end,
+                           GridIfDistributed... grid) {
+  const SizeType k = eval_idx_end - eval_idx_begin;
+
+  Matrix<const T, Device::CPU> reference = createReferenceMatrix<T>(m, mb, grid...);
+
+  Matrix<T, Device::CPU> mat_a_h(reference.distribution());
+  copy(reference, mat_a_h);
+
+  eigensolver::EigensolverResult<T, D> ret = [&]() {
+    MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+    return eigensolver::eigensolver<B>(grid..., uplo, mat_a.get(), eval_idx_begin, eval_idx_end);
+  }();
+
+  ASSERT_EQ(ret.eigenvalues.size(), GlobalElementSize(m, 1));
+  ASSERT_EQ(ret.eigenvectors.size(), GlobalElementSize(m, k));
+
+  if (k == 0)
+    return;
+
+  // Extract the eigenvalues corresponding to the computed eigenvectors.
+  Matrix<BaseType<T>, D> eigenvalues_subset = [&]() {
+    MatrixMirror<const BaseType<T>, Device::CPU, D> mat_evals(ret.eigenvalues);
+    const auto evals = allGather(blas::Uplo::General, mat_evals.get());
+
+    Matrix<BaseType<T>, Device::CPU> evals_subset_h(LocalElementSize(k, 1), TileElementSize(mb, 1));
+    matrix::util::set(evals_subset_h, [&](const GlobalElementIndex& index) {
+      return evals({eval_idx_begin + index.row(), 0});
+    });
+
+    Matrix<BaseType<T>, D> evals_subset(evals_subset_h.distribution());
+    copy(evals_subset_h, evals_subset);
+    return evals_subset;
+  }();
+
+  testEigensolverCorrectness(uplo, reference, eigenvalues_subset, ret.eigenvectors, grid...);
+}
+
+template <class T, Backend B, Device D, class... GridIfDistributed>
+void testEigensolverValuesOnly(const blas::Uplo uplo, const SizeType m, const SizeType mb,
+                               GridIfDistributed... grid) {
+  Matrix<const T, Device::CPU> reference = createReferenceMatrix<T>(m, mb, grid...);
+
+  // Reference eigenvalues computed together with the eigenvectors.
+  Matrix<T, Device::CPU> mat_a_h(reference.distribution());
+  copy(reference, mat_a_h);
+
+  eigensolver::EigensolverResult<T, D> ret = [&]() {
+    MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+    return eigensolver::eigensolver<B>(grid..., uplo, mat_a.get());
+  }();
+
+  copy(reference, mat_a_h);
+
+  Matrix<BaseType<T>, Device::CPU> eigenvalues(LocalElementSize(m, 1), TileElementSize(mb, 1));
+  {
+    MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+    MatrixMirror<BaseType<T>, D, Device::CPU> evals(eigenvalues);
+    eigensolver::eigensolver<B>(grid..., uplo, mat_a.get(), evals.get());
+  }
+
+  if (m == 0)
+    return;
+
+  MatrixMirror<const BaseType<T>, Device::CPU, D> expected(ret.eigenvalues);
+  const auto expected_local = allGather(blas::Uplo::General, expected.get());
+  auto expected_fn = [&](const GlobalElementIndex& index) { return expected_local(index); };
+
+  CHECK_MATRIX_NEAR(expected_fn, eigenvalues, 2 * m * TypeUtilities<T>::error,
+                    2 * m * TypeUtilities<T>::error);
+}
+
+template <class T, Backend B, Device D, class... GridIfDistributed>
+void testEigensolverPlan(const blas::Uplo uplo, const SizeType m, const SizeType mb,
+                         GridIfDistributed... grid) {
+  Matrix<const T, Device::CPU> reference = createReferenceMatrix<T>(m, mb, grid...);
+
+  Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(m, 1), TileElementSize(mb, 1));
+  Matrix<T, D> eigenvectors(reference.distribution());
+
+  eigensolver::EigensolverPlan<T, D> plan(grid..., eigenvectors.distribution());
+
+  // The same plan is used multiple times, checking that the workspaces can be re-used.
+  for (int run = 0; run < 2; ++run) {
+    Matrix<T, Device::CPU> mat_a_h(reference.distribution());
+    copy(reference, mat_a_h);
+
+    {
+      MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+      eigensolver::eigensolver<B>(grid..., plan, uplo, mat_a.get(), eigenvalues, eigenvectors);
+    }
+
+    if (m == 0)
+      return;
+
+    testEigensolverCorrectness(uplo, reference, eigenvalues, eigenvectors, grid...);
+  }
+}
+
+void checkEigensolverReport(const std::vector<std::string>& stages,
+                            const eigensolver::EigensolverReport& report, const bool is_distributed) {
+  ASSERT_EQ(stages.size(), report.stages.size());
+  for (std::size_t i = 0; i < stages.size(); ++i) {
+    EXPECT_EQ(stages[i], report.stages[i].name);
+    EXPECT_GE(report.stages[i].time, 0);
+    EXPECT_GE(report.stages[i].flops, 0);
+    EXPECT_GE(report.stages[i].estimated_bytes, 0);
+    if (!is_distributed)
+      EXPECT_EQ(0, report.stages[i].estimated_bytes);
+  }
+}
+
+template <class T, Backend B, Device D, class... GridIfDistributed>
+void testEigensolverReport(const blas::Uplo uplo, const SizeType m, const SizeType mb,
+                           GridIfDistributed... grid) {
+  constexpr bool isDistributed = (sizeof...(grid) == 1);
+
+  Matrix<const T, Device::CPU> reference = createReferenceMatrix<T>(m, mb, grid...);
+
+  Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(m, 1), TileElementSize(mb, 1));
+  Matrix<T, D> eigenvectors(reference.distribution());
+
+  eigensolver::EigensolverPlan<T, D> plan(grid..., eigenvectors.distribution());
+  Matrix<T, Device::CPU> mat_a_h(reference.distribution());
+
+  // All the eigenvectors
+  {
+    eigensolver::EigensolverReport report;
+    copy(reference, mat_a_h);
+    {
+      MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+      eigensolver::eigensolver<B>(grid..., plan, uplo, mat_a.get(), eigenvalues, eigenvectors,
+                                  &report);
+    }
+    eigenvectors.waitLocalTiles();
+
+    checkEigensolverReport({"red2band", "band2trid", "tridiag", "bt_band2trid", "bt_red2band"}, report,
+                           isDistributed);
+
+    if (m != 0)
+      testEigensolverCorrectness(uplo, reference, eigenvalues, eigenvectors, grid...);
+  }
+
+  // Subset of the eigenvectors
+  {
+    const SizeType eval_idx_begin = m / 4;
+    const SizeType eval_idx_end = m / 2;
+    Matrix<T, D> eigenvectors_subset = [&]() {
+      if constexpr (isDistributed)
+        return Matrix<T, D>(GlobalElementSize(m, eval_idx_end - eval_idx_begin),
+                            TileElementSize(mb, mb), grid...);
+      else
+        return Matrix<T, D>(LocalElementSize(m, eval_idx_end - eval_idx_begin),
+                            TileElementSize(mb, mb));
+    }();
+
+    eigensolver::EigensolverReport report;
+    copy(reference, mat_a_h);
+    {
+      MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+      eigensolver::eigensolver<B>(grid..., plan, uplo, mat_a.get(), eigenvalues, eigenvectors_subset,
+                                  eval_idx_begin, eval_idx_end, &report);
+    }
+    eigenvectors_subset.waitLocalTiles();
+
+    checkEigensolverReport({"red2band", "band2trid", "tridiag", "bt_band2trid", "bt_red2band"}, report,
+                           isDistributed);
+  }
+
+  // Eigenvalues only
+  {
+    eigensolver::EigensolverReport report;
+    copy(reference, mat_a_h);
+    {
+      MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+      eigensolver::eigensolver<B>(grid..., uplo, mat_a.get(), eigenvalues, &report);
+    }
+    eigenvalues.waitLocalTiles();
+
+    checkEigensolverReport({"red2band", "band2trid", "tridiag"}, report, isDistributed);
+  }
+}
+
 TYPED_TEST(EigensolverTestMC, CorrectnessLocal) {
   for (auto uplo : blas_uplos) {
     for (auto [m, mb, b_min] : sizes) {
@@ -132,6 +340,43 @@ TYPED_TEST(EigensolverTestMC, CorrectnessLocal) {
   }
 }
 
+TYPED_TEST(EigensolverTestMC, CorrectnessLocalIntermediateBand) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      const ScopedTuneParameter band_guard(&TuneParameters::eigensolver_intermediate_band, 2);
+      testEigensolver<TypeParam, Backend::MC, Device::CPU, Allocation::do_allocation>(uplo, m, mb);
+      testEigensolverValuesOnly<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, CorrectnessLocalPipelinedBackTransformations) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      for (const SizeType col_tiles : {1, 2}) {
+        const ScopedTuneParameter col_tiles_guard(&TuneParameters::eigensolver_bt_pipeline_col_tiles,
+                                                  col_tiles);
+        const ScopedTuneParameter lookahead_guard(&TuneParameters::eigensolver_bt_pipeline_lookahead,
+                                                  col_tiles);
+        testEigensolver<TypeParam, Backend::MC, Device::CPU, Allocation::do_allocation>(uplo, m, mb);
+        {
+          const ScopedTuneParameter band_guard(&TuneParameters::eigensolver_intermediate_band, 2);
+          testEigensolver<TypeParam, Backend::MC, Device::CPU, Allocation::do_allocation>(uplo, m, mb);
+        }
+
+        // Merged blocks of HH reflectors
+        {
+          const ScopedTuneParameter steps_guard(&TuneParameters::bt_band_to_tridiag_hh_merge_steps, 2);
+          const ScopedTuneParameter panels_guard(&TuneParameters::bt_reduction_to_band_merge_panels, 2);
+          testEigensolver<TypeParam, Backend::MC, Device::CPU, Allocation::do_allocation>(uplo, m, mb);
+        }
+      }
+    }
+  }
+}
+
 TYPED_TEST(EigensolverTestMC, CorrectnessDistributed) {
   for (const comm::CommunicatorGrid& grid : this->commGrids()) {
     for (auto uplo : blas_uplos) {
@@ -146,6 +391,104 @@ TYPED_TEST(EigensolverTestMC, CorrectnessDistributed) {
   }
 }
 
+TYPED_TEST(EigensolverTestMC, CorrectnessSubsetLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      for (auto [begin, end] : eval_ranges) {
+        const auto eval_idx_begin = static_cast<SizeType>(begin * m);
+        const auto eval_idx_end = static_cast<SizeType>(end * m);
+        for (auto mrrr_fraction : mrrr_fractions) {
+          const ScopedTuneParameter mrrr_guard(&TuneParameters::tridiag_subset_mrrr_max_fraction,
+                                               mrrr_fraction);
+          testEigensolverSubset<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb, eval_idx_begin,
+                                                                     eval_idx_end);
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, CorrectnessSubsetDistributed) {
+  for (const comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        for (auto [begin, end] : eval_ranges) {
+          const auto eval_idx_begin = static_cast<SizeType>(begin * m);
+          const auto eval_idx_end = static_cast<SizeType>(end * m);
+          for (auto mrrr_fraction : mrrr_fractions) {
+            const ScopedTuneParameter mrrr_guard(&TuneParameters::tridiag_subset_mrrr_max_fraction,
+                                                 mrrr_fraction);
+            testEigensolverSubset<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb, eval_idx_begin,
+                                                                       eval_idx_end, grid);
+          }
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, PlanReuseLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      testEigensolverPlan<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, PlanReuseDistributed) {
+  for (const comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testEigensolverPlan<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb, grid);
+      }
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, StageReportLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      testEigensolverReport<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, StageReportDistributed) {
+  for (const comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testEigensolverReport<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb, grid);
+      }
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, ValuesOnlyLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      testEigensolverValuesOnly<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, ValuesOnlyDistributed) {
+  for (const comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testEigensolverValuesOnly<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb, grid);
+      }
+    }
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(EigensolverTestGPU, CorrectnessLocal) {
   for (auto uplo : blas_uplos) {
@@ -170,4 +513,82 @@ TYPED_TEST(EigensolverTestGPU, CorrectnessDistributed) {
     }
   }
 }
+
+TYPED_TEST(EigensolverTestGPU, CorrectnessSubsetLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      for (auto [begin, end] : eval_ranges) {
+        const auto eval_idx_begin = static_cast<SizeType>(begin * m);
+        const auto eval_idx_end = static_cast<SizeType>(end * m);
+        for (auto mrrr_fraction : mrrr_fractions) {
+          const ScopedTuneParameter mrrr_guard(&TuneParameters::tridiag_subset_mrrr_max_fraction,
+                                               mrrr_fraction);
+          testEigensolverSubset<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb, eval_idx_begin,
+                                                                      eval_idx_end);
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, CorrectnessSubsetDistributed) {
+  for (const comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        for (auto [begin, end] : eval_ranges) {
+          const auto eval_idx_begin = static_cast<SizeType>(begin * m);
+          const auto eval_idx_end = static_cast<SizeType>(end * m);
+          for (auto mrrr_fraction : mrrr_fractions) {
+            const ScopedTuneParameter mrrr_guard(&TuneParameters::tridiag_subset_mrrr_max_fraction,
+                                                 mrrr_fraction);
+            testEigensolverSubset<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb, eval_idx_begin,
+                                                                        eval_idx_end, grid);
+          }
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, PlanReuseLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      testEigensolverPlan<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, PlanReuseDistributed) {
+  for (const comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testEigensolverPlan<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb, grid);
+      }
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, ValuesOnlyLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      testEigensolverValuesOnly<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, ValuesOnlyDistributed) {
+  for (const comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testEigensolverValuesOnly<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb, grid);
+      }
+    }
+  }
+}
 #endif
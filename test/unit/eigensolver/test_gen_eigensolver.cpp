@@ -54,7 +54,7 @@ TYPED_TEST_SUITE(GenEigensolverTestGPU, MatrixElementTypes);
 
 enum class Allocation { do_allocation, use_preallocated };
 
-const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower});
+const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower, blas::Uplo::Upper});
 
 const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
     // {m, mb, eigensolver_min_band}
@@ -193,6 +193,58 @@ void testGenEigensolver(const blas::Uplo uplo, const SizeType m, const SizeType
   testGenEigensolverCorrectness(uplo, reference_a, reference_b, ret, grid...);
 }
 
+template <class T, Backend B, Device D, class... GridIfDistributed>
+void testGenEigensolverFactorized(const blas::Uplo uplo, const SizeType m, const SizeType mb,
+                                  GridIfDistributed... grid) {
+  constexpr bool isDistributed = (sizeof...(grid) == 1);
+
+  const TileElementSize block_size(mb, mb);
+
+  auto create_reference = [&]() -> auto{
+    if constexpr (isDistributed)
+      return Matrix<T, Device::CPU>(GlobalElementSize(m, m), block_size, grid...);
+    else
+      return Matrix<T, Device::CPU>(LocalElementSize(m, m), block_size);
+  };
+
+  Matrix<const T, Device::CPU> reference_a = [&]() {
+    auto reference = create_reference();
+    matrix::util::set_random_hermitian(reference);
+    return reference;
+  }();
+
+  Matrix<const T, Device::CPU> reference_b = [&]() {
+    auto reference = create_reference();
+    matrix::util::set_random_hermitian_positive_definite(reference);
+    return reference;
+  }();
+
+  // B is factorized just once and then used for multiple problems.
+  Matrix<T, Device::CPU> mat_b_h(reference_b.distribution());
+  copy(reference_b, mat_b_h);
+  MatrixMirror<T, D, Device::CPU> mat_b(mat_b_h);
+  eigensolver::genEigensolverFactorize<B>(grid..., uplo, mat_b.get());
+
+  for (int run = 0; run < 2; ++run) {
+    Matrix<T, Device::CPU> mat_a_h(reference_a.distribution());
+    copy(reference_a, mat_a_h);
+
+    eigensolver::EigensolverResult<T, D> ret = [&]() {
+      MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+      Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(m, 1), TileElementSize(mb, 1));
+      Matrix<T, D> eigenvectors(reference_a.distribution());
+      eigensolver::genEigensolverFactorized<B>(grid..., uplo, mat_a.get(), mat_b.get(), eigenvalues,
+                                               eigenvectors);
+      return eigensolver::EigensolverResult<T, D>{std::move(eigenvalues), std::move(eigenvectors)};
+    }();
+
+    if (mat_a_h.size().isEmpty())
+      return;
+
+    testGenEigensolverCorrectness(uplo, reference_a, reference_b, ret, grid...);
+  }
+}
+
 TYPED_TEST(GenEigensolverTestMC, CorrectnessLocal) {
   for (auto uplo : blas_uplos) {
     for (auto [m, mb, b_min] : sizes) {
@@ -217,6 +269,26 @@ TYPED_TEST(GenEigensolverTestMC, CorrectnessDistributed) {
   }
 }
 
+TYPED_TEST(GenEigensolverTestMC, CorrectnessFactorizedLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      testGenEigensolverFactorized<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(GenEigensolverTestMC, CorrectnessFactorizedDistributed) {
+  for (const comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testGenEigensolverFactorized<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb, grid);
+      }
+    }
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(GenEigensolverTestGPU, CorrectnessLocal) {
   for (auto uplo : blas_uplos) {
@@ -242,4 +314,24 @@ TYPED_TEST(GenEigensolverTestGPU, CorrectnessDistributed) {
     }
   }
 }
+
+TYPED_TEST(GenEigensolverTestGPU, CorrectnessFactorizedLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      testGenEigensolverFactorized<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(GenEigensolverTestGPU, CorrectnessFactorizedDistributed) {
+  for (const comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testGenEigensolverFactorized<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb, grid);
+      }
+    }
+  }
+}
 #endif
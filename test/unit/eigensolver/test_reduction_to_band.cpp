@@ -9,6 +9,8 @@
 //
 
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include <pika/future.hpp>
 #include <pika/runtime.hpp>
@@ -27,6 +29,7 @@
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_mirror.h>
 #include <dlaf/memory/memory_view.h>
+#include <dlaf/tune.h>
 #include <dlaf/types.h>
 #include <dlaf/util_math.h>
 #include <dlaf/util_matrix.h>
@@ -38,6 +41,7 @@
 #include <dlaf_test/matrix/util_matrix.h>
 #include <dlaf_test/matrix/util_matrix_local.h>
 #include <dlaf_test/matrix/util_tile.h>
+#include <dlaf_test/util_tune.h>
 #include <dlaf_test/util_types.h>
 
 using namespace dlaf;
@@ -323,6 +327,34 @@ auto checkResult(const SizeType k, const SizeType band_size, Matrix<const T, Dev
                     std::max<SizeType>(1, mat_b.size().linear_size()) * TypeUtilities<T>::error);
 }
 
+// Checks that Q = H_1 H_2 ... H_k, where H_i are the k reflectors stored in mat_v (starting at
+// (band_size, 0)) with the corresponding taus, is unitary.
+template <class T>
+void checkOrthogonality(const SizeType k, const SizeType band_size, const MatrixLocal<const T>& mat_v,
+                        const std::vector<T>& taus) {
+  if (k == 0)
+    return;
+
+  const SizeType m = mat_v.size().rows() - band_size;
+
+  dlaf::common::internal::SingleThreadedBlasScope single;
+
+  MatrixLocal<T> mat_q({m, m}, mat_v.blockSize());
+  lapack::laset(blas::Uplo::General, m, m, T(0), T(0), mat_q.ptr(), mat_q.ld());
+  lapack::lacpy(blas::Uplo::Lower, m, k, mat_v.ptr({band_size, 0}), mat_v.ld(), mat_q.ptr(),
+                mat_q.ld());
+  lapack::ungqr(m, m, k, mat_q.ptr(), mat_q.ld(), taus.data());
+
+  MatrixLocal<T> mat_qhq({m, m}, mat_v.blockSize());
+  blas::gemm(blas::Layout::ColMajor, blas::Op::ConjTrans, blas::Op::NoTrans, m, m, m, T(1),
+             mat_q.ptr(), mat_q.ld(), mat_q.ptr(), mat_q.ld(), T(0), mat_qhq.ptr(), mat_qhq.ld());
+
+  auto identity = [](const GlobalElementIndex& index) {
+    return index.row() == index.col() ? T(1) : T(0);
+  };
+  CHECK_MATRIX_NEAR(identity, mat_qhq, 0, m * TypeUtilities<T>::error);
+}
+
 template <class T, Backend B, Device D>
 void testReductionToBandLocal(const LocalElementSize size, const TileElementSize block_size,
                               const SizeType band_size) {
@@ -434,6 +466,69 @@ void testReductionToBand(comm::CommunicatorGrid grid, const LocalElementSize siz
   checkResult(k_reflectors, band_size, reference, mat_v, mat_b, taus);
 }
 
+// Checks the distributed reduction to band with the CholeskyQR panel factorization (see
+// red2band_panel_cholqr): the band has to be reconstructed, Q has to be unitary and, as the Householder
+// reconstruction uses the same sign convention as the column-wise algorithm, the reflectors, the band
+// and the taus have to match the ones computed with the column-wise panel factorization.
+template <class T, Device D, Backend B>
+void testReductionToBandCholQR(comm::CommunicatorGrid grid, const LocalElementSize size,
+                               const TileElementSize block_size, const SizeType band_size) {
+  const SizeType k_reflectors = std::max(SizeType(0), size.rows() - band_size - 1);
+  DLAF_ASSERT(block_size.rows() % band_size == 0, block_size.rows(), band_size);
+
+  Distribution distribution({size.rows(), size.cols()}, block_size, grid.size(), grid.rank(), {0, 0});
+
+  // setup the reference input matrix
+  Matrix<const T, Device::CPU> reference = [&]() {
+    Matrix<T, Device::CPU> reference(distribution);
+    matrix::util::set_random_hermitian(reference);
+    return reference;
+  }();
+
+  auto reduce = [&](const bool cholqr) {
+    const ScopedTuneParameter cholqr_guard(&TuneParameters::red2band_panel_cholqr, cholqr);
+
+    Matrix<T, Device::CPU> matrix_a_h(distribution);
+    copy(reference, matrix_a_h);
+
+    common::internal::vector<pika::shared_future<common::internal::vector<T>>> local_taus;
+    {
+      MatrixMirror<T, D, Device::CPU> matrix_a(matrix_a_h);
+      local_taus = eigensolver::reductionToBand<B>(grid, matrix_a.get(), band_size);
+      pika::threads::get_thread_manager().wait();
+    }
+
+    checkUpperPartUnchanged(reference, matrix_a_h);
+
+    return std::make_pair(allGather(blas::Uplo::Lower, matrix_a_h, grid),
+                          allGatherTaus(k_reflectors, block_size.cols(), local_taus, grid));
+  };
+
+  auto result_hh = reduce(false);
+  auto result_cholqr = reduce(true);
+  const MatrixLocal<T>& mat_v_hh = result_hh.first;
+  const std::vector<T>& taus_hh = result_hh.second;
+  MatrixLocal<T>& mat_v = result_cholqr.first;
+  const std::vector<T>& taus = result_cholqr.second;
+  ASSERT_EQ(taus_hh.size(), k_reflectors);
+  ASSERT_EQ(taus.size(), k_reflectors);
+
+  auto mat_b = makeLocal(reference);
+  splitReflectorsAndBand(mat_v, mat_b, band_size);
+  checkResult(k_reflectors, band_size, reference, mat_v, mat_b, taus);
+
+  checkOrthogonality(k_reflectors, band_size, mat_v, taus);
+
+  const auto error = std::max<SizeType>(1, size.linear_size()) * TypeUtilities<T>::error;
+  auto lower_hh = [&mat_v_hh, &mat_v](const GlobalElementIndex& index) {
+    return index.row() >= index.col() ? mat_v_hh(index) : mat_v(index);
+  };
+  CHECK_MATRIX_NEAR(lower_hh, mat_v, error, error);
+
+  for (std::size_t j = 0; j < taus.size(); ++j)
+    EXPECT_LE(std::abs(taus[j] - taus_hh[j]), error) << "tau " << j;
+}
+
 TYPED_TEST(ReductionToBandTestMC, CorrectnessDistributed) {
   for (auto&& comm_grid : this->commGrids()) {
     for (const auto& [size, block_size, band_size] : configs) {
@@ -450,6 +545,52 @@ TYPED_TEST(ReductionToBandTestMC, CorrectnessDistributedSubBand) {
   }
 }
 
+TYPED_TEST(ReductionToBandTestMC, CorrectnessAdaptivePanelWorkers) {
+  const ScopedTuneParameter adaptive_guard(&TuneParameters::red2band_panel_adaptive, true);
+  // Note: the problems are solved twice, such that the second time the measured durations are used.
+  for (int run = 0; run < 2; ++run) {
+    for (auto&& comm_grid : this->commGrids()) {
+      for (const auto& [size, block_size, band_size] : configs) {
+        testReductionToBand<TypeParam, Device::CPU, Backend::MC>(comm_grid, size, block_size,
+                                                                 band_size);
+      }
+    }
+    for (const auto& [size, block_size, band_size] : configs) {
+      testReductionToBandLocal<TypeParam, Backend::MC, Device::CPU>(size, block_size, band_size);
+    }
+  }
+}
+
+TYPED_TEST(ReductionToBandTestMC, CorrectnessDistributedLookahead) {
+  for (const SizeType lookahead_depth : {0, 3}) {
+    const ScopedTuneParameter lookahead_guard(&TuneParameters::red2band_lookahead_depth,
+                                              lookahead_depth);
+
+    for (auto&& comm_grid : this->commGrids()) {
+      for (const auto& [size, block_size, band_size] : configs_subband) {
+        testReductionToBand<TypeParam, Device::CPU, Backend::MC>(comm_grid, size, block_size,
+                                                                 band_size);
+      }
+    }
+    for (const auto& [size, block_size, band_size] : configs_subband) {
+      testReductionToBandLocal<TypeParam, Backend::MC, Device::CPU>(size, block_size, band_size);
+    }
+  }
+}
+
+TYPED_TEST(ReductionToBandTestMC, CorrectnessDistributedCholQRPanel) {
+  for (auto&& comm_grid : this->commGrids()) {
+    for (const auto& [size, block_size, band_size] : configs) {
+      testReductionToBandCholQR<TypeParam, Device::CPU, Backend::MC>(comm_grid, size, block_size,
+                                                                     band_size);
+    }
+    for (const auto& [size, block_size, band_size] : configs_subband) {
+      testReductionToBandCholQR<TypeParam, Device::CPU, Backend::MC>(comm_grid, size, block_size,
+                                                                     band_size);
+    }
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(ReductionToBandTestGPU, CorrectnessDistributed) {
   for (auto&& comm_grid : this->commGrids()) {
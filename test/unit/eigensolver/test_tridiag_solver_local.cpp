@@ -8,15 +8,20 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <cstddef>
+#include <type_traits>
+
 #include <dlaf/eigensolver/tridiag_solver.h>
 #include <dlaf/eigensolver/tridiag_solver/impl.h>
 #include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/tune.h>
 
 #include <gtest/gtest.h>
 
 #include <dlaf_test/eigensolver/test_eigensolver_correctness.h>
 #include <dlaf_test/matrix/util_matrix.h>
 #include <dlaf_test/matrix/util_tile.h>
+#include <dlaf_test/util_tune.h>
 #include <dlaf_test/util_types.h>
 
 using namespace dlaf;
@@ -127,6 +132,88 @@ void solveLaplace1D(SizeType n, SizeType nb) {
   CHECK_MATRIX_NEAR(expected_evecs_fn, evecs, complex_error * n, complex_error * n);
 }
 
+template <Backend B, Device D, class T>
+void solveLaplace1DValuesOnly(SizeType n, SizeType nb) {
+  if constexpr (std::is_same_v<T, BaseType<T>>) {
+    constexpr T real_error = TypeUtilities<T>::error;
+
+    matrix::Matrix<T, Device::CPU> tridiag(LocalElementSize(n, 2), TileElementSize(nb, 2));
+    matrix::Matrix<T, Device::CPU> evals(LocalElementSize(n, 1), TileElementSize(nb, 1));
+
+    // Tridiagonal matrix : 1D Laplacian
+    matrix::util::set(tridiag, [](GlobalElementIndex el) { return el.col() == 0 ? T(2) : T(-1); });
+
+    {
+      matrix::MatrixMirror<T, D, Device::CPU> evals_mirror(evals);
+      eigensolver::tridiagSolver<B>(tridiag, evals_mirror.get());
+    }
+    if (n == 0)
+      return;
+
+    auto expected_evals_fn = [n](GlobalElementIndex i) {
+      return T(2 * (1 - std::cos(M_PI * (i.row() + 1) / (n + 1))));
+    };
+    CHECK_MATRIX_NEAR(expected_evals_fn, evals, n * real_error, n * real_error);
+  }
+}
+
+template <Backend B, Device D, class T>
+void solveLaplace1DSubset(SizeType n, SizeType nb, SizeType eval_idx_begin, SizeType eval_idx_end) {
+  using RealParam = BaseType<T>;
+  constexpr RealParam complex_error = TypeUtilities<T>::error;
+  constexpr RealParam real_error = TypeUtilities<RealParam>::error;
+
+  const SizeType k = eval_idx_end - eval_idx_begin;
+
+  matrix::Matrix<RealParam, Device::CPU> tridiag(LocalElementSize(n, 2), TileElementSize(nb, 2));
+  matrix::Matrix<RealParam, Device::CPU> evals(LocalElementSize(n, 1), TileElementSize(nb, 1));
+  matrix::Matrix<T, Device::CPU> evecs(LocalElementSize(n, k), TileElementSize(nb, nb));
+
+  // Tridiagonal matrix : 1D Laplacian
+  matrix::util::set(tridiag,
+                    [](GlobalElementIndex el) { return el.col() == 0 ? RealParam(2) : RealParam(-1); });
+
+  {
+    matrix::MatrixMirror<RealParam, D, Device::CPU> evals_mirror(evals);
+    matrix::MatrixMirror<T, D, Device::CPU> evecs_mirror(evecs);
+
+    eigensolver::tridiagSolver<B>(tridiag, evals_mirror.get(), evecs_mirror.get(), eval_idx_begin,
+                                  eval_idx_end);
+  }
+  if (n == 0)
+    return;
+
+  // Eigenvalues (all of them are computed)
+  auto expected_evals_fn = [n](GlobalElementIndex i) {
+    return RealParam(2 * (1 - std::cos(M_PI * (i.row() + 1) / (n + 1))));
+  };
+  CHECK_MATRIX_NEAR(expected_evals_fn, evals, n * real_error, n * real_error);
+
+  if (k == 0)
+    return;
+
+  // Eigenvectors are unique up to a sign. The first row of the expected eigenvectors is positive,
+  // therefore the sign of the first row of the computed ones is used.
+  const auto& dist = evecs.distribution();
+  std::vector<RealParam> signs(to_sizet(k));
+  for (SizeType j = 0; j < k; ++j) {
+    const GlobalTileIndex tile_idx(0, dist.template globalTileFromGlobalElement<Coord::Col>(j));
+    const TileElementIndex el_idx(0, dist.template tileElementFromGlobalElement<Coord::Col>(j));
+    auto tile = sync_wait(evecs.readwrite(tile_idx));
+    signs[to_sizet(j)] = std::real(tile(el_idx)) < 0 ? RealParam(-1) : RealParam(1);
+  }
+
+  auto expected_evecs_fn = [n, eval_idx_begin, &signs](GlobalElementIndex i) {
+    SizeType j = eval_idx_begin + i.col() + 1;
+    SizeType k = i.row() + 1;
+    return TypeUtilities<T>::element(signs[to_sizet(i.col())] * std::sqrt(2.0 / (n + 1)) *
+                                         std::sin(j * k * M_PI / (n + 1)),
+                                     0);
+  };
+
+  CHECK_MATRIX_NEAR(expected_evecs_fn, evecs, complex_error * n, complex_error * n);
+}
+
 template <Backend B, Device D, class T>
 void solveRandomTridiagMatrix(SizeType n, SizeType nb) {
   using RealParam = BaseType<T>;
@@ -213,12 +300,73 @@ TYPED_TEST(TridiagEigensolverTestCPU, Laplace1D) {
   }
 }
 
+TYPED_TEST(TridiagEigensolverTestCPU, Laplace1DValuesOnly) {
+  for (auto [n, nb] : tested_problems) {
+    solveLaplace1DValuesOnly<Backend::MC, Device::CPU, TypeParam>(n, nb);
+  }
+}
+
+// Ranges of eigenvalue indices [begin, end) given as fractions of n.
+const std::vector<std::tuple<double, double>> eval_ranges = {
+    {0., 0.},    // empty range
+    {0., .25},   // lower end of the spectrum
+    {.3, .65},   // interior of the spectrum (not aligned to tiles)
+    {.5, 1.},    // upper end of the spectrum
+};
+
+TYPED_TEST(TridiagEigensolverTestCPU, Laplace1DSubset) {
+  for (auto [n, nb] : tested_problems) {
+    for (auto [begin, end] : eval_ranges) {
+      solveLaplace1DSubset<Backend::MC, Device::CPU, TypeParam>(n, nb, static_cast<SizeType>(begin * n),
+                                                                static_cast<SizeType>(end * n));
+    }
+  }
+}
+
 TYPED_TEST(TridiagEigensolverTestCPU, Random) {
   for (auto [n, nb] : tested_problems) {
     solveRandomTridiagMatrix<Backend::MC, Device::CPU, TypeParam>(n, nb);
   }
 }
 
+TYPED_TEST(TridiagEigensolverTestCPU, MemoryLean) {
+  const ScopedTuneParameter lean_guard(&TuneParameters::tridiag_memory_lean, true);
+  for (auto [n, nb] : tested_problems) {
+    solveLaplace1D<Backend::MC, Device::CPU, TypeParam>(n, nb);
+    solveRandomTridiagMatrix<Backend::MC, Device::CPU, TypeParam>(n, nb);
+  }
+}
+
+TYPED_TEST(TridiagEigensolverTestCPU, AdaptiveRank1Workers) {
+  const ScopedTuneParameter adaptive_guard(&TuneParameters::tridiag_rank1_adaptive, true);
+  // Note: the problems are solved twice, such that the second time the measured durations are used.
+  for (int run = 0; run < 2; ++run) {
+    for (auto [n, nb] : tested_problems) {
+      solveRandomTridiagMatrix<Backend::MC, Device::CPU, TypeParam>(n, nb);
+    }
+  }
+}
+
+TYPED_TEST(TridiagEigensolverTestCPU, PeakMemory) {
+  using eigensolver::TridiagMemoryMode;
+  using eigensolver::tridiagSolverPeakMemoryBytes;
+
+  for (auto [n, nb] : tested_problems) {
+    const matrix::Distribution dist(LocalElementSize(n, n), TileElementSize(nb, nb));
+    const std::size_t standard =
+        tridiagSolverPeakMemoryBytes<Device::CPU, TypeParam>(dist, false, TridiagMemoryMode::Standard);
+    const std::size_t lean =
+        tridiagSolverPeakMemoryBytes<Device::CPU, TypeParam>(dist, false, TridiagMemoryMode::Lean);
+
+    // Lean mode replaces a (n x n) workspace with a (nb x n) one
+    EXPECT_EQ(standard - lean, sizeof(BaseType<TypeParam>) * to_sizet((n - nb) * n));
+
+    // The distributed solver does not support the lean mode
+    EXPECT_EQ(tridiagSolverPeakMemoryBytes<Device::CPU, TypeParam>(dist, true, TridiagMemoryMode::Lean),
+              standard);
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(TridiagEigensolverTestGPU, Laplace1D) {
   for (auto [n, nb] : tested_problems) {
@@ -226,9 +374,32 @@ TYPED_TEST(TridiagEigensolverTestGPU, Laplace1D) {
   }
 }
 
+TYPED_TEST(TridiagEigensolverTestGPU, Laplace1DValuesOnly) {
+  for (auto [n, nb] : tested_problems) {
+    solveLaplace1DValuesOnly<Backend::GPU, Device::GPU, TypeParam>(n, nb);
+  }
+}
+
+TYPED_TEST(TridiagEigensolverTestGPU, Laplace1DSubset) {
+  for (auto [n, nb] : tested_problems) {
+    for (auto [begin, end] : eval_ranges) {
+      solveLaplace1DSubset<Backend::GPU, Device::GPU, TypeParam>(n, nb, static_cast<SizeType>(begin * n),
+                                                                 static_cast<SizeType>(end * n));
+    }
+  }
+}
+
 TYPED_TEST(TridiagEigensolverTestGPU, Random) {
   for (auto [n, nb] : tested_problems) {
     solveRandomTridiagMatrix<Backend::GPU, Device::GPU, TypeParam>(n, nb);
   }
 }
+
+TYPED_TEST(TridiagEigensolverTestGPU, MemoryLean) {
+  const ScopedTuneParameter lean_guard(&TuneParameters::tridiag_memory_lean, true);
+  for (auto [n, nb] : tested_problems) {
+    solveLaplace1D<Backend::GPU, Device::GPU, TypeParam>(n, nb);
+    solveRandomTridiagMatrix<Backend::GPU, Device::GPU, TypeParam>(n, nb);
+  }
+}
 #endif
@@ -8,6 +8,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include <dlaf/eigensolver/tridiag_solver/merge.h>
 #include <dlaf/util_matrix.h>
 
@@ -187,3 +192,105 @@ TYPED_TEST(TridiagEigensolverMergeTest, Deflation) {
   };
   CHECK_MATRIX_EQ(expected_c_fn, c_mat_sorted);
 }
+
+TYPED_TEST(TridiagEigensolverMergeTest, SecularEquations) {
+  using T = TypeParam;
+
+  for (const SizeType k : {1, 2, 3, 8, 9, 31}) {
+    // diag(d) + rho * z * z^T with d sorted in ascending order and ||z|| == 1
+    std::vector<T> d(to_sizet(k));
+    std::vector<T> z(to_sizet(k));
+    T norm = 0;
+    for (SizeType j = 0; j < k; ++j) {
+      d[to_sizet(j)] = T(j) + T(0.1) * std::sin(T(j));
+      z[to_sizet(j)] = T(1) + T(0.5) * std::cos(T(j));
+      norm += z[to_sizet(j)] * z[to_sizet(j)];
+    }
+    for (auto& z_j : z)
+      z_j /= std::sqrt(norm);
+    const T rho = T(1.5);
+
+    std::vector<T> evals_ref(to_sizet(k));
+    std::vector<T> deltas_ref(to_sizet(k * k));
+    solveSecularEquationsLaed4(k, 0, k, d.data(), z.data(), rho, evals_ref.data(),
+                               [&](SizeType i) { return deltas_ref.data() + i * k; });
+
+    // Compute a subset of the roots (with a partial batch) to check that the others are not touched.
+    const SizeType i_begin = std::min<SizeType>(1, k - 1);
+    std::vector<T> evals(to_sizet(k), T(-1));
+    std::vector<T> deltas(to_sizet(k * k), T(-1));
+    solveSecularEquations(k, i_begin, k, d.data(), z.data(), rho, evals.data(),
+                          [&](SizeType i) { return deltas.data() + i * k; });
+
+    const T tol = 1000 * k * std::numeric_limits<T>::epsilon();
+    for (SizeType i = 0; i < k; ++i) {
+      if (i < i_begin) {
+        EXPECT_EQ(T(-1), evals[to_sizet(i)]);
+        continue;
+      }
+      EXPECT_NEAR(evals_ref[to_sizet(i)], evals[to_sizet(i)], tol * std::abs(evals_ref[to_sizet(i)]))
+          << "k=" << k << " i=" << i;
+      for (SizeType j = 0; j < k; ++j) {
+        const T ref = deltas_ref[to_sizet(i * k + j)];
+        EXPECT_NEAR(ref, deltas[to_sizet(i * k + j)], tol * std::abs(ref))
+            << "k=" << k << " i=" << i << " j=" << j;
+      }
+    }
+  }
+}
+
+TYPED_TEST(TridiagEigensolverMergeTest, SecularEquationsClusteredPoles) {
+  using T = TypeParam;
+
+  // Clusters of very close poles, with small weights, between well separated ones, which slow down the
+  // convergence of the batched iteration. The roots that do not converge within the maximum number of
+  // iterations have to be computed with laed4.
+  const SizeType k = 21;
+  std::vector<T> d(to_sizet(k));
+  std::vector<T> z(to_sizet(k));
+  T norm = 0;
+  for (SizeType j = 0; j < k; ++j) {
+    const SizeType cluster = j / 7;
+    const SizeType j_in_cluster = j % 7;
+    d[to_sizet(j)] = T(cluster) + j_in_cluster * 100 * std::numeric_limits<T>::epsilon();
+    z[to_sizet(j)] = (j_in_cluster == 0) ? T(1) : T(1e-3) * T(j_in_cluster);
+    norm += z[to_sizet(j)] * z[to_sizet(j)];
+  }
+  for (auto& z_j : z)
+    z_j /= std::sqrt(norm);
+  const T rho = T(0.5);
+
+  std::vector<T> evals_ref(to_sizet(k));
+  std::vector<T> deltas_ref(to_sizet(k * k));
+  solveSecularEquationsLaed4(k, 0, k, d.data(), z.data(), rho, evals_ref.data(),
+                             [&](SizeType i) { return deltas_ref.data() + i * k; });
+
+  const T tol = 1000 * k * std::numeric_limits<T>::epsilon();
+  for (const int max_iterations : {0, 1, 2, secular_max_iterations}) {
+    std::vector<T> evals(to_sizet(k), T(-1));
+    std::vector<T> deltas(to_sizet(k * k), T(-1));
+    const SizeType nr_laed4 =
+        solveSecularEquations(k, 0, k, d.data(), z.data(), rho, evals.data(),
+                              [&](SizeType i) { return deltas.data() + i * k; }, max_iterations);
+
+    EXPECT_LE(nr_laed4, k);
+    if (max_iterations == 0) {
+      // No iteration: all the roots are computed with laed4.
+      EXPECT_EQ(k, nr_laed4);
+      EXPECT_EQ(evals_ref, evals);
+      EXPECT_EQ(deltas_ref, deltas);
+      continue;
+    }
+
+    for (SizeType i = 0; i < k; ++i) {
+      EXPECT_NEAR(evals_ref[to_sizet(i)], evals[to_sizet(i)],
+                  tol * std::max(T(1), std::abs(evals_ref[to_sizet(i)])))
+          << "max_iterations=" << max_iterations << " i=" << i;
+      for (SizeType j = 0; j < k; ++j) {
+        const T ref = deltas_ref[to_sizet(i * k + j)];
+        EXPECT_NEAR(ref, deltas[to_sizet(i * k + j)], tol * std::max(T(1), std::abs(ref)))
+            << "max_iterations=" << max_iterations << " i=" << i << " j=" << j;
+      }
+    }
+  }
+}
@@ -189,3 +189,234 @@ TYPED_TEST(GeneralSubMultiplicationDistTestGPU, CorrectnessDistributed) {
   }
 }
 #endif
+
+const std::vector<blas::Op> ops({blas::Op::NoTrans, blas::Op::Trans, blas::Op::ConjTrans});
+
+const std::vector<std::tuple<SizeType, SizeType, SizeType, SizeType>> sizes_gemm = {
+    // m, n, k, mb
+    {0, 0, 5, 2},  {0, 5, 3, 2},   {5, 0, 3, 2},   {5, 4, 0, 2},   {3, 3, 3, 3},
+    {6, 4, 1, 2},  {4, 6, 9, 2},   {13, 7, 10, 3}, {7, 13, 10, 3}, {10, 7, 13, 3},
+    {21, 21, 21, 4},
+};
+
+template <class T, Backend B, Device D>
+void testGeneralMatrixMultiplication(const blas::Op opA, const blas::Op opB, const T alpha, const T beta,
+                                     const SizeType m, const SizeType n, const SizeType k,
+                                     const SizeType mb) {
+  auto [el_a, el_b, el_c, res_c] =
+      matrix::test::getMatrixMatrixMultiplication<GlobalElementIndex, T>(opA, opB, k, alpha, beta);
+
+  const LocalElementSize size_a = opA == blas::Op::NoTrans ? LocalElementSize(m, k)
+                                                           : LocalElementSize(k, m);
+  const LocalElementSize size_b = opB == blas::Op::NoTrans ? LocalElementSize(k, n)
+                                                           : LocalElementSize(n, k);
+
+  auto setMatrix = [&](auto elSetter, const LocalElementSize size) {
+    Matrix<T, Device::CPU> matrix(size, {mb, mb});
+    dlaf::matrix::util::set(matrix, elSetter);
+    return matrix;
+  };
+
+  Matrix<const T, Device::CPU> mat_ah = setMatrix(el_a, size_a);
+  Matrix<const T, Device::CPU> mat_bh = setMatrix(el_b, size_b);
+  Matrix<T, Device::CPU> mat_ch = setMatrix(el_c, {m, n});
+
+  {
+    MatrixMirror<const T, D, Device::CPU> mat_a(mat_ah);
+    MatrixMirror<const T, D, Device::CPU> mat_b(mat_bh);
+    MatrixMirror<T, D, Device::CPU> mat_c(mat_ch);
+
+    multiplication::generalMatrix<B>(opA, opB, alpha, mat_a.get(), mat_b.get(), beta, mat_c.get());
+  }
+
+  CHECK_MATRIX_NEAR(res_c, mat_ch, 2 * (k + 1) * TypeUtilities<T>::error,
+                    2 * (k + 1) * TypeUtilities<T>::error);
+}
+
+TYPED_TEST(GeneralMultiplicationTestMC, CorrectnessLocalAllOps) {
+  for (const auto opA : ops) {
+    for (const auto opB : ops) {
+      for (const auto& [m, n, k, mb] : sizes_gemm) {
+        const TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
+        const TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
+        testGeneralMatrixMultiplication<TypeParam, Backend::MC, Device::CPU>(opA, opB, alpha, beta, m,
+                                                                             n, k, mb);
+      }
+    }
+  }
+}
+
+#ifdef DLAF_WITH_GPU
+TYPED_TEST(GeneralMultiplicationTestGPU, CorrectnessLocalAllOps) {
+  for (const auto opA : ops) {
+    for (const auto opB : ops) {
+      for (const auto& [m, n, k, mb] : sizes_gemm) {
+        const TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
+        const TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
+        testGeneralMatrixMultiplication<TypeParam, Backend::GPU, Device::GPU>(opA, opB, alpha, beta, m,
+                                                                              n, k, mb);
+      }
+    }
+  }
+}
+#endif
+
+template <class T, Backend B, Device D>
+void testGeneralMatrixMultiplication(comm::CommunicatorGrid grid, const blas::Op opA,
+                                     const blas::Op opB, const T alpha, const T beta, const SizeType m,
+                                     const SizeType n, const SizeType k, const SizeType mb) {
+  const comm::Index2D src_rank_index(std::max(0, grid.size().rows() - 1),
+                                     std::min(1, grid.size().cols() - 1));
+
+  auto [el_a, el_b, el_c, res_c] =
+      matrix::test::getMatrixMatrixMultiplication<GlobalElementIndex, T>(opA, opB, k, alpha, beta);
+
+  const GlobalElementSize size_a = opA == blas::Op::NoTrans ? GlobalElementSize(m, k)
+                                                            : GlobalElementSize(k, m);
+  const GlobalElementSize size_b = opB == blas::Op::NoTrans ? GlobalElementSize(k, n)
+                                                            : GlobalElementSize(n, k);
+
+  auto distributedMatrixFrom = [&](auto elSetter, const GlobalElementSize size) {
+    Matrix<T, Device::CPU> matrix(matrix::Distribution(size, {mb, mb}, grid.size(), grid.rank(),
+                                                       src_rank_index));
+    dlaf::matrix::util::set(matrix, elSetter);
+    return matrix;
+  };
+
+  Matrix<const T, Device::CPU> mat_ah(distributedMatrixFrom(el_a, size_a));
+  Matrix<const T, Device::CPU> mat_bh(distributedMatrixFrom(el_b, size_b));
+  Matrix<T, Device::CPU> mat_ch(distributedMatrixFrom(el_c, {m, n}));
+
+  {
+    MatrixMirror<const T, D, Device::CPU> mat_a(mat_ah);
+    MatrixMirror<const T, D, Device::CPU> mat_b(mat_bh);
+    MatrixMirror<T, D, Device::CPU> mat_c(mat_ch);
+
+    multiplication::generalMatrix<B>(grid, opA, opB, alpha, mat_a.get(), mat_b.get(), beta,
+                                     mat_c.get());
+  }
+
+  CHECK_MATRIX_NEAR(res_c, mat_ch, 2 * (k + 1) * TypeUtilities<T>::error,
+                    2 * (k + 1) * TypeUtilities<T>::error);
+}
+
+TYPED_TEST(GeneralSubMultiplicationDistTestMC, CorrectnessDistributedAllOps) {
+  for (auto comm_grid : this->commGrids()) {
+    for (const auto opA : ops) {
+      for (const auto opB : ops) {
+        for (const auto& [m, n, k, mb] : sizes_gemm) {
+          const TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
+          const TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
+          testGeneralMatrixMultiplication<TypeParam, Backend::MC, Device::CPU>(comm_grid, opA, opB,
+                                                                               alpha, beta, m, n, k,
+                                                                               mb);
+          pika::threads::get_thread_manager().wait();
+        }
+      }
+    }
+  }
+}
+
+#ifdef DLAF_WITH_GPU
+TYPED_TEST(GeneralSubMultiplicationDistTestGPU, CorrectnessDistributedAllOps) {
+  for (auto comm_grid : this->commGrids()) {
+    for (const auto opA : ops) {
+      for (const auto opB : ops) {
+        for (const auto& [m, n, k, mb] : sizes_gemm) {
+          const TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
+          const TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
+          testGeneralMatrixMultiplication<TypeParam, Backend::GPU, Device::GPU>(comm_grid, opA, opB,
+                                                                                alpha, beta, m, n, k,
+                                                                                mb);
+          pika::threads::get_thread_manager().wait();
+        }
+      }
+    }
+  }
+}
+#endif
+
+// nr_layers, grid rows, grid cols (6 ranks)
+const std::vector<std::tuple<int, int, int>> layers_configs = {
+    {1, 2, 3}, {2, 3, 1}, {2, 1, 3}, {3, 2, 1}, {6, 1, 1},
+};
+
+template <class T, Backend B, Device D>
+void testGeneralMatrixMultiplication(comm::CommunicatorGridLayers& layers, const blas::Op opA,
+                                     const blas::Op opB, const T alpha, const T beta, const SizeType m,
+                                     const SizeType n, const SizeType k, const SizeType mb) {
+  auto& grid = layers.grid();
+  const comm::Index2D src_rank_index(std::max(0, grid.size().rows() - 1),
+                                     std::min(1, grid.size().cols() - 1));
+
+  auto [el_a, el_b, el_c, res_c] =
+      matrix::test::getMatrixMatrixMultiplication<GlobalElementIndex, T>(opA, opB, k, alpha, beta);
+
+  const GlobalElementSize size_a = opA == blas::Op::NoTrans ? GlobalElementSize(m, k)
+                                                            : GlobalElementSize(k, m);
+  const GlobalElementSize size_b = opB == blas::Op::NoTrans ? GlobalElementSize(k, n)
+                                                            : GlobalElementSize(n, k);
+
+  auto distributedMatrixFrom = [&](auto elSetter, const GlobalElementSize size) {
+    Matrix<T, Device::CPU> matrix(matrix::Distribution(size, {mb, mb}, grid.size(), grid.rank(),
+                                                       src_rank_index));
+    dlaf::matrix::util::set(matrix, elSetter);
+    return matrix;
+  };
+
+  Matrix<const T, Device::CPU> mat_ah(distributedMatrixFrom(el_a, size_a));
+  Matrix<const T, Device::CPU> mat_bh(distributedMatrixFrom(el_b, size_b));
+  Matrix<T, Device::CPU> mat_ch(distributedMatrixFrom(el_c, {m, n}));
+
+  {
+    MatrixMirror<const T, D, Device::CPU> mat_a(mat_ah);
+    MatrixMirror<const T, D, Device::CPU> mat_b(mat_bh);
+    MatrixMirror<T, D, Device::CPU> mat_c(mat_ch);
+
+    multiplication::generalMatrix<B>(layers, opA, opB, alpha, mat_a.get(), mat_b.get(), beta,
+                                     mat_c.get());
+  }
+
+  CHECK_MATRIX_NEAR(res_c, mat_ch, 2 * (k + 1) * TypeUtilities<T>::error,
+                    2 * (k + 1) * TypeUtilities<T>::error);
+}
+
+TYPED_TEST(GeneralSubMultiplicationDistTestMC, CorrectnessDistributedLayers) {
+  comm::Communicator world(MPI_COMM_WORLD);
+  for (const auto& [nr_layers, rows, cols] : layers_configs) {
+    comm::CommunicatorGridLayers layers(world, nr_layers, rows, cols, common::Ordering::ColumnMajor);
+    for (const auto opA : ops) {
+      for (const auto opB : ops) {
+        for (const auto& [m, n, k, mb] : sizes_gemm) {
+          const TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
+          const TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
+          testGeneralMatrixMultiplication<TypeParam, Backend::MC, Device::CPU>(layers, opA, opB,
+                                                                               alpha, beta, m, n, k,
+                                                                               mb);
+          pika::threads::get_thread_manager().wait();
+        }
+      }
+    }
+  }
+}
+
+#ifdef DLAF_WITH_GPU
+TYPED_TEST(GeneralSubMultiplicationDistTestGPU, CorrectnessDistributedLayers) {
+  comm::Communicator world(MPI_COMM_WORLD);
+  for (const auto& [nr_layers, rows, cols] : layers_configs) {
+    comm::CommunicatorGridLayers layers(world, nr_layers, rows, cols, common::Ordering::ColumnMajor);
+    for (const auto opA : ops) {
+      for (const auto opB : ops) {
+        for (const auto& [m, n, k, mb] : sizes_gemm) {
+          const TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
+          const TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
+          testGeneralMatrixMultiplication<TypeParam, Backend::GPU, Device::GPU>(layers, opA, opB,
+                                                                                alpha, beta, m, n, k,
+                                                                                mb);
+          pika::threads::get_thread_manager().wait();
+        }
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,152 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <functional>
+#include <tuple>
+
+#include <pika/runtime.hpp>
+
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/solver/cholesky.h>
+
+#include <gtest/gtest.h>
+
+#include <dlaf_test/comm_grids/grids_6_ranks.h>
+#include <dlaf_test/matrix/util_generic_lapack.h>
+#include <dlaf_test/matrix/util_matrix.h>
+#include <dlaf_test/util_tune.h>
+#include <dlaf_test/util_types.h>
+
+using namespace dlaf;
+using namespace dlaf::comm;
+using namespace dlaf::matrix;
+using namespace dlaf::matrix::test;
+using namespace dlaf::test;
+using namespace testing;
+
+::testing::Environment* const comm_grids_env =
+    ::testing::AddGlobalTestEnvironment(new CommunicatorGrid6RanksEnvironment);
+
+template <class T>
+struct CholeskySolverTestMC : public TestWithCommGrids {};
+
+TYPED_TEST_SUITE(CholeskySolverTestMC, MatrixElementTypes);
+
+#ifdef DLAF_WITH_GPU
+template <class T>
+struct CholeskySolverTestGPU : public TestWithCommGrids {};
+
+TYPED_TEST_SUITE(CholeskySolverTestGPU, MatrixElementTypes);
+#endif
+
+const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower, blas::Uplo::Upper});
+
+const std::vector<std::tuple<SizeType, SizeType, SizeType, SizeType>> sizes = {
+    {0, 0, 2, 2},                                                    // m, n = 0
+    {0, 3, 2, 2},    {7, 0, 3, 2},                                   // m = 0 or n = 0
+    {5, 3, 8, 2},    {34, 34, 34, 34},                               // m <= mb
+    {4, 3, 3, 2},    {16, 10, 10, 3}, {34, 13, 13, 5}, {32, 5, 5, 4}  // m > mb
+};
+
+template <class T, Backend B, Device D>
+void testCholeskySolver(const blas::Uplo uplo, const SizeType m, const SizeType n, const SizeType mb,
+                        const SizeType nb) {
+  Matrix<T, Device::CPU> mat_ah(LocalElementSize(m, m), TileElementSize(mb, mb));
+  Matrix<T, Device::CPU> mat_bh(LocalElementSize(m, n), TileElementSize(mb, nb));
+
+  auto [el_a, el_b, res_x] = getCholeskySolverSetters<GlobalElementIndex, T>(uplo, m);
+
+  set(mat_ah, el_a);
+  set(mat_bh, el_b);
+
+  {
+    MatrixMirror<T, D, Device::CPU> mat_a(mat_ah);
+    MatrixMirror<T, D, Device::CPU> mat_b(mat_bh);
+    solver::cholesky<B, D, T>(uplo, mat_a.get(), mat_b.get());
+  }
+
+  CHECK_MATRIX_NEAR(res_x, mat_bh, 10 * (m + 1) * TypeUtilities<T>::error,
+                    10 * (m + 1) * TypeUtilities<T>::error);
+}
+
+template <class T, Backend B, Device D>
+void testCholeskySolver(comm::CommunicatorGrid grid, const blas::Uplo uplo, const SizeType m,
+                        const SizeType n, const SizeType mb, const SizeType nb) {
+  Index2D src_rank_index(std::max(0, grid.size().rows() - 1), std::min(1, grid.size().cols() - 1));
+
+  Distribution distr_a(GlobalElementSize(m, m), TileElementSize(mb, mb), grid.size(), grid.rank(),
+                       src_rank_index);
+  Distribution distr_b(GlobalElementSize(m, n), TileElementSize(mb, nb), grid.size(), grid.rank(),
+                       src_rank_index);
+  Matrix<T, Device::CPU> mat_ah(std::move(distr_a));
+  Matrix<T, Device::CPU> mat_bh(std::move(distr_b));
+
+  auto [el_a, el_b, res_x] = getCholeskySolverSetters<GlobalElementIndex, T>(uplo, m);
+
+  set(mat_ah, el_a);
+  set(mat_bh, el_b);
+
+  {
+    MatrixMirror<T, D, Device::CPU> mat_a(mat_ah);
+    MatrixMirror<T, D, Device::CPU> mat_b(mat_bh);
+    solver::cholesky<B, D, T>(grid, uplo, mat_a.get(), mat_b.get());
+  }
+
+  CHECK_MATRIX_NEAR(res_x, mat_bh, 10 * (m + 1) * TypeUtilities<T>::error,
+                    10 * (m + 1) * TypeUtilities<T>::error);
+}
+
+TYPED_TEST(CholeskySolverTestMC, CorrectnessLocal) {
+  for (auto uplo : blas_uplos) {
+    for (const auto& [m, n, mb, nb] : sizes) {
+      testCholeskySolver<TypeParam, Backend::MC, Device::CPU>(uplo, m, n, mb, nb);
+    }
+  }
+}
+
+TYPED_TEST(CholeskySolverTestMC, CorrectnessDistributed) {
+  for (const auto& comm_grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (const auto& [m, n, mb, nb] : sizes) {
+        for (const bool keep_panels : {true, false}) {
+          const ScopedTuneParameter guard(&TuneParameters::cholesky_solver_keep_panels, keep_panels);
+          testCholeskySolver<TypeParam, Backend::MC, Device::CPU>(comm_grid, uplo, m, n, mb, nb);
+          pika::threads::get_thread_manager().wait();
+        }
+      }
+    }
+  }
+}
+
+#ifdef DLAF_WITH_GPU
+TYPED_TEST(CholeskySolverTestGPU, CorrectnessLocal) {
+  for (auto uplo : blas_uplos) {
+    for (const auto& [m, n, mb, nb] : sizes) {
+      testCholeskySolver<TypeParam, Backend::GPU, Device::GPU>(uplo, m, n, mb, nb);
+    }
+  }
+}
+
+TYPED_TEST(CholeskySolverTestGPU, CorrectnessDistributed) {
+  for (const auto& comm_grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (const auto& [m, n, mb, nb] : sizes) {
+        for (const bool keep_panels : {true, false}) {
+          const ScopedTuneParameter guard(&TuneParameters::cholesky_solver_keep_panels, keep_panels);
+          testCholeskySolver<TypeParam, Backend::GPU, Device::GPU>(comm_grid, uplo, m, n, mb, nb);
+          pika::threads::get_thread_manager().wait();
+        }
+      }
+    }
+  }
+}
+#endif
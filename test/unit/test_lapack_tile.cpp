@@ -11,6 +11,7 @@
 
 #include <dlaf/lapack/tile.h>
 
+#include "test_lapack_tile/test_conj_transpose.h"
 #include "test_lapack_tile/test_hegst.h"
 #include "test_lapack_tile/test_lange.h"
 #include "test_lapack_tile/test_lantr.h"
@@ -281,6 +282,24 @@ TYPED_TEST(TileOperationsTestGPU, Set0) {
 }
 #endif
 
+TYPED_TEST(TileOperationsTestMC, ConjTranspose) {
+  using Type = TypeParam;
+
+  for (const auto& [m, n, extra_lda] : setsizes) {
+    testConjTranspose<Type, Device::CPU>(m, n, extra_lda);
+  }
+}
+
+#ifdef DLAF_WITH_GPU
+TYPED_TEST(TileOperationsTestGPU, ConjTranspose) {
+  using Type = TypeParam;
+
+  for (const auto& [m, n, extra_lda] : setsizes) {
+    testConjTranspose<Type, Device::GPU>(m, n, extra_lda);
+  }
+}
+#endif
+
 TYPED_TEST(RealTileOperationsTestMC, Stedc) {
   using dlaf::matrix::test::createTile;
 
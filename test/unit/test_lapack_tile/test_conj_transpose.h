@@ -0,0 +1,56 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) 2018-2023, ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <sstream>
+
+#include <dlaf/lapack/tile.h>
+#include <dlaf/matrix/tile.h>
+
+#include <gtest/gtest.h>
+
+#include <dlaf_test/blas/invoke.h>
+#include <dlaf_test/matrix/util_tile.h>
+#include <dlaf_test/util_types.h>
+
+namespace dlaf {
+namespace test {
+
+using namespace dlaf::matrix;
+using namespace dlaf::matrix::test;
+using namespace testing;
+
+template <class T, Device D>
+void testConjTranspose(const SizeType m, const SizeType n, SizeType extra_lda) {
+  const SizeType lda = std::max<SizeType>(1, m) + extra_lda;
+  const SizeType ldb = std::max<SizeType>(1, n) + extra_lda;
+
+  auto el = [](const TileElementIndex& idx) {
+    return TypeUtilities<T>::element(idx.row() + idx.col(), idx.row() - idx.col());
+  };
+  auto res = [el](const TileElementIndex& idx) {
+    return dlaf::conj(el(common::transposed(idx)));
+  };
+  auto zero = [](const TileElementIndex&) { return TypeUtilities<T>::element(0.0, 0.0); };
+
+  auto a = createTile<const T, D>(el, TileElementSize(m, n), lda);
+  auto b = createTile<T, D>(zero, TileElementSize(n, m), ldb);
+
+  invoke<D>(tile::internal::conjTranspose_o, a, b);
+
+  std::stringstream s;
+  s << "CONJ_TRANSPOSE: m = " << m << ", n = " << n << ", lda = " << lda << ", ldb = " << ldb;
+  SCOPED_TRACE(s.str());
+
+  CHECK_TILE_EQ(res, b);
+}
+}
+}